@@ -0,0 +1,2075 @@
+/******************************************************************************
+ *
+ * Implementation of Elan HID (I2C-HID / SPI-HID) Tools Micro-Benchmark
+ *
+ * Release:
+ *		2026/10
+ *
+ * Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+ *****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include "ElanTsDebug.h"
+#include "HIDLinuxGet.h"
+#include "ElanTsHidUtility.h"
+#include "ElanTsFuncApi.h"
+#include "ElanTsFwFileIoUtility.h"
+#include "ElanGen8TsFwFileIoUtility.h"
+#include "ElanGen8TsFuncApi.h"
+#include "ElanTsGenFlow.h"
+#include "ElanTsFwCompress.h"
+#include "ElanTsFwBundle.h"
+#include "ElanTsGenTraits.h"
+#include "ElanTsLcmDevUtility.h"
+#include "ElanTsEdidUtility.h"
+#include "ElanTsReportStream.h"
+#include "ElanTsReportRing.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// SW Version
+#ifndef ELAN_TOOL_SW_VERSION
+#define ELAN_TOOL_SW_VERSION           "0.1"
+#endif //ELAN_TOOL_SW_VERSION
+
+// SW Release Date
+#ifndef ELAN_TOOL_SW_RELEASE_DATE
+#define ELAN_TOOL_SW_RELEASE_DATE	"2026-10-19"
+#endif //ELAN_TOOL_SW_RELEASE_DATE
+
+// Default Work Directory (Temporary Firmware / Mapping / Log Files)
+#ifndef BENCH_DEFAULT_WORK_DIR
+#define BENCH_DEFAULT_WORK_DIR         "/tmp"
+#endif //BENCH_DEFAULT_WORK_DIR
+
+// Default Repeat Count of Each Benchmark
+#ifndef BENCH_DEFAULT_REPEAT_COUNT
+#define BENCH_DEFAULT_REPEAT_COUNT     5
+#endif //BENCH_DEFAULT_REPEAT_COUNT
+
+// Max. Repeat Count of Each Benchmark
+#ifndef BENCH_MAX_REPEAT_COUNT
+#define BENCH_MAX_REPEAT_COUNT         64
+#endif //BENCH_MAX_REPEAT_COUNT
+
+// Page Count of Emulated eKTL Firmware (Not Including Header Page)
+#ifndef BENCH_EKTL_FW_PAGE_COUNT
+#define BENCH_EKTL_FW_PAGE_COUNT       8
+#endif //BENCH_EKTL_FW_PAGE_COUNT
+
+// Row Count of Emulated FWID Mapping Table
+#ifndef BENCH_MAPPING_TABLE_ROW_COUNT
+#define BENCH_MAPPING_TABLE_ROW_COUNT  DEV_INFO_SET_MAX
+#endif //BENCH_MAPPING_TABLE_ROW_COUNT
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// Emulated HID Device:
+// Hidraw handle is replaced with one end of a SOCK_SEQPACKET socket pair,
+// so every write()/read() keeps the report boundary of a real hidraw node.
+class CEmuHIDLinuxGet: public CHIDLinuxGet
+{
+public:
+    CEmuHIDLinuxGet(char *pszLogDirPath, char *pszLogFileName) : CHIDLinuxGet(pszLogDirPath, pszLogFileName) {}
+    void AttachHandle(int nFd) { m_nHidrawFd = nFd; }
+};
+
+// Benchmark Function
+typedef int (*bench_func_t)(int iterations);
+
+// Benchmark Case
+struct bench_case
+{
+    const char *name;
+    bench_func_t func;
+    int iterations;
+};
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+// InterfaceGet Class
+CHIDLinuxGet *g_pIntfGet = NULL; // Pointer to HID Inteface Class (CHIDLinuxGet)
+
+// Emulated Device (Peer Side of Hidraw Handle)
+int g_emu_dev_fd = -1;
+
+// Work Directory & Temporary Files
+char g_work_dir[FILE_NAME_LENGTH_MAX] = BENCH_DEFAULT_WORK_DIR;
+char g_ektl_fw_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_mapping_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_ring_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_codec_ekt_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_codec_elz_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_codec_bad_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_bundle_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_bundle_bad_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+char g_log_file_name[FILE_NAME_LENGTH_MAX] = {0};
+
+// FWID Mapping File
+FILE *g_fd_mapping_file = NULL;
+
+// Benchmark Settings
+int g_repeat_count = BENCH_DEFAULT_REPEAT_COUNT;
+char g_bench_filter[FILE_NAME_LENGTH_MAX] = {0};
+
+// Help Info.
+bool g_help = false;
+
+// Parameter Option Settings
+const char* const short_options = "b:n:w:dh";
+const struct option long_options[] =
+{
+    { "bench",                   1, NULL, 'b'},
+    { "repeat",                  1, NULL, 'n'},
+    { "work_dir",                1, NULL, 'w'},
+    { "debug",                   0, NULL, 'd'},
+    { "help",                    0, NULL, 'h'},
+};
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// HID Raw I/O Function
+int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
+int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
+int __hidraw_read_report(unsigned char* buf, int buf_len, int *p_report_len, int timeout_ms);
+unsigned char __hidraw_get_output_report_id(void);
+
+// Abstract Device I/O Function
+int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+int read_data(unsigned char *data_buf, int len, int timeout_ms);
+int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+
+// Benchmarks
+int bench_write_raw_bytes(int iterations);
+int bench_read_raw_bytes(int iterations);
+int bench_write_frame_data(int iterations);
+int bench_create_firmware_page(int iterations);
+int bench_create_ektl_fw_page(int iterations);
+int bench_gen8_read_memory_page(int iterations);
+int bench_gen8_read_memory_block(int iterations);
+int bench_gen8_read_remark_id(int iterations);
+int bench_gen8_read_update_info(int iterations);
+int bench_validate_ektl_fw(int iterations);
+int bench_validate_ektl_fw_image(int iterations);
+int bench_get_ektl_erase_script(int iterations);
+int bench_plan_ektl_erase_script(int iterations);
+int bench_decompress_firmware_file(int iterations);
+int bench_extract_firmware_bundle_entry(int iterations);
+int bench_debug_print_buffer(int iterations);
+int bench_parse_fwid_mapping_file(int iterations);
+int bench_get_fwid_from_edid(int iterations);
+int bench_get_edid_from_sysfs(int iterations);
+int bench_parse_fwid_mapping_db(int iterations);
+int bench_get_fwid_from_mapping_db(int iterations);
+int bench_process_finger_report(int iterations);
+int bench_capture_report_to_ring(int iterations);
+int bench_get_firmware_info(int iterations);
+int bench_wait_rek_response(int iterations);
+
+// Help
+void show_help_information(void);
+
+// Default Function
+int process_parameter(int argc, char **argv);
+int resource_init(void);
+int resource_free(void);
+int main(int argc, char **argv);
+
+/*******************************************
+ * Benchmark Cases
+ ******************************************/
+
+const struct bench_case g_bench_cases[] =
+{
+    { "write_raw_bytes",            bench_write_raw_bytes,          20000 },
+    { "read_raw_bytes",             bench_read_raw_bytes,           20000 },
+    { "write_frame_data",           bench_write_frame_data,         20000 },
+    { "create_firmware_page",       bench_create_firmware_page,     200000 },
+    { "create_ektl_fw_page",        bench_create_ektl_fw_page,      20000 },
+    { "gen8_read_memory_page",      bench_gen8_read_memory_page,    50 },
+    { "gen8_read_memory_block",     bench_gen8_read_memory_block,   2000 },
+    { "gen8_read_remark_id",        bench_gen8_read_remark_id,      2000 },
+    { "gen8_read_update_info",      bench_gen8_read_update_info,    2000 },
+    { "validate_ektl_fw",           bench_validate_ektl_fw,         20000 },
+    { "validate_ektl_fw_image",     bench_validate_ektl_fw_image,   20000 },
+    { "get_ektl_erase_script",      bench_get_ektl_erase_script,    20000 },
+    { "plan_ektl_erase_script",     bench_plan_ektl_erase_script,   20000 },
+    { "decompress_firmware_file",   bench_decompress_firmware_file, 200 },
+    { "extract_firmware_bundle_entry", bench_extract_firmware_bundle_entry, 2000 },
+    { "debug_print_buffer",         bench_debug_print_buffer,       2000 },
+    { "parse_fwid_mapping_file",    bench_parse_fwid_mapping_file,  2000 },
+    { "get_fwid_from_edid",         bench_get_fwid_from_edid,       20000 },
+    { "get_edid_from_sysfs",        bench_get_edid_from_sysfs,      2000 },
+    { "parse_fwid_mapping_db",      bench_parse_fwid_mapping_db,    2000 },
+    { "get_fwid_from_mapping_db",   bench_get_fwid_from_mapping_db, 20000 },
+    { "process_finger_report",      bench_process_finger_report,    200000 },
+    { "capture_report_to_ring",     bench_capture_report_to_ring,   20000 },
+    { "get_firmware_info",          bench_get_firmware_info,        5000 },
+    { "wait_rek_response",          bench_wait_rek_response,        5000 },
+};
+
+/*******************************************
+ * HID Raw I/O Functions
+ ******************************************/
+
+int __hidraw_write(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_WRITE_EXIT;
+    }
+
+    nRet = g_pIntfGet->WriteRawBytes(buf, len, timeout_ms);
+
+__HIDRAW_WRITE_EXIT:
+    return nRet;
+}
+
+int __hidraw_read(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_READ_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadRawBytes(buf, len, timeout_ms);
+
+__HIDRAW_READ_EXIT:
+    return nRet;
+}
+
+int __hidraw_read_report(unsigned char* buf, int buf_len, int *p_report_len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_READ_REPORT_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadReport(buf, buf_len, p_report_len, timeout_ms);
+
+__HIDRAW_READ_REPORT_EXIT:
+    return nRet;
+}
+
+int __hidraw_write_command(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_WRITE_EXIT;
+    }
+
+    nRet = g_pIntfGet->WriteCommand(buf, len, timeout_ms);
+
+__HIDRAW_WRITE_EXIT:
+    return nRet;
+}
+
+int __hidraw_read_data(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_READ_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadData(buf, len, timeout_ms);
+
+__HIDRAW_READ_EXIT:
+    return nRet;
+}
+
+unsigned char __hidraw_get_output_report_id(void)
+{
+    if(g_pIntfGet == NULL)
+        return ELAN_HID_OUTPUT_REPORT_ID;
+
+    return g_pIntfGet->GetOutputReportId();
+}
+
+/***************************************************
+ * Abstract I/O Functions
+ ***************************************************/
+
+int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+{
+    return __hidraw_write_command(cmd_buf, len, timeout_ms);
+}
+
+int read_data(unsigned char *data_buf, int len, int timeout_ms)
+{
+    return __hidraw_read_data(data_buf, len, timeout_ms);
+}
+
+int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+{
+    unsigned char vendor_cmd_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+
+    // Add HID Header
+    vendor_cmd_buf[0] = ELAN_HID_OUTPUT_REPORT_ID;
+    memcpy(&vendor_cmd_buf[1], cmd_buf, len);
+
+    return __hidraw_write(vendor_cmd_buf, sizeof(vendor_cmd_buf), timeout_ms);
+}
+
+/*******************************************
+ * Emulated Device
+ ******************************************/
+
+// Drain One Output Report Written by Host
+static int emu_dev_drain_output_report(void)
+{
+    unsigned char report_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+
+    if(read(g_emu_dev_fd, report_buf, sizeof(report_buf)) != sizeof(report_buf))
+        return ERR_IO_ERROR;
+
+    return ERR_SUCCESS;
+}
+
+// Post One Input Report to Host
+static int emu_dev_post_input_report(unsigned char *p_report_buf, size_t report_buf_size)
+{
+    if(write(g_emu_dev_fd, p_report_buf, report_buf_size) != (ssize_t)report_buf_size)
+        return ERR_IO_ERROR;
+
+    return ERR_SUCCESS;
+}
+
+// Post Frames of One Bulk Read (Reversed Order if Requested) to Host, Data Filled with 0x5A if p_data is NULL
+static int emu_dev_post_bulk_rom_frames(unsigned int data_size, bool reverse, const unsigned char *p_data)
+{
+    int err = ERR_SUCCESS;
+    unsigned int frame_count = 0,
+                 frame_index = 0,
+                 post_index = 0,
+                 frame_data_len = 0;
+    unsigned char report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {0};
+
+    frame_count = (data_size / ELAN_HID_READ_PAGE_FRAME_SIZE) + ((data_size % ELAN_HID_READ_PAGE_FRAME_SIZE) != 0);
+    for(post_index = 0; post_index < frame_count; post_index++)
+    {
+        frame_index = (reverse) ? (frame_count - 1 - post_index) : post_index;
+        frame_data_len = (frame_index == (frame_count - 1)) ? (data_size - frame_index * ELAN_HID_READ_PAGE_FRAME_SIZE) : ELAN_HID_READ_PAGE_FRAME_SIZE;
+
+        memset(report_buf, 0x5A, sizeof(report_buf));
+        report_buf[0] = ELAN_HID_INPUT_REPORT_ID;
+        report_buf[1] = 3 + frame_data_len;
+        report_buf[2] = 0x99;                           // Packet Header
+        report_buf[3] = (unsigned char)frame_index;     // Packet Index
+        report_buf[4] = (unsigned char)frame_data_len;  // Data Length
+        if(p_data != NULL)
+            memcpy(&report_buf[5], &p_data[frame_index * ELAN_HID_READ_PAGE_FRAME_SIZE], frame_data_len);
+        err = emu_dev_post_input_report(report_buf, sizeof(report_buf));
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+/*******************************************
+ * Benchmarks
+ ******************************************/
+
+int bench_write_raw_bytes(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char cmd_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {ELAN_HID_OUTPUT_REPORT_ID, 0x04, 0x53, 0xf0, 0x00, 0x01};
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = __hidraw_write(cmd_buf, sizeof(cmd_buf), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_read_raw_bytes(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_INPUT_REPORT_ID, 0x04, 0x52, 0xf0, 0x12, 0x34},
+                  data_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {0};
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = emu_dev_post_input_report(report_buf, sizeof(report_buf));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = __hidraw_read(data_buf, sizeof(data_buf), ELAN_READ_DATA_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_write_frame_data(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0,
+        data_offset = 0;
+    unsigned char frame_buf[ELAN_HID_PAGE_FRAME_SIZE] = {0};
+
+    memset(frame_buf, 0x5A, sizeof(frame_buf));
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = write_frame_data(data_offset, sizeof(frame_buf), frame_buf, sizeof(frame_buf));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+
+        // Walk through all frame offsets of a 30-page block
+        data_offset += ELAN_HID_PAGE_FRAME_SIZE;
+        if(data_offset >= (ELAN_FIRMWARE_PAGE_SIZE * 30))
+            data_offset = 0;
+    }
+
+    return err;
+}
+
+int bench_create_firmware_page(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char page_data_buf[ELAN_FIRMWARE_PAGE_DATA_SIZE] = {0},
+                  page_buf[ELAN_FIRMWARE_PAGE_SIZE] = {0};
+
+    for(index = 0; index < (int)sizeof(page_data_buf); index++)
+        page_data_buf[index] = (unsigned char)(index * 7);
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = create_firmware_page(ELAN_INFO_MEMORY_PAGE_1_ADDR, page_data_buf, sizeof(page_data_buf), page_buf, sizeof(page_buf));
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_create_ektl_fw_page(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char page_data_buf[ELAN_EKTL_FW_PAGE_DATA_SIZE] = {0},
+                  page_buf[ELAN_EKTL_FW_PAGE_SIZE] = {0};
+
+    for(index = 0; index < (int)sizeof(page_data_buf); index++)
+        page_data_buf[index] = (unsigned char)(index * 7);
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = create_ektl_fw_page(ELAN_GEN8_INFO_MEMORY_PAGE_3_ADDR, page_data_buf, sizeof(page_data_buf), page_buf, sizeof(page_buf));
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_gen8_read_memory_page(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char mem_page_buf[ELAN_GEN8_MEMORY_PAGE_SIZE] = {0};
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = emu_dev_post_bulk_rom_frames(ELAN_GEN8_MEMORY_PAGE_SIZE, false, NULL);
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = gen8_read_memory_page(0, ELAN_GEN8_MEMORY_PAGE_SIZE, mem_page_buf, sizeof(mem_page_buf));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_gen8_read_memory_block(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char mem_block_buf[ELAN_GEN8_MEMORY_BLOCK_SIZE] = {0};
+
+    for(index = 0; index < iterations; index++)
+    {
+        // Reversed frames are reassembled by packet index
+        err = emu_dev_post_bulk_rom_frames(ELAN_GEN8_MEMORY_BLOCK_SIZE, true, NULL);
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = gen8_read_memory_block(0, ELAN_GEN8_MEMORY_BLOCK_SIZE, mem_block_buf, sizeof(mem_block_buf));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_gen8_read_remark_id(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0,
+        report_index = 0;
+    unsigned char region_buf[ELAN_GEN8_REMARK_ID_REGION_SIZE] = {0},
+                  remark_id_buf[ELAN_GEN8_REMARK_ID_LEN] = {0};
+
+    // Remark ID Index: Address Set 1
+    memset(region_buf, 0x5A, sizeof(region_buf));
+    region_buf[0] = 0xFE;
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = emu_dev_post_bulk_rom_frames(sizeof(region_buf), false, region_buf);
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = gen8_read_remark_id(remark_id_buf, sizeof(remark_id_buf), false);
+        if(err != ERR_SUCCESS)
+            break;
+
+        // Enter Test Mode, Show Bulk ROM Data & Exit Test Mode
+        for(report_index = 0; (report_index < 3) && (err == ERR_SUCCESS); report_index++)
+            err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_gen8_read_update_info(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0,
+        report_index = 0;
+    struct update_info update_info;
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = emu_dev_post_bulk_rom_frames(ELAN_GEN8_UPDATE_INFO_SIZE, false, NULL);
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = gen8_read_update_info(&update_info, sizeof(update_info));
+        if(err != ERR_SUCCESS)
+            break;
+
+        // Enter Test Mode, Show Bulk ROM Data & Exit Test Mode
+        for(report_index = 0; (report_index < 3) && (err == ERR_SUCCESS); report_index++)
+            err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_validate_ektl_fw(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    bool is_ektl_fw = false;
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = validate_ektl_fw(&is_ektl_fw);
+        if(err != ERR_SUCCESS)
+            break;
+
+        if(is_ektl_fw == false)
+        {
+            err = ERR_DATA_PATTERN;
+            break;
+        }
+    }
+
+    return err;
+}
+
+// Main Code of eKTL Firmware is below Information ROM (Bulk Read Window), so Verification must be Refused before Update
+static int check_ektl_fw_verifiable(void)
+{
+    int err = ERR_SUCCESS;
+
+    err = check_flash_pages_verifiable<ts_gen8_traits>();
+    if(err != ERR_FUNC_NOT_SUPPORT)
+    {
+        ERROR_PRINTF("%s: err=0x%x, err=0x%x Expected!\r\n", __func__, err, ERR_FUNC_NOT_SUPPORT);
+        return ERR_DATA_MISMATCHED;
+    }
+
+    return ERR_SUCCESS;
+}
+
+int bench_validate_ektl_fw_image(int iterations)
+{
+    static bool verifiable_checked = false; // Checked Once, not Timed in Every Repeat
+    int err = ERR_SUCCESS,
+        index = 0;
+
+    if(verifiable_checked == false)
+    {
+        err = check_ektl_fw_verifiable();
+        if(err != ERR_SUCCESS)
+            return err;
+        verifiable_checked = true;
+    }
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = validate_ektl_fw_image();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_get_ektl_erase_script(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    struct erase_script EraseScript;
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = get_ektl_erase_script(&EraseScript, sizeof(struct erase_script));
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+// Plan of Synthetic Erase Script: Adjacent / Contained Sections Merged within ELAN_GEN8_ERASE_PAGE_COUNT_MAX, No Section Split
+static int check_ektl_erase_plan(void)
+{
+    int err = ERR_SUCCESS;
+    unsigned int index = 0;
+    const struct erase_section input_section[] =
+    {
+        { 300 * ELAN_EKTL_FW_PAGE_DATA_SIZE, 200 },     // Larger than Max. => One Command
+        {  32 * ELAN_EKTL_FW_PAGE_DATA_SIZE,  32 },     // Adjacent to 0      => Merged (64)
+        {   0 * ELAN_EKTL_FW_PAGE_DATA_SIZE,  32 },
+        { 500 * ELAN_EKTL_FW_PAGE_DATA_SIZE,   4 },     // Adjacent to 300, Range over Max. => Own Command
+        {  40 * ELAN_EKTL_FW_PAGE_DATA_SIZE,   8 },     // Contained          => Absorbed
+        {  64 * ELAN_EKTL_FW_PAGE_DATA_SIZE, 100 },     // Adjacent, 164 > Max. => Own Command
+        { 900 * ELAN_EKTL_FW_PAGE_DATA_SIZE,   0 },     // Empty              => Dropped
+    };
+    const struct erase_section expected_section[] =
+    {
+        {   0 * ELAN_EKTL_FW_PAGE_DATA_SIZE,  64 },
+        {  64 * ELAN_EKTL_FW_PAGE_DATA_SIZE, 100 },
+        { 300 * ELAN_EKTL_FW_PAGE_DATA_SIZE, 200 },
+        { 500 * ELAN_EKTL_FW_PAGE_DATA_SIZE,   4 },
+    };
+    struct erase_script EraseScript,
+                        ErasePlan;
+
+    memset(&EraseScript, 0, sizeof(struct erase_script));
+    EraseScript.nEraseSectionCount = sizeof(input_section) / sizeof(input_section[0]);
+    memcpy(EraseScript.EraseSection, input_section, sizeof(input_section));
+
+    err = plan_ektl_erase_script(&EraseScript, ELAN_GEN8_ERASE_PAGE_COUNT_MAX, &ErasePlan, sizeof(struct erase_script));
+    if(err != ERR_SUCCESS)
+        return err;
+
+    if(ErasePlan.nEraseSectionCount != (sizeof(expected_section) / sizeof(expected_section[0])))
+    {
+        ERROR_PRINTF("%s: %u Erase Commands Planned, %lu Expected!\r\n", __func__, ErasePlan.nEraseSectionCount, (unsigned long)(sizeof(expected_section) / sizeof(expected_section[0])));
+        return ERR_DATA_MISMATCHED;
+    }
+    for(index = 0; index < ErasePlan.nEraseSectionCount; index++)
+    {
+        if((ErasePlan.EraseSection[index].address != expected_section[index].address) || \
+           (ErasePlan.EraseSection[index].page_count != expected_section[index].page_count))
+        {
+            ERROR_PRINTF("%s: Erase Command [%u] (0x%08x, %u Pages), (0x%08x, %u Pages) Expected!\r\n", __func__, index, \
+                         ErasePlan.EraseSection[index].address, ErasePlan.EraseSection[index].page_count, \
+                         expected_section[index].address, expected_section[index].page_count);
+            return ERR_DATA_MISMATCHED;
+        }
+    }
+
+    return ERR_SUCCESS;
+}
+
+int bench_plan_ektl_erase_script(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    struct erase_script EraseScript,
+                        ErasePlan;
+
+    err = check_ektl_erase_plan();
+    if(err != ERR_SUCCESS)
+        return err;
+
+    err = get_ektl_erase_script(&EraseScript, sizeof(struct erase_script));
+    if(err != ERR_SUCCESS)
+        return err;
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = plan_ektl_erase_script(&EraseScript, ELAN_GEN8_ERASE_PAGE_COUNT_MAX, &ErasePlan, sizeof(struct erase_script));
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+// Write Whole Buffer to File (Codec Test Images)
+static int write_bench_file(const char *p_file_path, const unsigned char *p_data, size_t data_size)
+{
+    int err = ERR_SUCCESS;
+    FILE *fd = NULL;
+
+    fd = fopen(p_file_path, "wb");
+    if(fd == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to create \"%s\"!\r\n", __func__, p_file_path);
+        return ERR_FILE_IO_ERROR;
+    }
+    if(fwrite(p_data, 1, data_size, fd) != data_size)
+        err = ERR_FILE_IO_ERROR;
+    fclose(fd);
+
+    return err;
+}
+
+// Decompress Image File, Expecting expected_err
+static int check_decompress_result(const char *p_file_path, int expected_err)
+{
+    int err = ERR_SUCCESS,
+        fd = -1,
+        raw_fd = -1,
+        raw_size = 0;
+
+    fd = open(p_file_path, O_RDONLY);
+    if(fd < 0)
+        return ERR_FILE_NOT_FOUND;
+    err = decompress_firmware_file(fd, &raw_fd, &raw_size);
+    close(fd);
+    if(raw_fd >= 0)
+        close(raw_fd);
+
+    if(err != expected_err)
+    {
+        ERROR_PRINTF("%s: \"%s\" Decompressed with err=0x%x, err=0x%x Expected!\r\n", __func__, p_file_path, err, expected_err);
+        return ERR_DATA_MISMATCHED;
+    }
+
+    return ERR_SUCCESS;
+}
+
+// Codec Round Trip: Source Image of Random Block (Stored) & eKTL Pages (Compressed) is Compressed to p_elz_file_path,
+// whose Blocks must Include Both Kinds, and Opened as Firmware File ("-f") must Give Back Same Bytes as Source.
+// Truncated Image & Image with Bad Checksum must be Rejected.
+static int check_firmware_codec(const char *p_ekt_file_path, const char *p_elz_file_path, const char *p_bad_file_path)
+{
+    int err = ERR_SUCCESS,
+        ektl_fw_size = 0,
+        firmware_size = 0,
+        fd = -1,
+        elz_size = 0,
+        stored_count = 0,
+        compressed_count = 0;
+    unsigned int random_seed = 1,
+                 block_len = 0,
+                 data_index = 0,
+                 elz_offset = 0;
+    const unsigned int src_size = (ELAN_FW_COMPRESS_BLOCK_SIZE * 2) + 0x800;
+    unsigned char *p_src = NULL,
+                  *p_elz = NULL,
+                  *p_ektl_fw_data = NULL,
+                  *p_firmware_data = NULL;
+    struct stat file_stat;
+
+    p_src = (unsigned char *)malloc(src_size);
+    if(p_src == NULL)
+        return ERR_NO_MEMORY;
+
+    // Source Image: Block 0 Random, Rest Repeated eKTL Firmware
+    for(data_index = 0; data_index < ELAN_FW_COMPRESS_BLOCK_SIZE; data_index++)
+    {
+        random_seed = (random_seed * 1103515245) + 12345;
+        p_src[data_index] = (unsigned char)(random_seed >> 16);
+    }
+    err = map_firmware_file(&p_ektl_fw_data, &ektl_fw_size);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+    for(data_index = ELAN_FW_COMPRESS_BLOCK_SIZE; data_index < src_size; data_index++)
+        p_src[data_index] = p_ektl_fw_data[data_index % ektl_fw_size];
+    unmap_firmware_file(p_ektl_fw_data, ektl_fw_size);
+
+    err = write_bench_file(p_ekt_file_path, p_src, src_size);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+    err = compress_firmware_file(p_ekt_file_path, p_elz_file_path, SILENT_MODE);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+
+    // Load Compressed Image
+    fd = open(p_elz_file_path, O_RDONLY);
+    if((fd < 0) || (fstat(fd, &file_stat) < 0) || (file_stat.st_size <= ELAN_FW_COMPRESS_HEADER_SIZE))
+    {
+        err = ERR_FILE_IO_ERROR;
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+    }
+    elz_size = (int)file_stat.st_size;
+    p_elz = (unsigned char *)malloc(elz_size);
+    if(p_elz == NULL)
+    {
+        err = ERR_NO_MEMORY;
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+    }
+    if(read(fd, p_elz, elz_size) != elz_size)
+    {
+        err = ERR_FILE_IO_ERROR;
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+    }
+
+    // Block Kinds
+    for(elz_offset = ELAN_FW_COMPRESS_HEADER_SIZE; (elz_offset + 4) <= (unsigned int)elz_size; elz_offset += 4 + block_len)
+    {
+        block_len = p_elz[elz_offset] | (p_elz[elz_offset + 1] << 8) | (p_elz[elz_offset + 2] << 16) | ((unsigned int)p_elz[elz_offset + 3] << 24);
+        if((block_len & ELAN_FW_COMPRESS_STORED_FLAG) != 0)
+            stored_count++;
+        else
+            compressed_count++;
+        block_len &= ~ELAN_FW_COMPRESS_STORED_FLAG;
+    }
+    if((stored_count == 0) || (compressed_count == 0))
+    {
+        ERROR_PRINTF("%s: %d Stored & %d Compressed Blocks, Both Kinds Expected!\r\n", __func__, stored_count, compressed_count);
+        err = ERR_DATA_MISMATCHED;
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+    }
+
+    // "-f" with Compressed Image: Same Bytes as Source Image
+    close_firmware_file();
+    err = open_firmware_file((char *)p_elz_file_path, strlen(p_elz_file_path));
+    if(err == ERR_SUCCESS)
+    {
+        err = map_firmware_file(&p_firmware_data, &firmware_size);
+        if(err == ERR_SUCCESS)
+        {
+            if((firmware_size != (int)src_size) || (memcmp(p_firmware_data, p_src, src_size) != 0))
+            {
+                ERROR_PRINTF("%s: Firmware of \"%s\" (%d Bytes) Differs from \"%s\" (%u Bytes)!\r\n", __func__, p_elz_file_path, firmware_size, p_ekt_file_path, src_size);
+                err = ERR_DATA_MISMATCHED;
+            }
+            unmap_firmware_file(p_firmware_data, firmware_size);
+        }
+        close_firmware_file();
+    }
+    if(open_firmware_file(g_ektl_fw_file_path, strlen(g_ektl_fw_file_path)) != ERR_SUCCESS) // Restore eKTL Firmware of Other Cases
+        err = ERR_FILE_NOT_FOUND;
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+
+    // Truncated Stream
+    err = write_bench_file(p_bad_file_path, p_elz, elz_size - 0x100);
+    if(err == ERR_SUCCESS)
+        err = check_decompress_result(p_bad_file_path, ERR_DATA_PATTERN);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_CODEC_EXIT;
+
+    // Bad Checksum
+    p_elz[12] ^= 0x01;
+    err = write_bench_file(p_bad_file_path, p_elz, elz_size);
+    if(err == ERR_SUCCESS)
+        err = check_decompress_result(p_bad_file_path, ERR_DATA_PATTERN);
+
+CHECK_FIRMWARE_CODEC_EXIT:
+    if(fd >= 0)
+        close(fd);
+    unlink(p_bad_file_path);
+    free(p_elz);
+    free(p_src);
+    return err;
+}
+
+int bench_decompress_firmware_file(int iterations)
+{
+    static bool codec_checked = false; // Round Trip Checked Once, not Timed in Every Repeat
+    int err = ERR_SUCCESS,
+        index = 0,
+        fd = -1,
+        raw_fd = -1,
+        raw_size = 0;
+
+    if(codec_checked == false)
+    {
+        err = check_firmware_codec(g_codec_ekt_file_path, g_codec_elz_file_path, g_codec_bad_file_path);
+        if(err != ERR_SUCCESS)
+            goto BENCH_DECOMPRESS_FIRMWARE_FILE_EXIT;
+        codec_checked = true;
+    }
+
+    fd = open(g_codec_elz_file_path, O_RDONLY);
+    if(fd < 0)
+    {
+        err = ERR_FILE_NOT_FOUND;
+        goto BENCH_DECOMPRESS_FIRMWARE_FILE_EXIT;
+    }
+    for(index = 0; index < iterations; index++)
+    {
+        err = decompress_firmware_file(fd, &raw_fd, &raw_size);
+        if(err != ERR_SUCCESS)
+            break;
+        close(raw_fd);
+    }
+    close(fd);
+
+BENCH_DECOMPRESS_FIRMWARE_FILE_EXIT:
+    if(err != ERR_SUCCESS)
+        codec_checked = false;
+    return err;
+}
+
+// Read Whole File into Allocated Buffer (Bundle Test Images)
+static int read_bench_file(const char *p_file_path, unsigned char **pp_data, int *p_data_size)
+{
+    int fd = -1;
+    struct stat file_stat;
+
+    *pp_data = NULL;
+    fd = open(p_file_path, O_RDONLY);
+    if(fd < 0)
+        return ERR_FILE_NOT_FOUND;
+    if((fstat(fd, &file_stat) < 0) || (file_stat.st_size <= 0))
+    {
+        close(fd);
+        return ERR_FILE_IO_ERROR;
+    }
+    *p_data_size = (int)file_stat.st_size;
+    *pp_data = (unsigned char *)malloc(*p_data_size);
+    if(*pp_data == NULL)
+    {
+        close(fd);
+        return ERR_NO_MEMORY;
+    }
+    if(pread(fd, *pp_data, *p_data_size, 0) != *p_data_size)
+    {
+        free(*pp_data);
+        *pp_data = NULL;
+        close(fd);
+        return ERR_FILE_IO_ERROR;
+    }
+    close(fd);
+
+    return ERR_SUCCESS;
+}
+
+// Select (FWID, Generation) from Bundle, Expecting expected_err, or Image Same as p_source_file_path on Success
+static int check_bundle_entry(const char *p_bundle_file_path, unsigned short fwid, int generation, int expected_err, const char *p_source_file_path)
+{
+    int err = ERR_SUCCESS,
+        image_fd = -1,
+        source_size = 0;
+    unsigned char *p_source = NULL,
+                  *p_image = NULL;
+    struct stat file_stat;
+
+    err = extract_firmware_bundle_entry(p_bundle_file_path, fwid, generation, &image_fd);
+    if(err != expected_err)
+    {
+        ERROR_PRINTF("%s: FWID 0x%04x (Gen%d) of \"%s\" Selected with err=0x%x, err=0x%x Expected!\r\n", __func__, fwid, generation, p_bundle_file_path, err, expected_err);
+        err = ERR_DATA_MISMATCHED;
+        goto CHECK_BUNDLE_ENTRY_EXIT;
+    }
+    err = ERR_SUCCESS;
+    if(image_fd < 0)
+        goto CHECK_BUNDLE_ENTRY_EXIT;
+
+    // Image Same as Source
+    err = read_bench_file(p_source_file_path, &p_source, &source_size);
+    if(err != ERR_SUCCESS)
+        goto CHECK_BUNDLE_ENTRY_EXIT;
+    if((fstat(image_fd, &file_stat) < 0) || (file_stat.st_size != source_size))
+    {
+        ERROR_PRINTF("%s: Image of FWID 0x%04x (Gen%d) is not %d Bytes of \"%s\"!\r\n", __func__, fwid, generation, source_size, p_source_file_path);
+        err = ERR_DATA_MISMATCHED;
+        goto CHECK_BUNDLE_ENTRY_EXIT;
+    }
+    p_image = (unsigned char *)malloc(source_size);
+    if(p_image == NULL)
+    {
+        err = ERR_NO_MEMORY;
+        goto CHECK_BUNDLE_ENTRY_EXIT;
+    }
+    if((pread(image_fd, p_image, source_size, 0) != source_size) || (memcmp(p_image, p_source, source_size) != 0))
+    {
+        ERROR_PRINTF("%s: Image of FWID 0x%04x (Gen%d) Differs from \"%s\"!\r\n", __func__, fwid, generation, p_source_file_path);
+        err = ERR_DATA_MISMATCHED;
+    }
+
+CHECK_BUNDLE_ENTRY_EXIT:
+    if(image_fd >= 0)
+        close(image_fd);
+    free(p_image);
+    free(p_source);
+    return err;
+}
+
+// Patch Index Entry of Bundle Image (Offset, Size & Image Checksum) and Update Index Checksum, so Only Range Check of Entry can Fail
+static void patch_bundle_entry(unsigned char *p_bundle, int entry_index, unsigned int offset, unsigned int size, unsigned int checksum)
+{
+    unsigned int entry_count = p_bundle[4] | (p_bundle[5] << 8) | (p_bundle[6] << 16) | ((unsigned int)p_bundle[7] << 24),
+                 index_checksum = 0,
+                 byte_index = 0;
+    unsigned char *p_entry = &p_bundle[ELAN_FW_BUNDLE_HEADER_SIZE + entry_index * ELAN_FW_BUNDLE_ENTRY_SIZE];
+
+    for(byte_index = 0; byte_index < 4; byte_index++)
+    {
+        p_entry[4 + byte_index] = (unsigned char)((offset >> (byte_index * 8)) & 0xFF);
+        p_entry[8 + byte_index] = (unsigned char)((size >> (byte_index * 8)) & 0xFF);
+        p_entry[12 + byte_index] = (unsigned char)((checksum >> (byte_index * 8)) & 0xFF);
+    }
+    index_checksum = compute_firmware_checksum(&p_bundle[ELAN_FW_BUNDLE_HEADER_SIZE], entry_count * ELAN_FW_BUNDLE_ENTRY_SIZE);
+    for(byte_index = 0; byte_index < 4; byte_index++)
+        p_bundle[8 + byte_index] = (unsigned char)((index_checksum >> (byte_index * 8)) & 0xFF);
+}
+
+// Bundle Round Trip: Every Image Selected by (FWID, Generation) is Same as Its Source.
+// Missing FWID & Wrong Generation are Not Found, Duplicate Entries are Refused at Creation,
+// and Bundles with Corrupt Index Checksum or Out-of-range Entry Offset / Size are Rejected.
+static int check_firmware_bundle(const char *p_bundle_file_path, const char *p_bad_file_path)
+{
+    int err = ERR_SUCCESS,
+        source_index = 0,
+        bundle_size = 0;
+    unsigned int image_offset = 0;
+    unsigned char *p_bundle = NULL,
+                  range_data[0x20] = {0};   // Bytes an Out-of-range Entry would Cover (Zero beyond End of Bundle)
+    const struct fw_bundle_source source[] =
+    {
+        { 0x3001, ELAN_TS_GEN_8, g_ektl_fw_file_path },
+        { 0x3001, ELAN_TS_GEN_5, g_mapping_file_path },     // Same FWID, Other Generation
+        { 0x2002, ELAN_TS_GEN_8, g_mapping_file_path },
+    };
+    const struct fw_bundle_source duplicate_source[] =
+    {
+        { 0x3001, ELAN_TS_GEN_8, g_ektl_fw_file_path },
+        { 0x3001, ELAN_TS_GEN_8, g_mapping_file_path },
+    };
+
+    err = create_firmware_bundle(p_bundle_file_path, source, sizeof(source) / sizeof(source[0]), SILENT_MODE);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+
+    // Round Trip
+    for(source_index = 0; source_index < (int)(sizeof(source) / sizeof(source[0])); source_index++)
+    {
+        err = check_bundle_entry(p_bundle_file_path, source[source_index].fwid, source[source_index].generation, ERR_SUCCESS, source[source_index].p_filename);
+        if(err != ERR_SUCCESS)
+            goto CHECK_FIRMWARE_BUNDLE_EXIT;
+    }
+
+    // Missing FWID & Wrong Generation
+    err = check_bundle_entry(p_bundle_file_path, 0x7777, ELAN_TS_GEN_8, ERR_FILE_NOT_FOUND, NULL);
+    if(err == ERR_SUCCESS)
+        err = check_bundle_entry(p_bundle_file_path, 0x2002, ELAN_TS_GEN_5, ERR_FILE_NOT_FOUND, NULL);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+
+    // Duplicate Entries
+    err = create_firmware_bundle(p_bad_file_path, duplicate_source, sizeof(duplicate_source) / sizeof(duplicate_source[0]), SILENT_MODE);
+    if(err != ERR_INVALID_PARAM)
+    {
+        ERROR_PRINTF("%s: Bundle with Duplicate Entries Created with err=0x%x, err=0x%x Expected!\r\n", __func__, err, ERR_INVALID_PARAM);
+        err = ERR_DATA_MISMATCHED;
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+    }
+
+    // Corrupt Index Checksum (Index Intact)
+    err = read_bench_file(p_bundle_file_path, &p_bundle, &bundle_size);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+    p_bundle[8] ^= 0x01;
+    err = write_bench_file(p_bad_file_path, p_bundle, bundle_size);
+    if(err == ERR_SUCCESS)
+        err = check_bundle_entry(p_bad_file_path, 0x3001, ELAN_TS_GEN_8, ERR_DATA_PATTERN, NULL);
+    p_bundle[8] ^= 0x01;
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+
+    // Out-of-range Entry Offset (past End of Bundle / inside Index) & Size (past End of Bundle).
+    // Image Checksum of Entry Matches Bytes the Entry Covers, so Range Check Alone must Reject It.
+    image_offset = ELAN_FW_BUNDLE_HEADER_SIZE + (sizeof(source) / sizeof(source[0])) * ELAN_FW_BUNDLE_ENTRY_SIZE;
+    patch_bundle_entry(p_bundle, 0, bundle_size + 0x10, 0x10, compute_firmware_checksum(range_data, 0x10));
+    err = write_bench_file(p_bad_file_path, p_bundle, bundle_size);
+    if(err == ERR_SUCCESS)
+        err = check_bundle_entry(p_bad_file_path, 0x3001, ELAN_TS_GEN_8, ERR_DATA_PATTERN, NULL);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+
+    patch_bundle_entry(p_bundle, 0, image_offset - ELAN_FW_BUNDLE_ENTRY_SIZE, ELAN_FW_BUNDLE_ENTRY_SIZE, \
+                       compute_firmware_checksum(&p_bundle[image_offset - ELAN_FW_BUNDLE_ENTRY_SIZE], ELAN_FW_BUNDLE_ENTRY_SIZE));
+    err = write_bench_file(p_bad_file_path, p_bundle, bundle_size);
+    if(err == ERR_SUCCESS)
+        err = check_bundle_entry(p_bad_file_path, 0x3001, ELAN_TS_GEN_8, ERR_DATA_PATTERN, NULL);
+    if(err != ERR_SUCCESS)
+        goto CHECK_FIRMWARE_BUNDLE_EXIT;
+
+    memcpy(range_data, &p_bundle[bundle_size - 0x10], 0x10);
+    patch_bundle_entry(p_bundle, 0, bundle_size - 0x10, sizeof(range_data), compute_firmware_checksum(range_data, sizeof(range_data)));
+    err = write_bench_file(p_bad_file_path, p_bundle, bundle_size);
+    if(err == ERR_SUCCESS)
+        err = check_bundle_entry(p_bad_file_path, 0x3001, ELAN_TS_GEN_8, ERR_DATA_PATTERN, NULL);
+
+CHECK_FIRMWARE_BUNDLE_EXIT:
+    unlink(p_bad_file_path);
+    free(p_bundle);
+    return err;
+}
+
+int bench_extract_firmware_bundle_entry(int iterations)
+{
+    static bool bundle_checked = false; // Round Trip Checked Once, not Timed in Every Repeat
+    int err = ERR_SUCCESS,
+        index = 0,
+        image_fd = -1;
+
+    if(bundle_checked == false)
+    {
+        err = check_firmware_bundle(g_bundle_file_path, g_bundle_bad_file_path);
+        if(err != ERR_SUCCESS)
+            return err;
+        bundle_checked = true;
+    }
+
+    for(index = 0; index < iterations; index++)
+    {
+        err = extract_firmware_bundle_entry(g_bundle_file_path, 0x2002, ELAN_TS_GEN_8, &image_fd);
+        if(err != ERR_SUCCESS)
+            break;
+        close(image_fd);
+    }
+
+    return err;
+}
+
+int bench_debug_print_buffer(int iterations)
+{
+    int index = 0;
+    unsigned char report_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+
+    for(index = 0; index < (int)sizeof(report_buf); index++)
+        report_buf[index] = (unsigned char)index;
+
+    for(index = 0; index < iterations; index++)
+        g_pIntfGet->DebugPrintBuffer("m_outBuf", report_buf, sizeof(report_buf));
+
+    return ERR_SUCCESS;
+}
+
+int bench_parse_fwid_mapping_file(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    struct lcm_dev_info lcm_panel_info[DEV_INFO_SET_MAX];
+
+    for(index = 0; index < iterations; index++)
+    {
+        memset(lcm_panel_info, 0, sizeof(lcm_panel_info));
+        rewind(g_fd_mapping_file);
+
+        err = parse_fwid_mapping_file(g_fd_mapping_file, lcm_panel_info, sizeof(lcm_panel_info));
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_get_fwid_from_edid(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned short fwid = 0;
+    struct lcm_dev_info lcm_panel_info[DEV_INFO_SET_MAX];
+
+    memset(lcm_panel_info, 0, sizeof(lcm_panel_info));
+    rewind(g_fd_mapping_file);
+    err = parse_fwid_mapping_file(g_fd_mapping_file, lcm_panel_info, sizeof(lcm_panel_info));
+    if(err != ERR_SUCCESS)
+        goto BENCH_GET_FWID_FROM_EDID_EXIT;
+
+    for(index = 0; index < iterations; index++)
+    {
+        // Look up the last row, which is the worst case of a linear scan
+        err = get_fwid_from_edid(lcm_panel_info, sizeof(lcm_panel_info), 0x06af, (unsigned short)(0x1000 + BENCH_MAPPING_TABLE_ROW_COUNT - 2), CHROME, &fwid);
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+BENCH_GET_FWID_FROM_EDID_EXIT:
+    return err;
+}
+
+// Write EDID Base Block of Emulated DRM Connector (${drm_root}/<connector>/edid)
+static int create_edid_file(const char *p_drm_root, const char *p_connector_name, const unsigned char *p_header, unsigned short manufacturer_code, unsigned short product_code)
+{
+    char file_path[FILE_NAME_LENGTH_MAX * 4] = {0};
+    unsigned char edid[EDID_BLOCK_SIZE] = {0};
+    FILE *fd = NULL;
+
+    snprintf(file_path, sizeof(file_path), "%s/%s", p_drm_root, p_connector_name);
+    mkdir(file_path, 0755);
+    snprintf(file_path, sizeof(file_path), "%s/%s/edid", p_drm_root, p_connector_name);
+
+    memcpy(edid, p_header, 8);
+    edid[8] = (unsigned char)(manufacturer_code >> 8);
+    edid[9] = (unsigned char)(manufacturer_code & 0xFF);
+    edid[10] = (unsigned char)(product_code >> 8);
+    edid[11] = (unsigned char)(product_code & 0xFF);
+
+    fd = fopen(file_path, "wb");
+    if(fd == NULL)
+        return ERR_FILE_IO_ERROR;
+    fwrite(edid, 1, sizeof(edid), fd);
+    fclose(fd);
+
+    return ERR_SUCCESS;
+}
+
+static void remove_edid_file(const char *p_drm_root, const char *p_connector_name)
+{
+    char file_path[FILE_NAME_LENGTH_MAX * 4] = {0};
+
+    snprintf(file_path, sizeof(file_path), "%s/%s/edid", p_drm_root, p_connector_name);
+    unlink(file_path);
+    snprintf(file_path, sizeof(file_path), "%s/%s", p_drm_root, p_connector_name);
+    rmdir(file_path);
+}
+
+int bench_get_edid_from_sysfs(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0,
+        panel_index = 0;
+    unsigned short manufacturer_code = 0,
+                   product_code = 0;
+    char drm_root[FILE_NAME_LENGTH_MAX * 2] = {0};
+    const unsigned char standard_header[8] = {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+                        panel_headers[2][8] =
+                        {
+                            {0xb3, 0x6f, 0x02, 0x00, 0xb0, 0x04, 0xec, 0x04},  // AUO
+                            {0xac, 0x70, 0x02, 0x00, 0xb0, 0x04, 0x00, 0x05},  // BOE
+                        };
+
+    // Built-in Panel with AUO / BOE Blob & External Monitor with Standard EDID:
+    // Panel Blob must be Accepted, so Built-in Panel Wins.
+    snprintf(drm_root, sizeof(drm_root), "%s/hid_bench_%d_drm", g_work_dir, (int)getpid());
+    mkdir(drm_root, 0755);
+    err = set_drm_sysfs_root(drm_root);
+    if(err != ERR_SUCCESS)
+        goto BENCH_GET_EDID_FROM_SYSFS_EXIT;
+
+    for(panel_index = 0; panel_index < 2; panel_index++)
+    {
+        err = create_edid_file(drm_root, "card0-eDP-1", panel_headers[panel_index], 0x06af, (unsigned short)(0x3d31 + panel_index));
+        if(err == ERR_SUCCESS)
+            err = create_edid_file(drm_root, "card0-HDMI-A-1", standard_header, 0x4c2d, 0x0f01);
+        if(err != ERR_SUCCESS)
+            break;
+
+        for(index = 0; index < iterations; index++)
+        {
+            err = get_edid_manufacturer_product_code_from_sysfs(&manufacturer_code, &product_code);
+            if(err != ERR_SUCCESS)
+                break;
+            if((manufacturer_code != 0x06af) || (product_code != (unsigned short)(0x3d31 + panel_index)))
+            {
+                ERROR_PRINTF("%s: EDID %04x.%04x Read, Built-in Panel 06af.%04x Expected!\r\n", __func__, manufacturer_code, product_code, 0x3d31 + panel_index);
+                err = ERR_DATA_MISMATCHED;
+                break;
+            }
+        }
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    remove_edid_file(drm_root, "card0-eDP-1");
+    remove_edid_file(drm_root, "card0-HDMI-A-1");
+    rmdir(drm_root);
+    set_drm_sysfs_root(DRM_SYSFS_ROOT);
+
+BENCH_GET_EDID_FROM_SYSFS_EXIT:
+    return err;
+}
+
+int bench_parse_fwid_mapping_db(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    struct fwid_mapping_db fwid_mapping_db;
+
+    for(index = 0; index < iterations; index++)
+    {
+        rewind(g_fd_mapping_file);
+
+        err = parse_fwid_mapping_db(g_fd_mapping_file, &fwid_mapping_db);
+        if(err != ERR_SUCCESS)
+            break;
+        free_fwid_mapping_db(&fwid_mapping_db);
+    }
+
+    return err;
+}
+
+int bench_get_fwid_from_mapping_db(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned short fwid = 0;
+    struct fwid_mapping_db fwid_mapping_db;
+
+    rewind(g_fd_mapping_file);
+    err = parse_fwid_mapping_db(g_fd_mapping_file, &fwid_mapping_db);
+    if(err != ERR_SUCCESS)
+        goto BENCH_GET_FWID_FROM_MAPPING_DB_EXIT;
+
+    for(index = 0; index < iterations; index++)
+    {
+        // Same key as bench_get_fwid_from_edid()
+        err = get_fwid_from_mapping_db(&fwid_mapping_db, 0x06af, (unsigned short)(0x1000 + BENCH_MAPPING_TABLE_ROW_COUNT - 2), CHROME, &fwid);
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    free_fwid_mapping_db(&fwid_mapping_db);
+
+BENCH_GET_FWID_FROM_MAPPING_DB_EXIT:
+    return err;
+}
+
+int bench_process_finger_report(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_FINGER_REPORT_ID, 0x01, 0x00, 0x10, 0x02, 0x20, 0x03};
+    struct finger_report finger_report;
+    struct report_stream_stats total_stats,
+                               window_stats;
+
+    report_buf[ELAN_FINGER_REPORT_CONTACT_COUNT_OFFSET] = 1;
+    reset_report_stream_stats(&total_stats);
+    reset_report_stream_stats(&window_stats);
+
+    // Per-report Work of Streaming: Decode & Update Total / Window Statistics (8ms Apart)
+    for(index = 0; index < iterations; index++)
+    {
+        err = decode_finger_report(report_buf, sizeof(report_buf), &finger_report);
+        if(err != ERR_SUCCESS)
+            break;
+
+        add_report_stream_sample(&total_stats, (unsigned long long)index * 8000000ULL);
+        add_report_stream_sample(&window_stats, (unsigned long long)index * 8000000ULL);
+    }
+
+    return err;
+}
+
+// Read Ring Header & Slot through File, as Another Reader would
+static int read_report_ring(int fd, struct report_ring_header *p_header, unsigned long long sequence, unsigned char *p_slot_buf, size_t slot_buf_size)
+{
+    if(pread(fd, p_header, sizeof(struct report_ring_header), 0) != (ssize_t)sizeof(struct report_ring_header))
+        return ERR_FILE_NOT_FOUND;
+
+    if((p_slot_buf != NULL) && \
+       (pread(fd, p_slot_buf, slot_buf_size, (off_t)(p_header->slot_offset + (sequence % p_header->slot_count) * p_header->slot_size)) != (ssize_t)slot_buf_size))
+        return ERR_FILE_NOT_FOUND;
+
+    return ERR_SUCCESS;
+}
+
+// Wrapped Ring: Skipped Report must Drop Only Recycled Slot from Valid Window, and Leave Other Valid Slots Intact
+static int check_report_ring_wrap(void)
+{
+    int err = ERR_SUCCESS,
+        fd = -1;
+    unsigned char report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_PEN_DEBUG_REPORT_ID, 0x3e},
+                  finger_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_FINGER_REPORT_ID, 0x01},
+                  slot_buf[offsetof(struct report_ring_slot, report) + ELAN_HID_INPUT_BUFFER_SIZE];
+    struct report_ring_header header;
+    struct report_ring_slot *p_slot = (struct report_ring_slot *)slot_buf;
+    unsigned long long sequence = 0,
+                       first_sequence = 0;
+
+    fd = open(g_ring_file_path, O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+        return ERR_FILE_NOT_FOUND;
+
+    err = read_report_ring(fd, &header, 0, NULL, 0);
+    if(err != ERR_SUCCESS)
+        goto CHECK_REPORT_RING_WRAP_EXIT;
+
+    // Fill Whole Ring, Each Report Tagged with Its Sequence
+    first_sequence = header.write_sequence;
+    for(sequence = first_sequence; sequence < first_sequence + header.slot_count; sequence++)
+    {
+        memcpy(&report_buf[2], &sequence, sizeof(sequence));
+        err = emu_dev_post_input_report(report_buf, sizeof(report_buf));
+        if(err != ERR_SUCCESS)
+            goto CHECK_REPORT_RING_WRAP_EXIT;
+        err = capture_report_to_ring(ELAN_HID_PEN_DEBUG_REPORT_ID, ELAN_READ_DATA_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS)
+            goto CHECK_REPORT_RING_WRAP_EXIT;
+    }
+
+    // Skipped Report Lands in Oldest Slot
+    err = emu_dev_post_input_report(finger_buf, sizeof(finger_buf));
+    if(err != ERR_SUCCESS)
+        goto CHECK_REPORT_RING_WRAP_EXIT;
+    err = capture_report_to_ring(ELAN_HID_PEN_DEBUG_REPORT_ID, ELAN_READ_DATA_TIMEOUT_MSEC);
+    if(err != ERR_DATA_PATTERN)
+    {
+        ERROR_PRINTF("%s: Skipped Report: err=0x%x, err=0x%x Expected!\r\n", __func__, err, ERR_DATA_PATTERN);
+        err = ERR_DATA_MISMATCHED;
+        goto CHECK_REPORT_RING_WRAP_EXIT;
+    }
+
+    err = read_report_ring(fd, &header, 0, NULL, 0);
+    if(err != ERR_SUCCESS)
+        goto CHECK_REPORT_RING_WRAP_EXIT;
+    if((header.write_sequence != first_sequence + header.slot_count) || (header.oldest_sequence != first_sequence + 1))
+    {
+        ERROR_PRINTF("%s: Valid Window [%llu, %llu), [%llu, %llu) Expected!\r\n", __func__, \
+                     header.oldest_sequence, header.write_sequence, first_sequence + 1, first_sequence + header.slot_count);
+        err = ERR_DATA_MISMATCHED;
+        goto CHECK_REPORT_RING_WRAP_EXIT;
+    }
+
+    // Every Report in Valid Window Holds Its Own Tag & Size
+    for(sequence = header.oldest_sequence; sequence < header.write_sequence; sequence++)
+    {
+        err = read_report_ring(fd, &header, sequence, slot_buf, sizeof(slot_buf));
+        if(err != ERR_SUCCESS)
+            goto CHECK_REPORT_RING_WRAP_EXIT;
+        if((p_slot->report_size != sizeof(report_buf)) || (p_slot->report[0] != ELAN_HID_PEN_DEBUG_REPORT_ID) || \
+           (memcmp(&p_slot->report[2], &sequence, sizeof(sequence)) != 0))
+        {
+            ERROR_PRINTF("%s: Report %llu Corrupted (Size %u, ID 0x%02x)!\r\n", __func__, sequence, p_slot->report_size, p_slot->report[0]);
+            err = ERR_DATA_MISMATCHED;
+            goto CHECK_REPORT_RING_WRAP_EXIT;
+        }
+    }
+
+CHECK_REPORT_RING_WRAP_EXIT:
+    close(fd);
+    return err;
+}
+
+int bench_capture_report_to_ring(int iterations)
+{
+    static bool wrap_checked = false; // Checked Once, not Timed in Every Repeat
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned char report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_PEN_DEBUG_REPORT_ID, 0x3e};
+
+    if(wrap_checked == false)
+    {
+        err = check_report_ring_wrap();
+        if(err != ERR_SUCCESS)
+            return err;
+        wrap_checked = true;
+    }
+
+    // Same Report Traffic as bench_read_raw_bytes(), Read straight into Ring Slots
+    for(index = 0; index < iterations; index++)
+    {
+        err = emu_dev_post_input_report(report_buf, sizeof(report_buf));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = capture_report_to_ring(ELAN_HID_PEN_DEBUG_REPORT_ID, ELAN_READ_DATA_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_get_firmware_info(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0,
+        report_index = 0;
+    unsigned char report_buf[4][ELAN_HID_INPUT_BUFFER_SIZE] = {{ELAN_HID_INPUT_REPORT_ID, 0x04, 0x52, 0x10, 0x12, 0x30},  // BC Version
+                                                              {ELAN_HID_INPUT_REPORT_ID, 0x04, 0x52, 0xe0, 0x00, 0x10},  // Test Version
+                                                              {ELAN_HID_INPUT_REPORT_ID, 0x04, 0x52, 0x05, 0x50, 0x10},  // FW Version
+                                                              {ELAN_HID_INPUT_REPORT_ID, 0x04, 0x52, 0xf0, 0x12, 0x30}}; // FW ID
+    unsigned short fw_id = 0,
+                   fw_version = 0,
+                   test_version = 0,
+                   bc_version = 0;
+
+    // Four Query Commands in One Pipelined Transaction, Responses in Reversed Order
+    for(index = 0; index < iterations; index++)
+    {
+        for(report_index = 0; (report_index < 4) && (err == ERR_SUCCESS); report_index++)
+            err = emu_dev_post_input_report(report_buf[report_index], sizeof(report_buf[report_index]));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = get_firmware_info(&fw_id, &fw_version, &test_version, &bc_version, false);
+        if(err != ERR_SUCCESS)
+            break;
+
+        for(report_index = 0; (report_index < 4) && (err == ERR_SUCCESS); report_index++)
+            err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+int bench_wait_rek_response(int iterations)
+{
+    int err = ERR_SUCCESS,
+        index = 0,
+        report_index = 0;
+    unsigned char finger_report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_FINGER_REPORT_ID, 0x01, 0x00, 0x10, 0x02, 0x20, 0x03},
+                  rek_report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_INPUT_REPORT_ID, 0x04, 0x66, 0x66, 0x66, 0x66},
+                  rek_counter_report_buf[ELAN_HID_INPUT_BUFFER_SIZE] = {ELAN_HID_INPUT_REPORT_ID, 0x04, 0x52, 0xd0, 0x00, 0x2a};
+    unsigned short rek_counter = 0;
+
+    // Completion Report after Interleaved Finger Reports, then Calibration Counter (Calibration Path without Console Output)
+    for(index = 0; index < iterations; index++)
+    {
+        for(report_index = 0; (report_index < 3) && (err == ERR_SUCCESS); report_index++)
+            err = emu_dev_post_input_report(finger_report_buf, sizeof(finger_report_buf));
+        if(err == ERR_SUCCESS)
+            err = emu_dev_post_input_report(rek_report_buf, sizeof(rek_report_buf));
+        if(err == ERR_SUCCESS)
+            err = emu_dev_post_input_report(rek_counter_report_buf, sizeof(rek_counter_report_buf));
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = wait_rek_response(ELAN_READ_CALI_RESP_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS)
+            break;
+
+        err = get_rek_counter(&rek_counter);
+        if(err != ERR_SUCCESS)
+            break;
+
+        // Calibration Counter Command
+        err = emu_dev_drain_output_report();
+        if(err != ERR_SUCCESS)
+            break;
+    }
+
+    return err;
+}
+
+/*******************************************
+ * Benchmark Runner
+ ******************************************/
+
+static long long get_monotonic_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((long long)ts.tv_sec * 1000000000LL) + ts.tv_nsec;
+}
+
+static int compare_long_long(const void *p_a, const void *p_b)
+{
+    long long a = *(const long long *)p_a,
+              b = *(const long long *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+int run_bench_case(const struct bench_case *p_bench_case)
+{
+    int err = ERR_SUCCESS,
+        repeat_index = 0;
+    long long start_time = 0,
+              elapsed_time[BENCH_MAX_REPEAT_COUNT] = {0};
+
+    // Warm Up (Page Cache, Branch Predictor, Socket Buffers)
+    err = p_bench_case->func(p_bench_case->iterations / 10 + 1);
+    if(err != ERR_SUCCESS)
+        goto RUN_BENCH_CASE_EXIT;
+
+    for(repeat_index = 0; repeat_index < g_repeat_count; repeat_index++)
+    {
+        start_time = get_monotonic_time_ns();
+        err = p_bench_case->func(p_bench_case->iterations);
+        elapsed_time[repeat_index] = get_monotonic_time_ns() - start_time;
+        if(err != ERR_SUCCESS)
+            goto RUN_BENCH_CASE_EXIT;
+    }
+
+    // Min. & Median of Repeats are Much More Stable than Mean
+    qsort(elapsed_time, g_repeat_count, sizeof(long long), compare_long_long);
+
+    printf("bench=%s iterations=%d repeats=%d ns_per_op_min=%.1f ns_per_op_median=%.1f ns_per_op_max=%.1f\n", \
+           p_bench_case->name, p_bench_case->iterations, g_repeat_count, \
+           (double)elapsed_time[0] / p_bench_case->iterations, \
+           (double)elapsed_time[g_repeat_count / 2] / p_bench_case->iterations, \
+           (double)elapsed_time[g_repeat_count - 1] / p_bench_case->iterations);
+
+RUN_BENCH_CASE_EXIT:
+    if(err != ERR_SUCCESS)
+        printf("bench=%s error=0x%x\n", p_bench_case->name, err);
+    return err;
+}
+
+/*******************************************
+ * Help
+ ******************************************/
+
+void show_help_information(void)
+{
+    unsigned int index = 0;
+
+    printf("--------------------------------\r\n");
+    printf("SYNOPSIS:\r\n");
+
+    // Benchmark
+    printf("\n[Benchmark]\r\n");
+    printf("-b <benchmark name>.\r\n");
+    printf("Ex: hid_bench -b create_ektl_fw_page\r\n");
+    printf("Benchmarks:");
+    for(index = 0; index < (sizeof(g_bench_cases) / sizeof(g_bench_cases[0])); index++)
+        printf(" %s", g_bench_cases[index].name);
+    printf("\r\n");
+
+    // Repeat Count
+    printf("\n[Repeat Count]\r\n");
+    printf("-n <repeat count (1~%d)>.\r\n", BENCH_MAX_REPEAT_COUNT);
+    printf("Ex: hid_bench -n 9\r\n");
+
+    // Work Directory
+    printf("\n[Work Directory]\r\n");
+    printf("-w <directory for temporary files>.\r\n");
+    printf("Ex: hid_bench -w /tmp\r\n");
+
+    // Debug Information
+    printf("\n[Debug]\r\n");
+    printf("-d.\r\n");
+    printf("Ex: hid_bench -d\r\n");
+
+    // Help Information
+    printf("\n[Help]\r\n");
+    printf("-h.\r\n");
+    printf("Ex: hid_bench -h\r\n");
+
+    return;
+}
+
+/*******************************************
+ *  Initialize & Free Resource
+ ******************************************/
+
+static int create_ektl_fw_file(const char *p_file_path)
+{
+    int err = ERR_SUCCESS,
+        page_index = 0,
+        data_index = 0;
+    unsigned int page_address = 0;
+    unsigned char header_page[ELAN_EKTL_FW_PAGE_SIZE] = {0},
+                  page_data_buf[ELAN_EKTL_FW_PAGE_DATA_SIZE] = {0},
+                  page_buf[ELAN_EKTL_FW_PAGE_SIZE] = {0};
+    FILE *fd = NULL;
+
+    fd = fopen(p_file_path, "wb");
+    if(fd == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to create \"%s\"!\r\n", __func__, p_file_path);
+        err = ERR_FILE_IO_ERROR;
+        goto CREATE_EKTL_FW_FILE_EXIT;
+    }
+
+    // Header Page: Title, Length, libHex2Ektl Version, Erase Script & End
+    memcpy(&header_page[0], "header", 6);
+    header_page[6]  = 0xFE; header_page[7] = 0x07;  // Header Length: 2046
+    header_page[10] = 0x01;                         // libHex2Ektl Version: 1.3.0.0
+    header_page[14] = 0x03;
+    header_page[26] = 0x02;                         // Erase Section Count: 2
+    header_page[31] = 0xF8; header_page[32] = 0x03; // Section 1: 0x0003F800, 1 Page
+    header_page[34] = 0x01;
+    header_page[39] = 0x40;                         // Section 2: 0x00004000, 0x77 Pages
+    header_page[42] = 0x77;
+    memcpy(&header_page[ELAN_EKTL_FW_PAGE_SIZE - 3], "eof", 3);
+    if(fwrite(header_page, 1, sizeof(header_page), fd) != sizeof(header_page))
+    {
+        err = ERR_FILE_IO_ERROR;
+        goto CREATE_EKTL_FW_FILE_EXIT_1;
+    }
+
+    // FW Pages
+    for(page_index = 0; page_index < BENCH_EKTL_FW_PAGE_COUNT; page_index++)
+    {
+        for(data_index = 0; data_index < (int)sizeof(page_data_buf); data_index++)
+            page_data_buf[data_index] = (unsigned char)(page_index + data_index);
+
+        page_address = 0x00004000 + (page_index * ELAN_GEN8_MEMORY_PAGE_SIZE);
+        err = create_ektl_fw_page(page_address, page_data_buf, sizeof(page_data_buf), page_buf, sizeof(page_buf));
+        if(err != ERR_SUCCESS)
+            goto CREATE_EKTL_FW_FILE_EXIT_1;
+
+        if(fwrite(page_buf, 1, sizeof(page_buf), fd) != sizeof(page_buf))
+        {
+            err = ERR_FILE_IO_ERROR;
+            goto CREATE_EKTL_FW_FILE_EXIT_1;
+        }
+    }
+
+CREATE_EKTL_FW_FILE_EXIT_1:
+    fclose(fd);
+
+CREATE_EKTL_FW_FILE_EXIT:
+    return err;
+}
+
+static int create_mapping_file(const char *p_file_path)
+{
+    int err = ERR_SUCCESS,
+        row_index = 0;
+    FILE *fd = NULL;
+
+    fd = fopen(p_file_path, "w");
+    if(fd == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to create \"%s\"!\r\n", __func__, p_file_path);
+        err = ERR_FILE_IO_ERROR;
+        goto CREATE_MAPPING_FILE_EXIT;
+    }
+
+    // Same layout as bin/fwid_mapping_table.txt of hid_read_fwid
+    fprintf(fd, "manufacturer.product,chrome_fwid,windows_fwid,\n");
+    for(row_index = 0; row_index < (BENCH_MAPPING_TABLE_ROW_COUNT - 1); row_index++)
+        fprintf(fd, "06af.%04x,%04x,%04x,\n", 0x1000 + row_index, 0x3000 + row_index, 0x2000 + row_index);
+
+    fclose(fd);
+
+CREATE_MAPPING_FILE_EXIT:
+    return err;
+}
+
+int resource_init(void)
+{
+    int err = ERR_SUCCESS,
+        sv[2] = {-1, -1};
+
+    // Temporary Files
+    snprintf(g_ektl_fw_file_path, sizeof(g_ektl_fw_file_path), "%s/hid_bench_%d.ektl", g_work_dir, (int)getpid());
+    snprintf(g_mapping_file_path, sizeof(g_mapping_file_path), "%s/hid_bench_%d_mapping.txt", g_work_dir, (int)getpid());
+    snprintf(g_ring_file_path, sizeof(g_ring_file_path), "%s/hid_bench_%d.ring", g_work_dir, (int)getpid());
+    snprintf(g_codec_ekt_file_path, sizeof(g_codec_ekt_file_path), "%s/hid_bench_%d_codec.ekt", g_work_dir, (int)getpid());
+    snprintf(g_codec_elz_file_path, sizeof(g_codec_elz_file_path), "%s/hid_bench_%d_codec.elz", g_work_dir, (int)getpid());
+    snprintf(g_codec_bad_file_path, sizeof(g_codec_bad_file_path), "%s/hid_bench_%d_codec_bad.elz", g_work_dir, (int)getpid());
+    snprintf(g_bundle_file_path, sizeof(g_bundle_file_path), "%s/hid_bench_%d.elb", g_work_dir, (int)getpid());
+    snprintf(g_bundle_bad_file_path, sizeof(g_bundle_bad_file_path), "%s/hid_bench_%d_bad.elb", g_work_dir, (int)getpid());
+    snprintf(g_log_file_name, sizeof(g_log_file_name), "hid_bench_%d_log.txt", (int)getpid());
+
+    // Initialize Interface
+    g_pIntfGet = new CEmuHIDLinuxGet(g_work_dir, g_log_file_name);
+    if (g_pIntfGet == NULL)
+    {
+        ERROR_PRINTF("Fail to initialize HID Interface!");
+        err = ERR_NO_INTERFACE_CREATED;
+        goto RESOURCE_INIT_EXIT;
+    }
+
+    // Emulated Device
+    if(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sv) < 0)
+    {
+        ERROR_PRINTF("Fail to create emulated device! errno=%d.\r\n", errno);
+        err = ERR_IO_ERROR;
+        goto RESOURCE_INIT_EXIT;
+    }
+    ((CEmuHIDLinuxGet *)g_pIntfGet)->AttachHandle(sv[0]);
+    g_emu_dev_fd = sv[1];
+
+    // Emulated eKTL Firmware
+    err = create_ektl_fw_file(g_ektl_fw_file_path);
+    if(err != ERR_SUCCESS)
+        goto RESOURCE_INIT_EXIT;
+
+    err = open_firmware_file(g_ektl_fw_file_path, strlen(g_ektl_fw_file_path));
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to open firmware file \"%s\"! err=0x%x.\r\n", g_ektl_fw_file_path, err);
+        goto RESOURCE_INIT_EXIT;
+    }
+
+    // Emulated FWID Mapping Table
+    err = create_mapping_file(g_mapping_file_path);
+    if(err != ERR_SUCCESS)
+        goto RESOURCE_INIT_EXIT;
+
+    g_fd_mapping_file = fopen(g_mapping_file_path, "r");
+    if(g_fd_mapping_file == NULL)
+    {
+        ERROR_PRINTF("Fail to open FWID mapping table file \"%s\"!\r\n", g_mapping_file_path);
+        err = ERR_FILE_NOT_FOUND;
+        goto RESOURCE_INIT_EXIT;
+    }
+
+    // Pen Debug Report Ring (Wraps during Benchmark)
+    err = open_report_ring(g_ring_file_path, 1);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to open report ring \"%s\"! err=0x%x.\r\n", g_ring_file_path, err);
+        goto RESOURCE_INIT_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+RESOURCE_INIT_EXIT:
+    return err;
+}
+
+int resource_free(void)
+{
+    char log_file_path[FILE_NAME_LENGTH_MAX * 2] = {0};
+
+    // Pen Debug Report Ring
+    close_report_ring();
+    unlink(g_ring_file_path);
+
+    // FWID Mapping Table
+    if(g_fd_mapping_file != NULL)
+    {
+        fclose(g_fd_mapping_file);
+        g_fd_mapping_file = NULL;
+    }
+    unlink(g_mapping_file_path);
+
+    // eKTL Firmware
+    close_firmware_file();
+    unlink(g_ektl_fw_file_path);
+
+    // Codec Images
+    unlink(g_codec_ekt_file_path);
+    unlink(g_codec_elz_file_path);
+    unlink(g_codec_bad_file_path);
+
+    // Bundles
+    unlink(g_bundle_file_path);
+    unlink(g_bundle_bad_file_path);
+
+    // Emulated Device
+    if(g_emu_dev_fd >= 0)
+    {
+        close(g_emu_dev_fd);
+        g_emu_dev_fd = -1;
+    }
+
+    // Release Interface
+    if (g_pIntfGet)
+    {
+        g_pIntfGet->Close();
+        delete dynamic_cast<CEmuHIDLinuxGet *>(g_pIntfGet);
+        g_pIntfGet = NULL;
+    }
+
+    // Log File of debug_print_buffer
+    snprintf(log_file_path, sizeof(log_file_path), "%s/%s", g_work_dir, g_log_file_name);
+    unlink(log_file_path);
+
+    return ERR_SUCCESS;
+}
+
+/***************************************************
+* Parser command
+***************************************************/
+
+int process_parameter(int argc, char **argv)
+{
+    int err = ERR_SUCCESS,
+        opt = 0,
+        option_index = 0,
+        repeat_count = 0;
+
+    while (1)
+    {
+        opt = getopt_long(argc, argv, short_options, long_options, &option_index);
+        if (opt == EOF)	break;
+
+        switch (opt)
+        {
+            case 'b': /* Benchmark Name */
+
+                if ((strlen(optarg) == 0) || (strlen(optarg) >= sizeof(g_bench_filter)))
+                {
+                    ERROR_PRINTF("%s: Invalid Benchmark Name!\r\n", __func__);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strcpy(g_bench_filter, optarg);
+                break;
+
+            case 'n': /* Repeat Count */
+
+                repeat_count = atoi(optarg);
+                if ((repeat_count <= 0) || (repeat_count > BENCH_MAX_REPEAT_COUNT))
+                {
+                    ERROR_PRINTF("%s: Invalid Repeat Count: %d!\r\n", __func__, repeat_count);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                g_repeat_count = repeat_count;
+                break;
+
+            case 'w': /* Work Directory */
+
+                if ((strlen(optarg) == 0) || (strlen(optarg) >= sizeof(g_work_dir)))
+                {
+                    ERROR_PRINTF("%s: Invalid Work Directory!\r\n", __func__);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strcpy(g_work_dir, optarg);
+                break;
+
+            case 'd': /* Debug Option */
+
+                g_debug = true;
+                break;
+
+            case 'h': /* Help */
+
+                g_help = true;
+                break;
+
+            default:
+                ERROR_PRINTF("%s: Unknow Command!\r\n", __func__);
+                break;
+        }
+    }
+
+    return ERR_SUCCESS;
+
+PROCESS_PARAM_EXIT:
+    return err;
+}
+
+/*******************************************
+ * Main Function
+ ******************************************/
+
+int main(int argc, char **argv)
+{
+    int err = ERR_SUCCESS;
+    unsigned int index = 0;
+    bool bench_found = false;
+
+    /* Process Parameter */
+    err = process_parameter(argc, argv);
+    if (err != ERR_SUCCESS)
+        goto EXIT;
+
+    /* Show Help Information */
+    if(g_help == true)
+    {
+        printf("hid_bench v%s %s.\r\n", ELAN_TOOL_SW_VERSION, ELAN_TOOL_SW_RELEASE_DATE);
+        show_help_information();
+        goto EXIT;
+    }
+
+    /* Initialize Resource */
+    err = resource_init();
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Init Resource! err=0x%x.\r\n", err);
+        goto EXIT1;
+    }
+
+    /* Transport is measured without per-report buffer logging, which is
+     * benchmarked on its own by debug_print_buffer. */
+    g_bEnableDebug = false;
+
+    /* Run Benchmarks */
+    printf("# hid_bench v%s\n", ELAN_TOOL_SW_VERSION);
+    for(index = 0; index < (sizeof(g_bench_cases) / sizeof(g_bench_cases[0])); index++)
+    {
+        if((strcmp(g_bench_filter, "") != 0) && (strcmp(g_bench_filter, g_bench_cases[index].name) != 0))
+            continue;
+        bench_found = true;
+
+        err = run_bench_case(&g_bench_cases[index]);
+        if(err != ERR_SUCCESS)
+            goto EXIT1;
+    }
+
+    if(bench_found == false)
+    {
+        ERROR_PRINTF("Unknown Benchmark \"%s\"!\r\n", g_bench_filter);
+        err = ERR_INVALID_PARAM;
+    }
+
+EXIT1:
+    /* Release Resource */
+    resource_free();
+
+EXIT:
+    return err;
+}
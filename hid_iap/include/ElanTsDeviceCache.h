@@ -0,0 +1,79 @@
+/** @file
+
+  Header of Device Discovery Cache for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsDeviceCache.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_DEVICE_CACHE_H__
+#define __ELAN_TS_DEVICE_CACHE_H__
+#pragma once
+
+#include <stddef.h>
+#include "BuildConfig.h"
+#include "ElanTsDebug.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Directory of hidraw Class in sysfs
+#ifndef DEVICE_CACHE_SYSFS_HIDRAW_DIR
+#define DEVICE_CACHE_SYSFS_HIDRAW_DIR   "/sys/class/hidraw"
+#endif //DEVICE_CACHE_SYSFS_HIDRAW_DIR
+
+// Max. Number of Devices in Cache File
+#ifndef DEVICE_CACHE_ENTRY_COUNT_MAX
+#define DEVICE_CACHE_ENTRY_COUNT_MAX    16
+#endif //DEVICE_CACHE_ENTRY_COUNT_MAX
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Discovery & Identification of One Device (Keyed by sysfs Device Path)
+struct device_cache_entry
+{
+    char sysfs_path[MAX_PATH];          // Resolved /sys/class/hidraw/hidrawN/device
+    char hidraw_path[MAX_PATH];         // /dev/hidrawN
+    unsigned long inode;                // Inode & Device Number of hidraw Node, Changed on Re-enumeration
+    unsigned long rdev;
+    unsigned int vid;
+    unsigned int pid;
+    unsigned int bus_type;
+    unsigned char hello_packet;         // Normal Mode Only (Recovery Mode is never Cached)
+    unsigned short bc_bc_version;
+    unsigned short fw_bc_version;
+    bool gen8_touch;
+};
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// hidraw Node Identity
+int get_hidraw_identity(const char *p_hidraw_path, struct device_cache_entry *p_entry);
+
+// Cache File
+int find_device_cache_entry(const char *p_cache_path, unsigned int vid, unsigned int pid, struct device_cache_entry *p_entry);
+int store_device_cache_entry(const char *p_cache_path, const struct device_cache_entry *p_entry);
+int remove_device_cache_entry(const char *p_cache_path, const char *p_hidraw_path);
+
+#endif //__ELAN_TS_DEVICE_CACHE_H__
@@ -0,0 +1,136 @@
+/** @file
+
+  Header of Pen Debug Report Ring Capture for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsReportRing.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_REPORT_RING_H__
+#define __ELAN_TS_REPORT_RING_H__
+#pragma once
+
+#include <stddef.h>
+#include "HidConfig.h"
+#include "ElanTsDebug.h"
+#include "ElanTsFwUpdateFlow.h" // message_mode_t
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/*              Report Ring File Format (Preallocated, Memory-mapped)           *
+ *                                                                              *
+ *    | Header | Index Entry 0 | ... | Index Entry M-1 | Slot 0 | ... | Slot N-1 |
+ *    | 4KB    |    16-byte    |     |     16-byte     | Slot Size Each         |
+ *                                                                              *
+ *    Report of Sequence S is in Slot (S % N). Index Entry (S / I % M) Records  *
+ *    First Sequence & Timestamp of Every I Slots, for Seeking by Time.         *
+ *    Header Write Sequence is Updated after Slot & Index are Written.          *
+ *    Valid Reports are [Oldest Sequence, Write Sequence). Oldest Sequence is   *
+ *    Advanced past Old Report of a Slot before the Slot is Recycled, so a      *
+ *    Reader Copies a Slot, then Checks Its Sequence against Oldest Sequence    *
+ *    again to Discard a Slot Recycled while Being Copied.                      *
+ */
+
+#ifndef REPORT_RING_MAGIC
+#define REPORT_RING_MAGIC                   "ELANRING"
+#endif //REPORT_RING_MAGIC
+
+#ifndef REPORT_RING_VERSION
+#define REPORT_RING_VERSION                 2
+#endif //REPORT_RING_VERSION
+
+#ifndef REPORT_RING_HEADER_SIZE
+#define REPORT_RING_HEADER_SIZE             4096
+#endif //REPORT_RING_HEADER_SIZE
+
+// Slots per Index Entry
+#ifndef REPORT_RING_INDEX_INTERVAL
+#define REPORT_RING_INDEX_INTERVAL          1024
+#endif //REPORT_RING_INDEX_INTERVAL
+
+// Default & Max. Ring File Size
+#ifndef REPORT_RING_DEFAULT_SIZE_MB
+#define REPORT_RING_DEFAULT_SIZE_MB         64
+#endif //REPORT_RING_DEFAULT_SIZE_MB
+
+#ifndef REPORT_RING_MAX_SIZE_MB
+#define REPORT_RING_MAX_SIZE_MB             4096
+#endif //REPORT_RING_MAX_SIZE_MB
+
+// Interval of Flushing Ring File (msync) & Showing Progress
+#ifndef REPORT_RING_FLUSH_INTERVAL_MSEC
+#define REPORT_RING_FLUSH_INTERVAL_MSEC     1000
+#endif //REPORT_RING_FLUSH_INTERVAL_MSEC
+
+// Read Timeout of Capture (Check Stop Request in between)
+#ifndef REPORT_RING_READ_TIMEOUT_MSEC
+#define REPORT_RING_READ_TIMEOUT_MSEC       100
+#endif //REPORT_RING_READ_TIMEOUT_MSEC
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Ring File Header (First 4KB of File)
+struct report_ring_header
+{
+    char magic[8];                          // "ELANRING"
+    unsigned int version;
+    unsigned int slot_size;
+    unsigned long long slot_count;
+    unsigned long long slot_offset;         // File Offset of Slot 0
+    unsigned int index_interval;
+    unsigned int index_count;
+    unsigned long long index_offset;        // File Offset of Index Entry 0
+    unsigned long long start_time_ns;       // CLOCK_MONOTONIC
+    volatile unsigned long long write_sequence; // Reports Written (Next Slot: write_sequence % slot_count)
+    volatile unsigned long long oldest_sequence; // First Valid Report (Reports before were Overwritten)
+};
+
+// Index Entry
+struct report_ring_index_entry
+{
+    unsigned long long sequence;
+    unsigned long long time_ns;
+};
+
+// Slot (Report Data Follows Header)
+struct report_ring_slot
+{
+    unsigned long long time_ns;             // CLOCK_MONOTONIC at Arrival
+    unsigned short report_size;
+    unsigned char reserved[6];
+    unsigned char report[1];                // Slot Size - 16 Bytes
+};
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Ring File
+int open_report_ring(const char *p_ring_path, unsigned int ring_size_mb);
+int close_report_ring(void);
+
+// Capture
+int capture_report_to_ring(unsigned char report_id, int timeout_ms);
+int capture_pen_debug_reports(const char *p_ring_path, unsigned int ring_size_mb, message_mode_t msg_mode);
+
+#endif //__ELAN_TS_REPORT_RING_H__
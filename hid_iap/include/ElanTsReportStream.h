@@ -0,0 +1,180 @@
+/** @file
+
+  Header of Touch Report Streaming & Report Rate Analyzer for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsReportStream.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_REPORT_STREAM_H__
+#define __ELAN_TS_REPORT_STREAM_H__
+#pragma once
+
+#include <stddef.h>
+#include "HidConfig.h"
+#include "ElanTsDebug.h"
+#include "ElanTsFwUpdateFlow.h" // message_mode_t
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/*              ELAN Finger Report Format (Report ID 0x01)                      *
+ *                                                                              *
+ *    | Report ID | Contact 0 | ... | Contact N-1 | Scan Time | Contact Count | *
+ *    |  1-byte   |  6-byte   |     |   6-byte    |  2-byte   |    1-byte     | *
+ *                                                                              *
+ *    Contact: | Status (Bit 0: Tip Switch) | Contact ID | X (LE) | Y (LE) |    *
+ *             |          1-byte            |   1-byte   | 2-byte | 2-byte |    *
+ *                                                                              *
+ *    Hybrid Mode: Contact Count is Set in the First Report of a Frame Only.    *
+ */
+
+// Contacts per Finger Report
+#ifndef ELAN_FINGER_REPORT_CONTACT_COUNT_MAX
+#define ELAN_FINGER_REPORT_CONTACT_COUNT_MAX    5
+#endif //ELAN_FINGER_REPORT_CONTACT_COUNT_MAX
+
+// Size of One Contact in Finger Report
+#ifndef ELAN_FINGER_REPORT_CONTACT_SIZE
+#define ELAN_FINGER_REPORT_CONTACT_SIZE         6
+#endif //ELAN_FINGER_REPORT_CONTACT_SIZE
+
+// Offset of First Contact in Finger Report
+#ifndef ELAN_FINGER_REPORT_CONTACT_OFFSET
+#define ELAN_FINGER_REPORT_CONTACT_OFFSET       1
+#endif //ELAN_FINGER_REPORT_CONTACT_OFFSET
+
+// Offset of Scan Time (100us Unit) in Finger Report
+#ifndef ELAN_FINGER_REPORT_SCAN_TIME_OFFSET
+#define ELAN_FINGER_REPORT_SCAN_TIME_OFFSET     ((ELAN_FINGER_REPORT_CONTACT_OFFSET) + (ELAN_FINGER_REPORT_CONTACT_COUNT_MAX) * (ELAN_FINGER_REPORT_CONTACT_SIZE))
+#endif //ELAN_FINGER_REPORT_SCAN_TIME_OFFSET
+
+// Offset of Contact Count in Finger Report
+#ifndef ELAN_FINGER_REPORT_CONTACT_COUNT_OFFSET
+#define ELAN_FINGER_REPORT_CONTACT_COUNT_OFFSET ((ELAN_FINGER_REPORT_SCAN_TIME_OFFSET) + 2)
+#endif //ELAN_FINGER_REPORT_CONTACT_COUNT_OFFSET
+
+// Tip Switch Bit of Contact Status
+#ifndef ELAN_FINGER_CONTACT_TIP_SWITCH
+#define ELAN_FINGER_CONTACT_TIP_SWITCH          0x01
+#endif //ELAN_FINGER_CONTACT_TIP_SWITCH
+
+// Read Timeout of Streaming (Check Stop Request in between)
+#ifndef REPORT_STREAM_READ_TIMEOUT_MSEC
+#define REPORT_STREAM_READ_TIMEOUT_MSEC         100
+#endif //REPORT_STREAM_READ_TIMEOUT_MSEC
+
+// Interval of Live Statistics Output
+#ifndef REPORT_STREAM_SHOW_INTERVAL_MSEC
+#define REPORT_STREAM_SHOW_INTERVAL_MSEC        1000
+#endif //REPORT_STREAM_SHOW_INTERVAL_MSEC
+
+// Interval over this is an Idle Gap (No Touch / Pen out of Range), not Counted as Jitter or Drops
+#ifndef REPORT_STREAM_IDLE_GAP_MSEC
+#define REPORT_STREAM_IDLE_GAP_MSEC             100
+#endif //REPORT_STREAM_IDLE_GAP_MSEC
+
+// Interval Histogram: Bucket Width & Count (Covers up to Idle Gap, Last Bucket Holds All Longer Intervals)
+#ifndef REPORT_INTERVAL_BUCKET_US
+#define REPORT_INTERVAL_BUCKET_US               500
+#endif //REPORT_INTERVAL_BUCKET_US
+
+#ifndef REPORT_INTERVAL_BUCKET_COUNT
+#define REPORT_INTERVAL_BUCKET_COUNT            ((REPORT_STREAM_IDLE_GAP_MSEC) * 1000 / (REPORT_INTERVAL_BUCKET_US) + 1)
+#endif //REPORT_INTERVAL_BUCKET_COUNT
+
+// Interval over this Percentage of Nominal Interval Means Dropped Report(s)
+#ifndef REPORT_DROP_THRESHOLD_PERCENT
+#define REPORT_DROP_THRESHOLD_PERCENT           150
+#endif //REPORT_DROP_THRESHOLD_PERCENT
+
+/*              Report Capture File Format                                      *
+ *                                                                              *
+ *    Header: | Magic "ELANRPT1" | Record Data Size (LE) |                      *
+ *            |      8-byte      |        4-byte         |                      *
+ *                                                                              *
+ *    Record: | Timestamp (CLOCK_MONOTONIC, ns, LE) | Raw Report (Data Size) |  *
+ *            |               8-byte                |                        |  *
+ */
+#ifndef REPORT_CAPTURE_MAGIC
+#define REPORT_CAPTURE_MAGIC                    "ELANRPT1"
+#endif //REPORT_CAPTURE_MAGIC
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Report Types
+enum report_type
+{
+    REPORT_TYPE_FINGER = 0,
+    REPORT_TYPE_PEN,
+    REPORT_TYPE_PEN_DEBUG,
+    REPORT_TYPE_COUNT
+};
+typedef enum report_type report_type_t;
+
+// Finger Contact
+struct finger_contact
+{
+    bool tip;
+    unsigned char contact_id;
+    unsigned short x;
+    unsigned short y;
+};
+
+// Decoded Finger Report
+struct finger_report
+{
+    unsigned char contact_count;    // Contacts in Frame (0 if Following Report of Hybrid Mode)
+    unsigned short scan_time;       // 100us Unit
+    struct finger_contact contact[ELAN_FINGER_REPORT_CONTACT_COUNT_MAX];
+};
+
+// Statistics of One Report Type
+struct report_stream_stats
+{
+    unsigned long long report_count;
+    unsigned long long first_time_ns;
+    unsigned long long last_time_ns;
+    unsigned long long interval_count;      // Intervals Counted (Idle Gaps Excluded)
+    unsigned long long interval_sum_ns;
+    unsigned long long interval_min_ns;
+    unsigned long long interval_max_ns;
+    unsigned long long histogram[REPORT_INTERVAL_BUCKET_COUNT];
+};
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Finger Report
+int decode_finger_report(const unsigned char *p_report, size_t report_size, struct finger_report *p_finger_report);
+
+// Statistics
+void reset_report_stream_stats(struct report_stream_stats *p_stats);
+void add_report_stream_sample(struct report_stream_stats *p_stats, unsigned long long time_ns);
+unsigned long long get_nominal_report_interval_ns(const struct report_stream_stats *p_stats);
+unsigned long long estimate_dropped_reports(const struct report_stream_stats *p_stats);
+
+// Streaming
+int stream_reports(unsigned int duration_sec, const char *p_capture_path, message_mode_t msg_mode);
+
+#endif //__ELAN_TS_REPORT_STREAM_H__
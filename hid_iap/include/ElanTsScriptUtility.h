@@ -0,0 +1,94 @@
+/** @file
+
+  Header of Session Script Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsScriptUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_SCRIPT_UTILITY_H__
+#define __ELAN_TS_SCRIPT_UTILITY_H__
+#pragma once
+
+#include <stddef.h>
+#include "ElanTsDebug.h"
+#include "ElanTsQueryUtility.h"   // struct touch_session
+#include "ElanTsFwUpdateFlow.h"   // message_mode_t
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/*              Session Script Format                                           *
+ *                                                                              *
+ *    One Command per Line: <command> [<argument> ...] (Separated by Spaces)    *
+ *    Empty Lines and Text after '#' are Ignored.                               *
+ *    Commands Run in Order over One Device Session; First Failure Stops.       *
+ */
+
+// Max. Length of Script Line
+#ifndef SCRIPT_LINE_LENGTH_MAX
+#define SCRIPT_LINE_LENGTH_MAX      1024
+#endif //SCRIPT_LINE_LENGTH_MAX
+
+// Max. Number of Arguments (Command Name Included)
+#ifndef SCRIPT_ARG_COUNT_MAX
+#define SCRIPT_ARG_COUNT_MAX        8
+#endif //SCRIPT_ARG_COUNT_MAX
+
+// Comment Character
+#ifndef SCRIPT_COMMENT_CHAR
+#define SCRIPT_COMMENT_CHAR         '#'
+#endif //SCRIPT_COMMENT_CHAR
+
+// Script Path of Standard Input
+#ifndef SCRIPT_STDIN_PATH
+#define SCRIPT_STDIN_PATH           "-"
+#endif //SCRIPT_STDIN_PATH
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Command Handler: argv[0] is Command Name.
+// Session is Updated if Command Changes Touch State (e.g. Recovery Mode to Normal Mode after FW Update).
+typedef int (*script_command_handler)(struct touch_session *p_session, int argc, char **argv);
+
+struct script_command
+{
+    const char *name;
+    int arg_count_min;              // Arguments after Command Name
+    int arg_count_max;
+    script_command_handler run;
+    const char *usage;
+};
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Command Line
+int parse_script_line(char *p_line, char **pp_argv, int argv_size, int *p_argc);
+void show_script_command_usage(const struct script_command *p_cmd_table, size_t cmd_table_count);
+
+// Script
+int run_session_script(const char *p_script_path, const struct script_command *p_cmd_table, size_t cmd_table_count, \
+                       struct touch_session *p_session, message_mode_t msg_mode);
+
+#endif //__ELAN_TS_SCRIPT_UTILITY_H__
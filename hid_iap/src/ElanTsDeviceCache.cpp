@@ -0,0 +1,276 @@
+/** @file
+
+  Implementation of Device Discovery Cache for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsDeviceCache.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "ErrCode.h"
+#include "HidConfig.h"
+#include "ElanTsDeviceCache.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Entries of Cache File
+static struct device_cache_entry g_device_cache[DEVICE_CACHE_ENTRY_COUNT_MAX];
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// hidraw Node Identity: Inode & Device Number of Node, and Resolved sysfs Device Path
+int get_hidraw_identity(const char *p_hidraw_path, struct device_cache_entry *p_entry)
+{
+    int err = ERR_SUCCESS;
+    struct stat node_stat;
+    const char *p_node_name = NULL;
+    char sysfs_link_path[MAX_PATH] = {0},
+         sysfs_path[PATH_MAX] = {0};
+
+    // Validate Input Parameter
+    if((p_hidraw_path == NULL) || (strlen(p_hidraw_path) >= MAX_PATH) || (p_entry == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_hidraw_path=0x%p, p_entry=0x%p)\r\n", __func__, p_hidraw_path, p_entry);
+        err = ERR_INVALID_PARAM;
+        goto GET_HIDRAW_IDENTITY_EXIT;
+    }
+
+    if((stat(p_hidraw_path, &node_stat) != 0) || (S_ISCHR(node_stat.st_mode) == 0))
+    {
+        err = ERR_DEVICE_NOT_FOUND;
+        goto GET_HIDRAW_IDENTITY_EXIT;
+    }
+
+    p_node_name = strrchr(p_hidraw_path, '/');
+    p_node_name = (p_node_name == NULL) ? p_hidraw_path : (p_node_name + 1);
+    snprintf(sysfs_link_path, sizeof(sysfs_link_path), "%s/%s/device", DEVICE_CACHE_SYSFS_HIDRAW_DIR, p_node_name);
+    if((realpath(sysfs_link_path, sysfs_path) == NULL) || (strlen(sysfs_path) >= sizeof(p_entry->sysfs_path)))
+    {
+        err = ERR_DEVICE_NOT_FOUND;
+        goto GET_HIDRAW_IDENTITY_EXIT;
+    }
+
+    strcpy(p_entry->hidraw_path, p_hidraw_path);
+    strcpy(p_entry->sysfs_path, sysfs_path);
+    p_entry->inode = (unsigned long)node_stat.st_ino;
+    p_entry->rdev = (unsigned long)node_stat.st_rdev;
+
+    // Success
+    err = ERR_SUCCESS;
+
+GET_HIDRAW_IDENTITY_EXIT:
+    return err;
+}
+
+// Cache File
+// Format: One Device per Line,
+// "<sysfs_path> <hidraw_path> <inode> <rdev> <vid> <pid> <bus_type> <hello_packet> <bc_bc_version> <fw_bc_version> <gen8_touch>" (IDs in Hex)
+static size_t read_device_cache(const char *p_cache_path)
+{
+    FILE *p_file = NULL;
+    char line[2 * MAX_PATH + 128] = {0};
+    size_t entry_count = 0;
+    struct device_cache_entry *p_entry = NULL;
+    unsigned int hello_packet = 0,
+                 bc_bc_version = 0,
+                 fw_bc_version = 0;
+    int gen8_touch = 0;
+
+    p_file = fopen(p_cache_path, "r");
+    if(p_file == NULL)
+        return 0;
+
+    while((entry_count < DEVICE_CACHE_ENTRY_COUNT_MAX) && (fgets(line, sizeof(line), p_file) != NULL))
+    {
+        p_entry = &g_device_cache[entry_count];
+        memset(p_entry, 0, sizeof(struct device_cache_entry));
+        if(sscanf(line, "%259s %259s %lu %lu %x %x %x %x %x %x %d", p_entry->sysfs_path, p_entry->hidraw_path, &p_entry->inode, &p_entry->rdev, \
+                  &p_entry->vid, &p_entry->pid, &p_entry->bus_type, &hello_packet, &bc_bc_version, &fw_bc_version, &gen8_touch) != 11)
+            continue; // Skip Broken Line
+
+        p_entry->hello_packet = (unsigned char)hello_packet;
+        p_entry->bc_bc_version = (unsigned short)bc_bc_version;
+        p_entry->fw_bc_version = (unsigned short)fw_bc_version;
+        p_entry->gen8_touch = (gen8_touch != 0);
+        entry_count++;
+    }
+    fclose(p_file);
+
+    return entry_count;
+}
+
+static int write_device_cache(const char *p_cache_path, size_t entry_count)
+{
+    int err = ERR_SUCCESS;
+    FILE *p_file = NULL;
+    char temp_path[MAX_PATH + 8] = {0};
+    size_t entry_index = 0;
+    const struct device_cache_entry *p_entry = NULL;
+
+    // Write Temp. File & Rename, Never Leave a Half-written Cache
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", p_cache_path);
+    p_file = fopen(temp_path, "w");
+    if(p_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Open \"%s\"!\r\n", __func__, temp_path);
+        err = ERR_FILE_IO_ERROR;
+        goto WRITE_DEVICE_CACHE_EXIT;
+    }
+
+    for(entry_index = 0; entry_index < entry_count; entry_index++)
+    {
+        p_entry = &g_device_cache[entry_index];
+        fprintf(p_file, "%s %s %lu %lu %04x %04x %02x %02x %04x %04x %d\n", p_entry->sysfs_path, p_entry->hidraw_path, p_entry->inode, p_entry->rdev, \
+                p_entry->vid, p_entry->pid, p_entry->bus_type, p_entry->hello_packet, p_entry->bc_bc_version, p_entry->fw_bc_version, \
+                (p_entry->gen8_touch) ? 1 : 0);
+    }
+
+    if((fclose(p_file) != 0) || (rename(temp_path, p_cache_path) != 0))
+    {
+        ERROR_PRINTF("%s: Fail to Write \"%s\"!\r\n", __func__, p_cache_path);
+        unlink(temp_path);
+        err = ERR_FILE_IO_ERROR;
+        goto WRITE_DEVICE_CACHE_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+WRITE_DEVICE_CACHE_EXIT:
+    return err;
+}
+
+// Find Cached Device with VID & PID (Any Elan Device if PID is ELAN_HID_FORCE_CONNECT_PID),
+// whose hidraw Node is still the Same (Inode, Device Number & sysfs Device Path).
+int find_device_cache_entry(const char *p_cache_path, unsigned int vid, unsigned int pid, struct device_cache_entry *p_entry)
+{
+    int err = ERR_SUCCESS;
+    size_t entry_count = 0,
+           entry_index = 0;
+    struct device_cache_entry identity;
+
+    // Validate Input Parameter
+    if((p_cache_path == NULL) || (p_entry == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_cache_path=0x%p, p_entry=0x%p)\r\n", __func__, p_cache_path, p_entry);
+        err = ERR_INVALID_PARAM;
+        goto FIND_DEVICE_CACHE_ENTRY_EXIT;
+    }
+
+    entry_count = read_device_cache(p_cache_path);
+    for(entry_index = 0; entry_index < entry_count; entry_index++)
+    {
+        if((g_device_cache[entry_index].vid != vid) || \
+           ((pid != ELAN_HID_FORCE_CONNECT_PID) && (g_device_cache[entry_index].pid != pid)))
+            continue;
+
+        memset(&identity, 0, sizeof(identity));
+        if(get_hidraw_identity(g_device_cache[entry_index].hidraw_path, &identity) != ERR_SUCCESS)
+            continue;
+        if((identity.inode != g_device_cache[entry_index].inode) || (identity.rdev != g_device_cache[entry_index].rdev) || \
+           (strcmp(identity.sysfs_path, g_device_cache[entry_index].sysfs_path) != 0))
+        {
+            DEBUG_PRINTF("%s: %s Changed since Cached.\r\n", __func__, g_device_cache[entry_index].hidraw_path);
+            continue;
+        }
+
+        *p_entry = g_device_cache[entry_index];
+        DEBUG_PRINTF("%s: Cached Device: %s (%s), PID=0x%04x, Hello Packet=0x%02x.\r\n", __func__, \
+                     p_entry->hidraw_path, p_entry->sysfs_path, p_entry->pid, p_entry->hello_packet);
+        err = ERR_SUCCESS;
+        goto FIND_DEVICE_CACHE_ENTRY_EXIT;
+    }
+
+    err = ERR_DATA_NOT_FOUND;
+
+FIND_DEVICE_CACHE_ENTRY_EXIT:
+    return err;
+}
+
+// Store Device (Replace Entry with Same sysfs Device Path)
+int store_device_cache_entry(const char *p_cache_path, const struct device_cache_entry *p_entry)
+{
+    int err = ERR_SUCCESS;
+    size_t entry_count = 0,
+           entry_index = 0;
+
+    // Validate Input Parameter
+    if((p_cache_path == NULL) || (p_entry == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_cache_path=0x%p, p_entry=0x%p)\r\n", __func__, p_cache_path, p_entry);
+        err = ERR_INVALID_PARAM;
+        goto STORE_DEVICE_CACHE_ENTRY_EXIT;
+    }
+
+    entry_count = read_device_cache(p_cache_path);
+    for(entry_index = 0; entry_index < entry_count; entry_index++)
+    {
+        if(strcmp(g_device_cache[entry_index].sysfs_path, p_entry->sysfs_path) == 0)
+            break;
+    }
+    if(entry_index == DEVICE_CACHE_ENTRY_COUNT_MAX) // Full => Drop Oldest
+    {
+        memmove(&g_device_cache[0], &g_device_cache[1], (DEVICE_CACHE_ENTRY_COUNT_MAX - 1) * sizeof(struct device_cache_entry));
+        entry_index = DEVICE_CACHE_ENTRY_COUNT_MAX - 1;
+    }
+    else if(entry_index == entry_count)
+    {
+        entry_count++;
+    }
+    g_device_cache[entry_index] = *p_entry;
+
+    err = write_device_cache(p_cache_path, entry_count);
+
+STORE_DEVICE_CACHE_ENTRY_EXIT:
+    return err;
+}
+
+// Remove Device (Classification May be Stale, e.g. after Failed Operation)
+int remove_device_cache_entry(const char *p_cache_path, const char *p_hidraw_path)
+{
+    int err = ERR_SUCCESS;
+    size_t entry_count = 0,
+           entry_index = 0,
+           keep_count = 0;
+
+    // Validate Input Parameter
+    if((p_cache_path == NULL) || (p_hidraw_path == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_cache_path=0x%p, p_hidraw_path=0x%p)\r\n", __func__, p_cache_path, p_hidraw_path);
+        err = ERR_INVALID_PARAM;
+        goto REMOVE_DEVICE_CACHE_ENTRY_EXIT;
+    }
+
+    entry_count = read_device_cache(p_cache_path);
+    for(entry_index = 0; entry_index < entry_count; entry_index++)
+    {
+        if(strcmp(g_device_cache[entry_index].hidraw_path, p_hidraw_path) == 0)
+            continue;
+        if(keep_count != entry_index)
+            g_device_cache[keep_count] = g_device_cache[entry_index];
+        keep_count++;
+    }
+
+    // Nothing Removed
+    if(keep_count == entry_count)
+        goto REMOVE_DEVICE_CACHE_ENTRY_EXIT;
+
+    err = write_device_cache(p_cache_path, keep_count);
+
+REMOVE_DEVICE_CACHE_ENTRY_EXIT:
+    return err;
+}
@@ -0,0 +1,334 @@
+/** @file
+
+  Implementation of Pen Debug Report Ring Capture for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Reports are read straight into slots of a preallocated memory-mapped ring file, so that a capture
+  can run for hours at full report rate with fixed memory and file size (oldest reports are overwritten).
+
+  Module Name:
+	ElanTsReportRing.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "ErrCode.h"
+#include "ElanTsHidUtility.h"
+#include "ElanTsReportRing.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Slot Size: Slot Header & Max. Input Report, Aligned to 16 Bytes
+#ifndef REPORT_RING_SLOT_SIZE
+#define REPORT_RING_SLOT_SIZE   ((offsetof(struct report_ring_slot, report) + ELAN_HID_INPUT_BUFFER_SIZE + 15) & ~((size_t)15))
+#endif //REPORT_RING_SLOT_SIZE
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Ring File (Memory-mapped)
+static int g_ring_fd = -1;
+static unsigned char *g_ring_base = NULL;
+static size_t g_ring_file_size = 0;
+static struct report_ring_header *g_ring_header = NULL;
+static struct report_ring_index_entry *g_ring_index = NULL;
+static unsigned char *g_ring_slot_base = NULL;
+
+// Stop Request (SIGINT / SIGTERM)
+static volatile sig_atomic_t g_report_ring_stop = 0;
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static unsigned long long get_monotonic_time_ns(void)
+{
+    struct timespec now_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &now_time);
+    return ((unsigned long long)now_time.tv_sec * 1000000000ULL) + (unsigned long long)now_time.tv_nsec;
+}
+
+static void report_ring_signal_handler(int signal_number)
+{
+    g_report_ring_stop = 1;
+}
+
+// Ring File
+int open_report_ring(const char *p_ring_path, unsigned int ring_size_mb)
+{
+    int err = ERR_SUCCESS;
+    unsigned long long ring_size = 0,
+                       slot_count = 0,
+                       index_count = 0,
+                       slot_offset = 0;
+
+    // Validate Input Parameter
+    if((p_ring_path == NULL) || (ring_size_mb == 0) || (ring_size_mb > REPORT_RING_MAX_SIZE_MB))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_ring_path=0x%p, ring_size_mb=%u)\r\n", __func__, p_ring_path, ring_size_mb);
+        err = ERR_INVALID_PARAM;
+        goto OPEN_REPORT_RING_EXIT;
+    }
+
+    if(g_ring_base != NULL) // Already Opened
+        close_report_ring();
+
+    // Geometry: Whole Index Intervals of Slots, Slots Page-aligned after Index
+    ring_size = (unsigned long long)ring_size_mb * 1024 * 1024;
+    slot_count = (ring_size - REPORT_RING_HEADER_SIZE) / REPORT_RING_SLOT_SIZE;
+    slot_count -= slot_count % REPORT_RING_INDEX_INTERVAL;
+    while(slot_count > 0)
+    {
+        index_count = slot_count / REPORT_RING_INDEX_INTERVAL;
+        slot_offset = REPORT_RING_HEADER_SIZE + index_count * sizeof(struct report_ring_index_entry);
+        slot_offset = (slot_offset + REPORT_RING_HEADER_SIZE - 1) / REPORT_RING_HEADER_SIZE * REPORT_RING_HEADER_SIZE;
+        if(slot_offset + slot_count * REPORT_RING_SLOT_SIZE <= ring_size)
+            break;
+        slot_count -= REPORT_RING_INDEX_INTERVAL;
+    }
+    if(slot_count == 0)
+    {
+        ERROR_PRINTF("%s: Ring Size Too Small! (%u MB)\r\n", __func__, ring_size_mb);
+        err = ERR_INVALID_PARAM;
+        goto OPEN_REPORT_RING_EXIT;
+    }
+    g_ring_file_size = (size_t)(slot_offset + slot_count * REPORT_RING_SLOT_SIZE);
+
+    // Preallocate, so that Writes through Mapping never Fail on Full Disk
+    g_ring_fd = open(p_ring_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(g_ring_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Open \"%s\"!\r\n", __func__, p_ring_path);
+        err = ERR_FILE_IO_ERROR;
+        goto OPEN_REPORT_RING_EXIT;
+    }
+    if(posix_fallocate(g_ring_fd, 0, (off_t)g_ring_file_size) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to Allocate %lu Bytes for \"%s\"!\r\n", __func__, g_ring_file_size, p_ring_path);
+        err = ERR_FILE_IO_ERROR;
+        goto OPEN_REPORT_RING_EXIT_CLOSE;
+    }
+
+    g_ring_base = (unsigned char *)mmap(NULL, g_ring_file_size, PROT_READ | PROT_WRITE, MAP_SHARED, g_ring_fd, 0);
+    if(g_ring_base == MAP_FAILED)
+    {
+        ERROR_PRINTF("%s: Fail to Map \"%s\"!\r\n", __func__, p_ring_path);
+        g_ring_base = NULL;
+        err = ERR_FILE_IO_ERROR;
+        goto OPEN_REPORT_RING_EXIT_CLOSE;
+    }
+
+    g_ring_header = (struct report_ring_header *)g_ring_base;
+    g_ring_index = (struct report_ring_index_entry *)(g_ring_base + REPORT_RING_HEADER_SIZE);
+    g_ring_slot_base = g_ring_base + slot_offset;
+
+    memset(g_ring_header, 0, REPORT_RING_HEADER_SIZE);
+    memcpy(g_ring_header->magic, REPORT_RING_MAGIC, sizeof(g_ring_header->magic));
+    g_ring_header->version = REPORT_RING_VERSION;
+    g_ring_header->slot_size = REPORT_RING_SLOT_SIZE;
+    g_ring_header->slot_count = slot_count;
+    g_ring_header->slot_offset = slot_offset;
+    g_ring_header->index_interval = REPORT_RING_INDEX_INTERVAL;
+    g_ring_header->index_count = (unsigned int)index_count;
+    g_ring_header->index_offset = REPORT_RING_HEADER_SIZE;
+    g_ring_header->start_time_ns = get_monotonic_time_ns();
+    g_ring_header->write_sequence = 0;
+    g_ring_header->oldest_sequence = 0;
+    DEBUG_PRINTF("%s: Ring \"%s\": %llu Slots (%u Bytes), %u Index Entries, %lu Bytes.\r\n", __func__, \
+                 p_ring_path, slot_count, (unsigned int)REPORT_RING_SLOT_SIZE, (unsigned int)index_count, g_ring_file_size);
+
+    // Success
+    err = ERR_SUCCESS;
+    goto OPEN_REPORT_RING_EXIT;
+
+OPEN_REPORT_RING_EXIT_CLOSE:
+    close(g_ring_fd);
+    g_ring_fd = -1;
+
+OPEN_REPORT_RING_EXIT:
+    return err;
+}
+
+int close_report_ring(void)
+{
+    int err = ERR_SUCCESS;
+
+    if(g_ring_base != NULL)
+    {
+        if(msync(g_ring_base, g_ring_file_size, MS_SYNC) != 0)
+            err = ERR_FILE_IO_ERROR;
+        munmap(g_ring_base, g_ring_file_size);
+        g_ring_base = NULL;
+    }
+    if(g_ring_fd >= 0)
+    {
+        close(g_ring_fd);
+        g_ring_fd = -1;
+    }
+    g_ring_header = NULL;
+    g_ring_index = NULL;
+    g_ring_slot_base = NULL;
+    g_ring_file_size = 0;
+
+    return err;
+}
+
+// Capture
+// Read One Report straight into Next Slot; Committed only if Report ID Matched (ERR_DATA_PATTERN Otherwise).
+// Once the Ring Wrapped, the Next Slot Holds the Oldest Report, which is Dropped from Valid Window
+// (oldest_sequence) before the Read, so Readers never Take a Torn or Skipped Report for It.
+int capture_report_to_ring(unsigned char report_id, int timeout_ms)
+{
+    int err = ERR_SUCCESS,
+        report_size = 0;
+    unsigned long long sequence = 0,
+                       time_ns = 0;
+    struct report_ring_slot *p_slot = NULL;
+    struct report_ring_index_entry *p_index_entry = NULL;
+
+    if(g_ring_base == NULL)
+    {
+        err = ERR_NO_INTERFACE_CREATED;
+        goto CAPTURE_REPORT_TO_RING_EXIT;
+    }
+
+    sequence = g_ring_header->write_sequence;
+    p_slot = (struct report_ring_slot *)(g_ring_slot_base + (sequence % g_ring_header->slot_count) * REPORT_RING_SLOT_SIZE);
+
+    // Recycle Slot (Once per Sequence, a Skipped Report Leaves It out of Valid Window)
+    if((sequence >= g_ring_header->slot_count) && (g_ring_header->oldest_sequence <= (sequence - g_ring_header->slot_count)))
+    {
+        g_ring_header->oldest_sequence = sequence - g_ring_header->slot_count + 1;
+        __sync_synchronize();
+    }
+
+    err = __hidraw_read_report(p_slot->report, REPORT_RING_SLOT_SIZE - offsetof(struct report_ring_slot, report), &report_size, timeout_ms);
+    if(err != ERR_SUCCESS)
+        goto CAPTURE_REPORT_TO_RING_EXIT;
+    time_ns = get_monotonic_time_ns(); // Arrival Time
+
+    if((report_size <= 0) || (p_slot->report[0] != report_id))
+    {
+        err = ERR_DATA_PATTERN;
+        goto CAPTURE_REPORT_TO_RING_EXIT;
+    }
+    p_slot->time_ns = time_ns;
+    p_slot->report_size = (unsigned short)report_size;
+
+    if((sequence % REPORT_RING_INDEX_INTERVAL) == 0)
+    {
+        p_index_entry = &g_ring_index[(sequence / REPORT_RING_INDEX_INTERVAL) % g_ring_header->index_count];
+        p_index_entry->sequence = sequence;
+        p_index_entry->time_ns = time_ns;
+    }
+
+    // Publish Slot to Readers of Ring File
+    __sync_synchronize();
+    g_ring_header->write_sequence = sequence + 1;
+
+CAPTURE_REPORT_TO_RING_EXIT:
+    return err;
+}
+
+// Capture Pen Debug Reports until SIGINT / SIGTERM
+int capture_pen_debug_reports(const char *p_ring_path, unsigned int ring_size_mb, message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS;
+    struct sigaction action,
+                     old_int_action,
+                     old_term_action;
+    unsigned long long start_time_ns = 0,
+                       flush_time_ns = 0,
+                       now_time_ns = 0,
+                       captured_count = 0,
+                       window_count = 0,
+                       skipped_count = 0;
+
+    err = open_report_ring(p_ring_path, ring_size_mb);
+    if(err != ERR_SUCCESS)
+        goto CAPTURE_PEN_DEBUG_REPORTS_EXIT;
+
+    // Stop on SIGINT / SIGTERM (No SA_RESTART, so that select() is interrupted)
+    g_report_ring_stop = 0;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = report_ring_signal_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &old_int_action);
+    sigaction(SIGTERM, &action, &old_term_action);
+
+    if(msg_mode == FULL_MESSAGE)
+        printf("Capture pen debug reports to \"%s\" (%llu slots, Ctrl-C to stop)...\r\n", p_ring_path, g_ring_header->slot_count);
+
+    start_time_ns = get_monotonic_time_ns();
+    flush_time_ns = start_time_ns;
+    while(g_report_ring_stop == 0)
+    {
+        err = capture_report_to_ring(ELAN_HID_PEN_DEBUG_REPORT_ID, REPORT_RING_READ_TIMEOUT_MSEC);
+        if(err == ERR_SUCCESS)
+        {
+            captured_count++;
+            window_count++;
+        }
+        else if(err == ERR_DATA_PATTERN)
+        {
+            skipped_count++;
+        }
+        else if(err != ERR_IO_TIMEOUT)
+        {
+            if(g_report_ring_stop != 0) // Interrupted by Stop Request
+                break;
+            ERROR_PRINTF("%s: Fail to Capture Report! err=0x%x.\r\n", __func__, err);
+            goto CAPTURE_PEN_DEBUG_REPORTS_RESTORE_SIGNAL;
+        }
+
+        // Flush Dirty Pages in Background & Show Progress
+        now_time_ns = get_monotonic_time_ns();
+        if(now_time_ns - flush_time_ns >= (unsigned long long)REPORT_RING_FLUSH_INTERVAL_MSEC * 1000000ULL)
+        {
+            msync(g_ring_base, g_ring_file_size, MS_ASYNC);
+            if(msg_mode == FULL_MESSAGE)
+            {
+                printf("[%7.1fs] pen_debug: %llu reports, %.1f Hz%s\r\n", (double)(now_time_ns - start_time_ns) / 1000000000.0, \
+                       captured_count, (double)window_count * 1000000000.0 / (double)(now_time_ns - flush_time_ns), \
+                       (g_ring_header->oldest_sequence > 0) ? ", ring wrapped" : "");
+            }
+            window_count = 0;
+            flush_time_ns = now_time_ns;
+        }
+    }
+
+    // Summary
+    printf("Captured %llu pen debug reports to \"%s\"", captured_count, p_ring_path);
+    if(g_ring_header->oldest_sequence > 0)
+        printf(" (oldest %llu overwritten)", g_ring_header->oldest_sequence);
+    printf(".\r\n");
+    DEBUG_PRINTF("%s: %llu Other Report(s) Skipped.\r\n", __func__, skipped_count);
+
+    // Success
+    err = ERR_SUCCESS;
+
+CAPTURE_PEN_DEBUG_REPORTS_RESTORE_SIGNAL:
+    sigaction(SIGINT, &old_int_action, NULL);
+    sigaction(SIGTERM, &old_term_action, NULL);
+
+    if((close_report_ring() != ERR_SUCCESS) && (err == ERR_SUCCESS))
+        err = ERR_FILE_IO_ERROR;
+
+CAPTURE_PEN_DEBUG_REPORTS_EXIT:
+    return err;
+}
@@ -0,0 +1,406 @@
+/** @file
+
+  Implementation of Touch Report Streaming & Report Rate Analyzer for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Finger, pen and pen debug reports are read as they arrive and timestamped with CLOCK_MONOTONIC,
+  for report rate, inter-report interval (jitter) histogram and dropped report estimation.
+
+  Module Name:
+	ElanTsReportStream.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include "ErrCode.h"
+#include "ElanTsHidUtility.h"
+#include "ElanTsReportStream.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Report Type Names (Same Order as report_type_t)
+static const char *g_report_type_name[REPORT_TYPE_COUNT] = { "finger", "pen", "pen_debug" };
+
+// Stop Request (SIGINT / SIGTERM)
+static volatile sig_atomic_t g_report_stream_stop = 0;
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static unsigned long long get_monotonic_time_ns(void)
+{
+    struct timespec now_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &now_time);
+    return ((unsigned long long)now_time.tv_sec * 1000000000ULL) + (unsigned long long)now_time.tv_nsec;
+}
+
+static void report_stream_signal_handler(int signal_number)
+{
+    g_report_stream_stop = 1;
+}
+
+// Finger Report
+int decode_finger_report(const unsigned char *p_report, size_t report_size, struct finger_report *p_finger_report)
+{
+    int err = ERR_SUCCESS;
+    size_t contact_index = 0;
+    const unsigned char *p_contact = NULL;
+
+    // Validate Input Parameter
+    if((p_report == NULL) || (report_size <= ELAN_FINGER_REPORT_CONTACT_COUNT_OFFSET) || (p_finger_report == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_report=0x%p, report_size=%ld, p_finger_report=0x%p)\r\n", __func__, p_report, report_size, p_finger_report);
+        err = ERR_INVALID_PARAM;
+        goto DECODE_FINGER_REPORT_EXIT;
+    }
+
+    if(p_report[0] != ELAN_HID_FINGER_REPORT_ID)
+    {
+        err = ERR_DATA_PATTERN;
+        goto DECODE_FINGER_REPORT_EXIT;
+    }
+
+    for(contact_index = 0; contact_index < ELAN_FINGER_REPORT_CONTACT_COUNT_MAX; contact_index++)
+    {
+        p_contact = &p_report[ELAN_FINGER_REPORT_CONTACT_OFFSET + contact_index * ELAN_FINGER_REPORT_CONTACT_SIZE];
+        p_finger_report->contact[contact_index].tip = ((p_contact[0] & ELAN_FINGER_CONTACT_TIP_SWITCH) != 0);
+        p_finger_report->contact[contact_index].contact_id = p_contact[1];
+        p_finger_report->contact[contact_index].x = (unsigned short)(p_contact[2] | (p_contact[3] << 8));
+        p_finger_report->contact[contact_index].y = (unsigned short)(p_contact[4] | (p_contact[5] << 8));
+    }
+    p_finger_report->scan_time = (unsigned short)(p_report[ELAN_FINGER_REPORT_SCAN_TIME_OFFSET] | (p_report[ELAN_FINGER_REPORT_SCAN_TIME_OFFSET + 1] << 8));
+    p_finger_report->contact_count = p_report[ELAN_FINGER_REPORT_CONTACT_COUNT_OFFSET];
+
+    // Success
+    err = ERR_SUCCESS;
+
+DECODE_FINGER_REPORT_EXIT:
+    return err;
+}
+
+// Statistics
+void reset_report_stream_stats(struct report_stream_stats *p_stats)
+{
+    memset(p_stats, 0, sizeof(struct report_stream_stats));
+}
+
+void add_report_stream_sample(struct report_stream_stats *p_stats, unsigned long long time_ns)
+{
+    unsigned long long interval_ns = 0;
+    size_t bucket_index = 0;
+
+    if(p_stats->report_count == 0)
+        p_stats->first_time_ns = time_ns;
+    else
+        interval_ns = time_ns - p_stats->last_time_ns;
+    p_stats->report_count++;
+    p_stats->last_time_ns = time_ns;
+
+    // Skip First Report & Idle Gaps
+    if((p_stats->report_count == 1) || (interval_ns > (unsigned long long)REPORT_STREAM_IDLE_GAP_MSEC * 1000000ULL))
+        return;
+
+    if((p_stats->interval_count == 0) || (interval_ns < p_stats->interval_min_ns))
+        p_stats->interval_min_ns = interval_ns;
+    if(interval_ns > p_stats->interval_max_ns)
+        p_stats->interval_max_ns = interval_ns;
+    p_stats->interval_sum_ns += interval_ns;
+    p_stats->interval_count++;
+
+    bucket_index = (size_t)(interval_ns / (REPORT_INTERVAL_BUCKET_US * 1000ULL));
+    if(bucket_index >= REPORT_INTERVAL_BUCKET_COUNT)
+        bucket_index = REPORT_INTERVAL_BUCKET_COUNT - 1;
+    p_stats->histogram[bucket_index]++;
+}
+
+// Nominal Interval: Center of Median Bucket
+unsigned long long get_nominal_report_interval_ns(const struct report_stream_stats *p_stats)
+{
+    unsigned long long count = 0;
+    size_t bucket_index = 0;
+
+    if(p_stats->interval_count == 0)
+        return 0;
+
+    for(bucket_index = 0; bucket_index < REPORT_INTERVAL_BUCKET_COUNT; bucket_index++)
+    {
+        count += p_stats->histogram[bucket_index];
+        if(count * 2 >= p_stats->interval_count)
+            break;
+    }
+
+    return (bucket_index * 2 + 1) * REPORT_INTERVAL_BUCKET_US * 1000ULL / 2;
+}
+
+// Dropped Reports: Each Interval Much Longer than Nominal Hides (Interval / Nominal - 1) Reports
+unsigned long long estimate_dropped_reports(const struct report_stream_stats *p_stats)
+{
+    unsigned long long nominal_ns = 0,
+                       center_ns = 0,
+                       dropped = 0;
+    size_t bucket_index = 0;
+
+    nominal_ns = get_nominal_report_interval_ns(p_stats);
+    if(nominal_ns == 0)
+        return 0;
+
+    for(bucket_index = 0; bucket_index < REPORT_INTERVAL_BUCKET_COUNT; bucket_index++)
+    {
+        center_ns = (bucket_index * 2 + 1) * REPORT_INTERVAL_BUCKET_US * 1000ULL / 2;
+        if((p_stats->histogram[bucket_index] == 0) || (center_ns * 100 <= nominal_ns * REPORT_DROP_THRESHOLD_PERCENT))
+            continue;
+        dropped += p_stats->histogram[bucket_index] * ((center_ns + nominal_ns / 2) / nominal_ns - 1);
+    }
+
+    return dropped;
+}
+
+static void show_report_stream_stats(const char *p_name, const struct report_stream_stats *p_stats)
+{
+    unsigned long long duration_ns = 0;
+    double rate = 0.0;
+
+    if(p_stats->report_count == 0)
+        return;
+
+    duration_ns = p_stats->last_time_ns - p_stats->first_time_ns;
+    if(duration_ns > 0)
+        rate = (double)(p_stats->report_count - 1) * 1000000000.0 / (double)duration_ns;
+
+    printf("%s: %llu reports, %.1f Hz", p_name, p_stats->report_count, rate);
+    if(p_stats->interval_count > 0)
+    {
+        printf(", interval avg %.2f ms (min %.2f, max %.2f), dropped ~%llu", \
+               (double)p_stats->interval_sum_ns / (double)p_stats->interval_count / 1000000.0, \
+               (double)p_stats->interval_min_ns / 1000000.0, (double)p_stats->interval_max_ns / 1000000.0, \
+               estimate_dropped_reports(p_stats));
+    }
+}
+
+static void show_report_interval_histogram(const char *p_name, const struct report_stream_stats *p_stats)
+{
+    size_t bucket_index = 0;
+
+    if(p_stats->interval_count == 0)
+        return;
+
+    printf("%s interval histogram (nominal %.2f ms):\r\n", p_name, (double)get_nominal_report_interval_ns(p_stats) / 1000000.0);
+    for(bucket_index = 0; bucket_index < REPORT_INTERVAL_BUCKET_COUNT; bucket_index++)
+    {
+        if(p_stats->histogram[bucket_index] == 0)
+            continue;
+        if(bucket_index == REPORT_INTERVAL_BUCKET_COUNT - 1)
+            printf("  >= %6.2f ms: %llu\r\n", (double)(bucket_index * REPORT_INTERVAL_BUCKET_US) / 1000.0, p_stats->histogram[bucket_index]);
+        else
+            printf("  %6.2f ~ %6.2f ms: %llu\r\n", (double)(bucket_index * REPORT_INTERVAL_BUCKET_US) / 1000.0, \
+                   (double)((bucket_index + 1) * REPORT_INTERVAL_BUCKET_US) / 1000.0, p_stats->histogram[bucket_index]);
+    }
+}
+
+static int write_capture_record(FILE *p_file, unsigned long long time_ns, const unsigned char *p_report, size_t report_size)
+{
+    unsigned char time_buf[8] = {0};
+    size_t byte_index = 0;
+
+    for(byte_index = 0; byte_index < sizeof(time_buf); byte_index++)
+        time_buf[byte_index] = (unsigned char)(time_ns >> (8 * byte_index));
+
+    if((fwrite(time_buf, 1, sizeof(time_buf), p_file) != sizeof(time_buf)) || \
+       (fwrite(p_report, 1, report_size, p_file) != report_size))
+        return ERR_FILE_IO_ERROR;
+
+    return ERR_SUCCESS;
+}
+
+// Streaming
+// Read Reports until Duration (0: Until SIGINT / SIGTERM), Show Live Statistics every Second.
+int stream_reports(unsigned int duration_sec, const char *p_capture_path, message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS;
+    FILE *p_capture_file = NULL;
+    unsigned char report[ELAN_HID_INPUT_BUFFER_SIZE] = {0},
+                  header[12] = {0};
+    struct report_stream_stats total_stats[REPORT_TYPE_COUNT],
+                               window_stats[REPORT_TYPE_COUNT];
+    struct finger_report finger_report,
+                         last_finger_frame;
+    struct sigaction action,
+                     old_int_action,
+                     old_term_action;
+    unsigned long long start_time_ns = 0,
+                       show_time_ns = 0,
+                       now_time_ns = 0,
+                       other_report_count = 0;
+    int type_index = 0;
+    size_t contact_index = 0;
+    report_type_t type = REPORT_TYPE_FINGER;
+
+    for(type_index = 0; type_index < REPORT_TYPE_COUNT; type_index++)
+    {
+        reset_report_stream_stats(&total_stats[type_index]);
+        reset_report_stream_stats(&window_stats[type_index]);
+    }
+    memset(&last_finger_frame, 0, sizeof(last_finger_frame));
+
+    // Binary Capture
+    if((p_capture_path != NULL) && (strlen(p_capture_path) > 0))
+    {
+        p_capture_file = fopen(p_capture_path, "wb");
+        if(p_capture_file == NULL)
+        {
+            ERROR_PRINTF("%s: Fail to Open Capture File \"%s\"!\r\n", __func__, p_capture_path);
+            err = ERR_FILE_IO_ERROR;
+            goto STREAM_REPORTS_EXIT;
+        }
+        memcpy(header, REPORT_CAPTURE_MAGIC, 8);
+        header[8] = (unsigned char)(sizeof(report) & 0xFF);
+        header[9] = (unsigned char)((sizeof(report) >> 8) & 0xFF);
+        if(fwrite(header, 1, sizeof(header), p_capture_file) != sizeof(header))
+        {
+            ERROR_PRINTF("%s: Fail to Write Capture File \"%s\"!\r\n", __func__, p_capture_path);
+            err = ERR_FILE_IO_ERROR;
+            goto STREAM_REPORTS_EXIT;
+        }
+    }
+
+    // Stop on SIGINT / SIGTERM (No SA_RESTART, so that select() is interrupted)
+    g_report_stream_stop = 0;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = report_stream_signal_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &old_int_action);
+    sigaction(SIGTERM, &action, &old_term_action);
+
+    if(msg_mode == FULL_MESSAGE)
+    {
+        if(duration_sec == 0)
+            printf("Stream touch reports (Ctrl-C to stop)...\r\n");
+        else
+            printf("Stream touch reports for %u second(s)...\r\n", duration_sec);
+    }
+
+    start_time_ns = get_monotonic_time_ns();
+    show_time_ns = start_time_ns;
+    while(g_report_stream_stop == 0)
+    {
+        now_time_ns = get_monotonic_time_ns();
+        if((duration_sec > 0) && (now_time_ns - start_time_ns >= (unsigned long long)duration_sec * 1000000000ULL))
+            break;
+
+        // Live Statistics of Last Window
+        if(now_time_ns - show_time_ns >= (unsigned long long)REPORT_STREAM_SHOW_INTERVAL_MSEC * 1000000ULL)
+        {
+            for(type_index = 0; type_index < REPORT_TYPE_COUNT; type_index++)
+            {
+                if((msg_mode == FULL_MESSAGE) && (window_stats[type_index].report_count > 0))
+                {
+                    printf("[%7.1fs] ", (double)(now_time_ns - start_time_ns) / 1000000000.0);
+                    show_report_stream_stats(g_report_type_name[type_index], &window_stats[type_index]);
+                    if((type_index == REPORT_TYPE_FINGER) && (last_finger_frame.contact_count > 0))
+                    {
+                        printf(", contacts %u", last_finger_frame.contact_count);
+                        for(contact_index = 0; contact_index < ELAN_FINGER_REPORT_CONTACT_COUNT_MAX; contact_index++)
+                        {
+                            if(last_finger_frame.contact[contact_index].tip)
+                                printf(" #%u(%u,%u)", last_finger_frame.contact[contact_index].contact_id, \
+                                       last_finger_frame.contact[contact_index].x, last_finger_frame.contact[contact_index].y);
+                        }
+                    }
+                    printf("\r\n");
+                }
+                reset_report_stream_stats(&window_stats[type_index]);
+            }
+            show_time_ns = now_time_ns;
+        }
+
+        err = __hidraw_read(report, sizeof(report), REPORT_STREAM_READ_TIMEOUT_MSEC);
+        now_time_ns = get_monotonic_time_ns(); // Arrival Time
+        if(err == ERR_IO_TIMEOUT)
+            continue;
+        if(err != ERR_SUCCESS)
+        {
+            if(g_report_stream_stop != 0) // Interrupted by Stop Request
+                break;
+            ERROR_PRINTF("%s: Fail to Read Report! err=0x%x.\r\n", __func__, err);
+            goto STREAM_REPORTS_RESTORE_SIGNAL;
+        }
+
+        switch(report[0])
+        {
+            case ELAN_HID_FINGER_REPORT_ID:
+                type = REPORT_TYPE_FINGER;
+                break;
+            case ELAN_HID_PEN_REPORT_ID:
+                type = REPORT_TYPE_PEN;
+                break;
+            case ELAN_HID_PEN_DEBUG_REPORT_ID:
+                type = REPORT_TYPE_PEN_DEBUG;
+                break;
+            default: // e.g. Command Response of Other Process
+                other_report_count++;
+                continue;
+        }
+
+        if(p_capture_file != NULL)
+        {
+            err = write_capture_record(p_capture_file, now_time_ns, report, sizeof(report));
+            if(err != ERR_SUCCESS)
+            {
+                ERROR_PRINTF("%s: Fail to Write Capture File \"%s\"!\r\n", __func__, p_capture_path);
+                goto STREAM_REPORTS_RESTORE_SIGNAL;
+            }
+        }
+
+        if(type == REPORT_TYPE_FINGER)
+        {
+            // Count Frames (Following Reports of Hybrid Mode have No Contact Count)
+            if((decode_finger_report(report, sizeof(report), &finger_report) != ERR_SUCCESS) || (finger_report.contact_count == 0))
+                continue;
+            last_finger_frame = finger_report;
+            DEBUG_PRINTF("%s: Finger Frame: Contact Count %u, Scan Time %u.\r\n", __func__, finger_report.contact_count, finger_report.scan_time);
+        }
+        add_report_stream_sample(&total_stats[type], now_time_ns);
+        add_report_stream_sample(&window_stats[type], now_time_ns);
+    }
+
+    // Summary
+    for(type_index = 0; type_index < REPORT_TYPE_COUNT; type_index++)
+    {
+        if(total_stats[type_index].report_count == 0)
+            continue;
+        printf("Total ");
+        show_report_stream_stats(g_report_type_name[type_index], &total_stats[type_index]);
+        printf("\r\n");
+        if(msg_mode == FULL_MESSAGE)
+            show_report_interval_histogram(g_report_type_name[type_index], &total_stats[type_index]);
+    }
+    if(other_report_count > 0)
+        DEBUG_PRINTF("%s: %llu Other Report(s) Skipped.\r\n", __func__, other_report_count);
+
+    // Success
+    err = ERR_SUCCESS;
+
+STREAM_REPORTS_RESTORE_SIGNAL:
+    sigaction(SIGINT, &old_int_action, NULL);
+    sigaction(SIGTERM, &old_term_action, NULL);
+
+STREAM_REPORTS_EXIT:
+    if(p_capture_file != NULL)
+    {
+        if((fclose(p_capture_file) != 0) && (err == ERR_SUCCESS))
+            err = ERR_FILE_IO_ERROR;
+    }
+
+    return err;
+}
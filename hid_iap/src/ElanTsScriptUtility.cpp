@@ -0,0 +1,193 @@
+/** @file
+
+  Implementation of Session Script Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsScriptUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ErrCode.h"
+#include "ElanTsScriptUtility.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Command Line
+int parse_script_line(char *p_line, char **pp_argv, int argv_size, int *p_argc)
+{
+    int err = ERR_SUCCESS,
+        argc = 0;
+    char *p_token = NULL,
+         *p_comment = NULL;
+
+    // Validate Input Parameter
+    if ((p_line == NULL) || (pp_argv == NULL) || (argv_size <= 0) || (p_argc == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_line=0x%p, pp_argv=0x%p, argv_size=%d, p_argc=0x%p)\r\n", \
+                     __func__, p_line, pp_argv, argv_size, p_argc);
+        err = ERR_INVALID_PARAM;
+        goto PARSE_SCRIPT_LINE_EXIT;
+    }
+
+    // Strip Comment
+    p_comment = strchr(p_line, SCRIPT_COMMENT_CHAR);
+    if (p_comment != NULL)
+        *p_comment = '\0';
+
+    // Space-separated Tokens (Line is Modified in Place)
+    for (p_token = strtok(p_line, " \t\r\n"); p_token != NULL; p_token = strtok(NULL, " \t\r\n"))
+    {
+        if (argc >= argv_size)
+        {
+            ERROR_PRINTF("%s: Too Many Arguments! (Max. %d)\r\n", __func__, argv_size - 1);
+            err = ERR_INVALID_PARAM;
+            goto PARSE_SCRIPT_LINE_EXIT;
+        }
+        pp_argv[argc++] = p_token;
+    }
+
+    *p_argc = argc;
+
+PARSE_SCRIPT_LINE_EXIT:
+    return err;
+}
+
+void show_script_command_usage(const struct script_command *p_cmd_table, size_t cmd_table_count)
+{
+    size_t table_index = 0;
+
+    if (p_cmd_table == NULL)
+        return;
+
+    printf("Script Commands (One per Line, '%c' for Comment):\r\n", SCRIPT_COMMENT_CHAR);
+    for (table_index = 0; table_index < cmd_table_count; table_index++)
+        printf("  %s\r\n", p_cmd_table[table_index].usage);
+
+    return;
+}
+
+// Script
+int run_session_script(const char *p_script_path, const struct script_command *p_cmd_table, size_t cmd_table_count, \
+                       struct touch_session *p_session, message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS,
+        argc = 0,
+        line_number = 0,
+        command_count = 0;
+    char line[SCRIPT_LINE_LENGTH_MAX] = {0},
+         *argv[SCRIPT_ARG_COUNT_MAX] = {NULL};
+    size_t table_index = 0;
+    const struct script_command *p_cmd = NULL;
+    bool from_stdin = false;
+    FILE *fp_script = NULL;
+    struct timespec start_time,
+                    end_time;
+
+    // Validate Input Parameter
+    if ((p_script_path == NULL) || (p_cmd_table == NULL) || (p_session == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_script_path=0x%p, p_cmd_table=0x%p, p_session=0x%p)\r\n", \
+                     __func__, p_script_path, p_cmd_table, p_session);
+        err = ERR_INVALID_PARAM;
+        goto RUN_SESSION_SCRIPT_EXIT;
+    }
+
+    // Open Script (Read Line by Line, so Commands can also be Piped in)
+    from_stdin = (strcmp(p_script_path, SCRIPT_STDIN_PATH) == 0);
+    fp_script = (from_stdin) ? stdin : fopen(p_script_path, "r");
+    if (fp_script == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Open Script \"%s\"!\r\n", __func__, p_script_path);
+        err = ERR_FILE_NOT_FOUND;
+        goto RUN_SESSION_SCRIPT_EXIT;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    while (fgets(line, sizeof(line), fp_script) != NULL)
+    {
+        line_number++;
+
+        // Line Longer than Buffer
+        if ((strchr(line, '\n') == NULL) && (feof(fp_script) == 0))
+        {
+            ERROR_PRINTF("Script Line %d: Too Long! (Max. %d)\r\n", line_number, SCRIPT_LINE_LENGTH_MAX - 2);
+            err = ERR_INVALID_PARAM;
+            goto RUN_SESSION_SCRIPT_CLOSE;
+        }
+
+        err = parse_script_line(line, argv, SCRIPT_ARG_COUNT_MAX, &argc);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Script Line %d: Invalid Command Line!\r\n", line_number);
+            goto RUN_SESSION_SCRIPT_CLOSE;
+        }
+        if (argc == 0) // Empty Line or Comment
+            continue;
+
+        // Look up Command
+        p_cmd = NULL;
+        for (table_index = 0; table_index < cmd_table_count; table_index++)
+        {
+            if (strcmp(p_cmd_table[table_index].name, argv[0]) == 0)
+            {
+                p_cmd = &p_cmd_table[table_index];
+                break;
+            }
+        }
+        if (p_cmd == NULL)
+        {
+            ERROR_PRINTF("Script Line %d: Unknown Command \"%s\"!\r\n", line_number, argv[0]);
+            err = ERR_INVALID_PARAM;
+            goto RUN_SESSION_SCRIPT_CLOSE;
+        }
+        if (((argc - 1) < p_cmd->arg_count_min) || ((argc - 1) > p_cmd->arg_count_max))
+        {
+            ERROR_PRINTF("Script Line %d: Invalid Arguments! Usage: %s\r\n", line_number, p_cmd->usage);
+            err = ERR_INVALID_PARAM;
+            goto RUN_SESSION_SCRIPT_CLOSE;
+        }
+
+        // Run Command (Stop at First Failure)
+        if (msg_mode == FULL_MESSAGE)
+        {
+            printf("--------------------------------\r\n");
+            printf("[%d] %s\r\n", line_number, argv[0]);
+        }
+        err = p_cmd->run(p_session, argc, argv);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Script Line %d: Command \"%s\" Failed! err=0x%x.\r\n", line_number, argv[0], err);
+            goto RUN_SESSION_SCRIPT_CLOSE;
+        }
+        command_count++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+    if (msg_mode == FULL_MESSAGE)
+    {
+        printf("--------------------------------\r\n");
+        printf("Script Done: %d Command(s), %ldms.\r\n", command_count, \
+               (long)((end_time.tv_sec - start_time.tv_sec) * 1000 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000));
+    }
+
+RUN_SESSION_SCRIPT_CLOSE:
+    if ((fp_script != NULL) && (from_stdin == false))
+        fclose(fp_script);
+
+RUN_SESSION_SCRIPT_EXIT:
+    return err;
+}
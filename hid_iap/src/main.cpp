@@ -13,15 +13,30 @@
 #include <stdint.h>
 #include <string.h>
 #include <getopt.h>
+#include <time.h>
 #include <linux/input.h>    // BUS_TYPE
 #include "ElanTsDebug.h"
 #include "HIDLinuxGet.h"
+#include "ElanTsHidIo.h"
 #include "ElanTsHidUtility.h"
 #include "ElanTsFuncApi.h"
 #include "ElanTsFwFileIoUtility.h"
 #include "ElanTsFwUpdateFlow.h"
+#include "ElanTsFwCompress.h"
+#include "ElanTsFwBundle.h"
+#include "ElanTsGenTraits.h"
 #include "ElanGen8TsHidHwParameters.h"
 #include "ElanGen8TsFwUpdateFlow.h"
+#include "ElanGen8TsFuncApi.h"
+#include "ElanTsMemInfo.h"
+#include "ElanGen8TsMemInfo.h"
+#include "ElanTsQueryUtility.h"
+#include "ElanTsRetryUtility.h"
+#include "ElanTsTimingProfile.h"
+#include "ElanTsDeviceCache.h"
+#include "ElanTsReportStream.h"
+#include "ElanTsReportRing.h"
+#include "ElanTsScriptUtility.h"
 
 /*******************************************
  * Definitions
@@ -37,16 +52,40 @@
 #define ELAN_TOOL_SW_RELEASE_DATE	"2024-05-21"
 #endif //ELAN_TOOL_SW_RELEASE_DATE
 
+// Session Script: Default Timeout & Poll Interval of "wait-ready"
+#ifndef SCRIPT_WAIT_READY_TIMEOUT_MSEC
+#define SCRIPT_WAIT_READY_TIMEOUT_MSEC          5000
+#endif //SCRIPT_WAIT_READY_TIMEOUT_MSEC
+
+#ifndef SCRIPT_WAIT_READY_POLL_INTERVAL_MSEC
+#define SCRIPT_WAIT_READY_POLL_INTERVAL_MSEC    100
+#endif //SCRIPT_WAIT_READY_POLL_INTERVAL_MSEC
+
 /*******************************************
  * Feature Configurations
  ******************************************/
 
 /*******************************************
- * Global Variables Declaration
+ * Global Data Structure Declaration
  ******************************************/
 
-// InterfaceGet Class
-CHIDLinuxGet *g_pIntfGet = NULL; // Pointer to HID Inteface Class (CHIDLinuxGet)
+// Values Shared by Fields of One Query Record (Fetched on First Use)
+struct query_cache
+{
+    bool fw_info_fetched;
+    int fw_info_err;
+    unsigned short fw_id;
+    unsigned short fw_version;
+    unsigned short test_version;
+    unsigned short bc_version;
+    bool update_info_fetched;
+    int update_info_err;
+    struct update_info update_info;
+};
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
 
 // PID
 int g_pid = 0;
@@ -57,6 +96,9 @@ bool g_update_fw = false;
 // Firmware File Information
 char g_firmware_filename[FILE_NAME_LENGTH_MAX] = {0};
 
+// Flag for Firmware Verification (after FW Update)
+bool g_verify_fw = false;
+
 // Firmware Inforamtion
 bool g_get_fw_info = false;
 
@@ -75,17 +117,86 @@ message_mode_t	g_msg_mode = FULL_MESSAGE;
 // Help Info.
 bool g_help = false;
 
+// Flash Dump
+bool g_dump_flash = false;
+char g_dump_filename[FILE_NAME_LENGTH_MAX] = {0};
+bool g_dump_range_set = false;
+unsigned int g_dump_address = 0,
+             g_dump_size = 0;
+
+// Query (Multiple Fields in One Device Session)
+bool g_query = false;
+const struct query_field *g_query_field[QUERY_FIELD_COUNT_MAX] = {NULL};
+size_t g_query_field_count = 0;
+query_format_t g_query_format = QUERY_FORMAT_KEY_VALUE;
+struct query_cache g_query_cache;
+
+// Timing Profile (Learned Response Latencies)
+char g_timing_profile_path[FILE_NAME_LENGTH_MAX] = {0};
+
+// Device Cache (Discovery & Identification of Previous Runs)
+char g_device_cache_path[FILE_NAME_LENGTH_MAX] = {0};
+bool g_device_cache_hit = false;
+struct device_cache_entry g_device_cache_entry;
+
+// Device Lock (Max. Wait for Other Process)
+int g_lock_wait_ms = HID_DEVICE_LOCK_WAIT_MSEC;
+int g_lock_mode = HID_DEVICE_LOCK_EXCLUSIVE;
+
+// Touch Report Streaming (Report Rate / Jitter Analysis)
+bool g_stream_reports = false;
+unsigned int g_stream_duration_sec = 0;
+char g_capture_filename[FILE_NAME_LENGTH_MAX] = {0};
+
+// Pen Debug Report Capture (Memory-mapped Ring File)
+bool g_capture_pen_debug = false;
+char g_pen_debug_ring_path[FILE_NAME_LENGTH_MAX] = {0};
+unsigned int g_pen_debug_ring_size_mb = REPORT_RING_DEFAULT_SIZE_MB;
+
+// Session Script (Batch Commands over One Device Session)
+bool g_run_script = false;
+char g_script_path[FILE_NAME_LENGTH_MAX] = {0};
+
+// Firmware Compression (Offline, No Device)
+bool g_compress_fw = false;
+char g_compressed_filename[FILE_NAME_LENGTH_MAX] = {0};
+
+// Firmware Bundle (Image Selected by Information FWID after Device Opened)
+bool g_firmware_bundle = false;
+
+// Firmware Bundle Creation (Offline, No Device)
+bool g_create_bundle = false;
+char g_bundle_filename[FILE_NAME_LENGTH_MAX] = {0};
+struct fw_bundle_source g_bundle_source[ELAN_FW_BUNDLE_ENTRY_COUNT_MAX];
+int g_bundle_source_count = 0;
+
 // Parameter Option Settings
-const char* const short_options = "p:P:f:s:oikcqdh";
+const char* const short_options = "p:P:f:s:voikcu:r:Q:jR:T:C:W:m:b:g:G:x:z:B:qdh";
 const struct option long_options[] =
 {
     { "pid",                     1, NULL, 'p'},
     { "pid_hex",                 1, NULL, 'P'},
     { "file_path",               1, NULL, 'f'},
     { "skip_action",             1, NULL, 's'},
+    { "verify",                  0, NULL, 'v'},
     { "firmware_information",    0, NULL, 'i'},
     { "calibration",             0, NULL, 'k'},
     { "calibration_counter",     0, NULL, 'c'},
+    { "dump",                    1, NULL, 'u'},
+    { "dump_range",              1, NULL, 'r'},
+    { "query",                   1, NULL, 'Q'},
+    { "json",                    0, NULL, 'j'},
+    { "retry",                   1, NULL, 'R'},
+    { "timing_profile",          1, NULL, 'T'},
+    { "device_cache",            1, NULL, 'C'},
+    { "lock_wait",               1, NULL, 'W'},
+    { "stream_reports",          1, NULL, 'm'},
+    { "capture",                 1, NULL, 'b'},
+    { "pen_debug_ring",          1, NULL, 'g'},
+    { "pen_debug_ring_size",     1, NULL, 'G'},
+    { "script",                  1, NULL, 'x'},
+    { "compress",                1, NULL, 'z'},
+    { "bundle",                  1, NULL, 'B'},
     { "quiet",                   0, NULL, 'q'},
     { "debug",                   0, NULL, 'd'},
     { "help",                    0, NULL, 'h'},
@@ -95,132 +206,488 @@ const struct option long_options[] =
  * Function Prototype
  ******************************************/
 
+// Query Fields
+int fetch_query_fw_info(const struct touch_session *p_session);
+int fetch_query_update_info(const struct touch_session *p_session);
+int query_hello_packet(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_recovery(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_fw_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_fw_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_test_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_bc_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_info_fwid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_rek_counter(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_remark_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_update_counter(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_last_update_time(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+
+// Session Script Commands
+int script_info(struct touch_session *p_session, int argc, char **argv);
+int script_rek(struct touch_session *p_session, int argc, char **argv);
+int script_rek_counter(struct touch_session *p_session, int argc, char **argv);
+int script_update(struct touch_session *p_session, int argc, char **argv);
+int script_verify(struct touch_session *p_session, int argc, char **argv);
+int script_dump(struct touch_session *p_session, int argc, char **argv);
+int script_wait_ready(struct touch_session *p_session, int argc, char **argv);
+
 // Help
 void show_help_information(void);
 
-// HID Raw I/O Function
-int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
-int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
-
-// Abstract Device I/O Function
-int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
-int read_data(unsigned char *data_buf, int len, int timeout_ms);
-int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+// Device Function
 int open_device(void);
 int close_device(void);
+int update_device_cache(int session_err, unsigned char hello_packet, unsigned short bc_bc_version, unsigned short fw_bc_version, bool gen8_touch, bool recovery);
+int invalidate_device_cache(void);
 int get_bus_type(unsigned int *bus_type);
 int reconnect_device(void);
 
+// Touch Operations (Shared by Command Line & Session Script)
+int wait_device_ready(struct touch_session *p_session, int timeout_ms);
+int read_touch_info_fwid(const struct touch_session *p_session, unsigned short *p_info_fwid);
+int prepare_firmware_file(const char *p_firmware_filename, const struct touch_session *p_session);
+int parse_bundle_source(char *p_source_str, struct fw_bundle_source *p_source);
+int parse_dump_range(const char *p_range, unsigned int *p_address, unsigned int *p_size);
+int run_flash_dump(const struct touch_session *p_session, const char *p_dump_filename, bool dump_range_set, unsigned int dump_address, unsigned int dump_size);
+int run_firmware_update(bool gen8_touch, bool recovery, int skip_action_code);
+int run_firmware_verification(bool gen8_touch);
+
 // Default Function
 int process_parameter(int argc, char **argv);
 int resource_init(void);
 int resource_free(void);
 int main(int argc, char **argv);
 
+// Query Field Table
+const struct query_field g_query_field_table[] =
+{
+    { "hello_packet",   query_hello_packet },
+    { "recovery",       query_recovery },
+    { "fw_id",          query_fw_id },
+    { "fw_version",     query_fw_version },
+    { "test_version",   query_test_version },
+    { "bc_version",     query_bc_version },
+    { "info_fwid",      query_info_fwid },
+    { "rek_counter",    query_rek_counter },
+    { "remark_id",      query_remark_id },
+    { "update_counter", query_update_counter },
+    { "last_update_time", query_last_update_time },
+};
+
+// Session Script Command Table
+const struct script_command g_script_command_table[] =
+{
+    { "info",        0, 0, script_info,        "info" },
+    { "rek",         0, 0, script_rek,         "rek" },
+    { "rek-counter", 0, 0, script_rek_counter, "rek-counter" },
+    { "update",      1, 2, script_update,      "update <firmware_file> [<skip_action_code>]" },
+    { "verify",      0, 0, script_verify,      "verify (Compare Flash with Firmware File of Last \"update\")" },
+    { "dump",        1, 2, script_dump,        "dump <dump_file> [<address_in_hex>,<size_in_hex>]" },
+    { "wait-ready",  0, 1, script_wait_ready,  "wait-ready [<timeout_ms>] (Re-connect & Detect Touch State until Ready)" },
+};
+
+/*******************************************
+ * Function Implementation
+ ******************************************/
+
 /*******************************************
- * HID Raw I/O Functions
+ * Query Fields
  ******************************************/
 
-int __hidraw_write(unsigned char* buf, int len, int timeout_ms)
+int query_hello_packet(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
 {
-    int nRet = ERR_SUCCESS;
+    snprintf(p_value_buf, value_buf_size, "%02x", p_session->hello_packet);
+    return ERR_SUCCESS;
+}
 
-    if(g_pIntfGet == NULL)
+int query_recovery(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    snprintf(p_value_buf, value_buf_size, "%s", (p_session->recovery) ? "true" : "false");
+    return ERR_SUCCESS;
+}
+
+// Resolve All Requested Version Fields in One Pipelined Transaction (Main Code Command)
+int fetch_query_fw_info(const struct touch_session *p_session)
+{
+    size_t field_index = 0;
+    unsigned short *p_fw_id = NULL,
+                   *p_fw_version = NULL,
+                   *p_test_version = NULL,
+                   *p_bc_version = NULL;
+
+    // Fetched by Previous Field of This Record
+    if(g_query_cache.fw_info_fetched)
+        return g_query_cache.fw_info_err;
+
+    for(field_index = 0; field_index < g_query_field_count; field_index++)
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_WRITE_EXIT;
+        if(g_query_field[field_index]->get_value == query_fw_id)
+            p_fw_id = &g_query_cache.fw_id;
+        else if(g_query_field[field_index]->get_value == query_fw_version)
+            p_fw_version = &g_query_cache.fw_version;
+        else if(g_query_field[field_index]->get_value == query_test_version)
+            p_test_version = &g_query_cache.test_version;
+        else if(g_query_field[field_index]->get_value == query_bc_version)
+            p_bc_version = &g_query_cache.bc_version;
     }
 
-    nRet = g_pIntfGet->WriteRawBytes(buf, len, timeout_ms);
+    g_query_cache.fw_info_err = get_firmware_info(p_fw_id, p_fw_version, p_test_version, p_bc_version, p_session->gen8_touch);
+    g_query_cache.fw_info_fetched = true;
 
-__HIDRAW_WRITE_EXIT:
-    return nRet;
+    return g_query_cache.fw_info_err;
 }
 
-int __hidraw_read(unsigned char* buf, int len, int timeout_ms)
+int query_fw_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
 
-    if(g_pIntfGet == NULL)
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = fetch_query_fw_info(p_session);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", g_query_cache.fw_id);
+
+    return err;
+}
+
+int query_fw_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = fetch_query_fw_info(p_session);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", g_query_cache.fw_version);
+
+    return err;
+}
+
+int query_test_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = fetch_query_fw_info(p_session);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", g_query_cache.test_version);
+
+    return err;
+}
+
+int query_bc_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short bc_version = 0;
+
+    if(p_session->recovery) // Already Reported with Hello Packet
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_READ_EXIT;
+        bc_version = p_session->bc_bc_version;
     }
+    else // Normal Mode
+    {
+        err = fetch_query_fw_info(p_session);
+        bc_version = g_query_cache.bc_version;
+    }
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", bc_version);
 
-    nRet = g_pIntfGet->ReadRawBytes(buf, len, timeout_ms);
+    return err;
+}
 
-__HIDRAW_READ_EXIT:
-    return nRet;
+int query_info_fwid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short info_fwid = 0;
+
+    err = read_touch_info_fwid(p_session, &info_fwid);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", info_fwid);
+
+    return err;
 }
 
-int __hidraw_write_command(unsigned char* buf, int len, int timeout_ms)
+int query_rek_counter(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
+    unsigned short rek_counter = 0;
 
-    if(g_pIntfGet == NULL)
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    // Gen8 touch does not support calibration counter, reported as 0 (Same as gen8_get_calibration_counter()).
+    if(p_session->gen8_touch == false)
+        err = get_rek_counter(&rek_counter);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", rek_counter);
+
+    return err;
+}
+
+int query_remark_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned short remark_id = 0;
+    unsigned char gen8_remark_id[ELAN_GEN8_REMARK_ID_LEN] = {0};
+
+    if(p_session->gen8_touch) // Gen8 Touch
+    {
+        err = gen8_read_remark_id(gen8_remark_id, sizeof(gen8_remark_id), p_session->recovery);
+        if(err != ERR_SUCCESS)
+            goto QUERY_REMARK_ID_EXIT;
+
+        for(index = 0; index < ELAN_GEN8_REMARK_ID_LEN; index++)
+            snprintf(&p_value_buf[index * 2], value_buf_size - (index * 2), "%02x", gen8_remark_id[index]);
+    }
+    else // Gen5/6/7 Touch
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_WRITE_EXIT;
+        err = get_rom_data(ELAN_INFO_ROM_REMARK_ID_MEMORY_ADDR, p_session->recovery, &remark_id);
+        if(err != ERR_SUCCESS)
+            goto QUERY_REMARK_ID_EXIT;
+
+        snprintf(p_value_buf, value_buf_size, "%04x", remark_id);
     }
 
-    nRet = g_pIntfGet->WriteCommand(buf, len, timeout_ms);
+QUERY_REMARK_ID_EXIT:
+    return err;
+}
 
-__HIDRAW_WRITE_EXIT:
-    return nRet;
+// Read Update Information Once for Update Counter & Last Update Time (Main Code Command)
+int fetch_query_update_info(const struct touch_session *p_session)
+{
+    // Fetched by Previous Field of This Record
+    if(g_query_cache.update_info_fetched)
+        return g_query_cache.update_info_err;
+
+    if(p_session->gen8_touch) // Gen8 Touch
+        g_query_cache.update_info_err = gen8_read_update_info(&g_query_cache.update_info, sizeof(g_query_cache.update_info));
+    else // Gen5/6/7 Touch
+        g_query_cache.update_info_err = read_update_info(&g_query_cache.update_info, sizeof(g_query_cache.update_info));
+    g_query_cache.update_info_fetched = true;
+
+    return g_query_cache.update_info_err;
 }
 
-int __hidraw_read_data(unsigned char* buf, int len, int timeout_ms)
+int query_update_counter(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
 
-    if(g_pIntfGet == NULL)
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = fetch_query_update_info(p_session);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%u", g_query_cache.update_info.update_counter);
+
+    return err;
+}
+
+int query_last_update_time(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    const struct update_info *p_update_info = &g_query_cache.update_info;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = fetch_query_update_info(p_session);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04u-%02u-%02uT%02u:%02u", p_update_info->last_update_time.Year, p_update_info->last_update_time.Month, \
+                 p_update_info->last_update_time.Day, p_update_info->last_update_time.Hour, p_update_info->last_update_time.Minute);
+
+    return err;
+}
+
+/*******************************************
+ * Session Script Commands
+ ******************************************/
+
+int script_info(struct touch_session *p_session, int argc, char **argv)
+{
+    int err = ERR_SUCCESS;
+
+    // Main Code Command
+    if(p_session->recovery)
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_READ_EXIT;
+        ERROR_PRINTF("FW Information is not Supported in Recovery Mode!\r\n");
+        return ERR_FUNC_NOT_SUPPORT;
     }
 
-    nRet = g_pIntfGet->ReadData(buf, len, timeout_ms);
+    if(p_session->gen8_touch) // Gen8 Touch
+        err = gen8_get_firmware_information(g_msg_mode);
+    else // Gen5/6/7 Touch
+        err = get_firmware_information(g_msg_mode);
+    if(err != ERR_SUCCESS)
+        ERROR_PRINTF("Fail to Get FW Info!\r\n");
 
-__HIDRAW_READ_EXIT:
-    return nRet;
+    return err;
 }
 
-/***************************************************
- * Abstract I/O Functions
- ***************************************************/
+int script_rek(struct touch_session *p_session, int argc, char **argv)
+{
+    int err = ERR_SUCCESS;
+    struct calibration_result calibration_result;
 
-int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+    // Main Code Command
+    if(p_session->recovery)
+    {
+        ERROR_PRINTF("Re-Calibration is not Supported in Recovery Mode!\r\n");
+        return ERR_FUNC_NOT_SUPPORT;
+    }
+
+    // Same as "-k": Not Supported from Gen8 Touch, but not an Error
+    if(p_session->gen8_touch)
+    {
+        ERROR_PRINTF("Re-Calibration is not supported from Gen8 touch!\r\n");
+        return ERR_SUCCESS;
+    }
+
+    err = calibrate_touch_and_get_counter_with_error_retry(&calibration_result, ERROR_RETRY_COUNT);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Calibrate Touch!\r\n");
+        return err;
+    }
+    if(g_msg_mode == FULL_MESSAGE)
+        printf("Re-Calibration Time: %lums.\r\n", calibration_result.duration_ms);
+
+    return err;
+}
+
+int script_rek_counter(struct touch_session *p_session, int argc, char **argv)
 {
-    //write_bytes_from_buffer_to_i2c(cmd_buf); //pseudo function
+    int err = ERR_SUCCESS;
 
-    /*** example *********************/
-    return __hidraw_write_command(cmd_buf, len, timeout_ms);
-    /*********************************/
+    // Main Code Command
+    if(p_session->recovery)
+    {
+        ERROR_PRINTF("Calibration Counter is not Supported in Recovery Mode!\r\n");
+        return ERR_FUNC_NOT_SUPPORT;
+    }
+
+    if(p_session->gen8_touch) // Gen8 Touch
+        err = gen8_get_calibration_counter(g_msg_mode);
+    else // Gen5/6/7 Touch
+        err = get_calibration_counter(g_msg_mode);
+    if(err != ERR_SUCCESS)
+        ERROR_PRINTF("Fail to Get Calibration Counter!\r\n");
+
+    return err;
 }
 
-int read_data(unsigned char *data_buf, int len, int timeout_ms)
+int script_update(struct touch_session *p_session, int argc, char **argv)
 {
-    //read_bytes_from_i2c_to_buffer(data_buf, len, timeout); //pseudo function
+    int err = ERR_SUCCESS,
+        skip_action_code = 0;
 
-    /*** example *********************/
-    return __hidraw_read_data(data_buf, len, timeout_ms);
-    /*********************************/
+    // Make Sure Data Valid
+    if(strlen(argv[1]) >= FILE_NAME_LENGTH_MAX)
+    {
+        ERROR_PRINTF("Firmware Path (%s) Invalid!\r\n", argv[1]);
+        return ERR_INVALID_PARAM;
+    }
+    if(argc > 2)
+    {
+        skip_action_code = atoi(argv[2]);
+        if(skip_action_code < 0)
+        {
+            ERROR_PRINTF("Invalid Action Code: %d!\r\n", skip_action_code);
+            return ERR_INVALID_PARAM;
+        }
+    }
+
+    // Replace Firmware File of Previous "update" (Closed in resource_free() if Last One)
+    if(g_update_fw == true)
+    {
+        close_firmware_file();
+        g_update_fw = false;
+    }
+    err = prepare_firmware_file(argv[1], p_session);
+    if(err != ERR_SUCCESS)
+        return err;
+    strcpy(g_firmware_filename, argv[1]);
+    g_update_fw = true;
+
+    err = run_firmware_update(p_session->gen8_touch, p_session->recovery, skip_action_code);
+    if(err != ERR_SUCCESS)
+        return err;
+
+    // Touch Leaves Recovery Mode after Update, so Following Commands Need New State
+    err = detect_touch_state(p_session);
+    if(err != ERR_SUCCESS)
+        ERROR_PRINTF("Fail to Detect Touch State after FW Update! err=0x%x.\r\n", err);
+
+    return err;
 }
 
-int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+int script_verify(struct touch_session *p_session, int argc, char **argv)
 {
-    unsigned char vendor_cmd_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+    // Compare with Firmware File of Last "update"
+    if(g_update_fw == false)
+    {
+        ERROR_PRINTF("No Firmware File to Verify, Please Run \"update\" First!\r\n");
+        return ERR_INVALID_PARAM;
+    }
 
-    // Add HID Header
-    vendor_cmd_buf[0] = ELAN_HID_OUTPUT_REPORT_ID;
-    memcpy(&vendor_cmd_buf[1], cmd_buf, len);
+    // Bulk Read of Main Code is not Available in Boot Code
+    if(p_session->recovery)
+    {
+        ERROR_PRINTF("FW Verification is not Supported in Recovery Mode!\r\n");
+        return ERR_FUNC_NOT_SUPPORT;
+    }
 
-    return __hidraw_write(vendor_cmd_buf, sizeof(vendor_cmd_buf), timeout_ms);
+    return run_firmware_verification(p_session->gen8_touch);
 }
 
-/*******************************************
- * Function Implementation
- ******************************************/
+int script_dump(struct touch_session *p_session, int argc, char **argv)
+{
+    int err = ERR_SUCCESS;
+    unsigned int dump_address = 0,
+                 dump_size = 0;
+
+    // Make Sure Data Valid
+    if(strlen(argv[1]) >= FILE_NAME_LENGTH_MAX)
+    {
+        ERROR_PRINTF("Dump File Path (%s) Invalid!\r\n", argv[1]);
+        return ERR_INVALID_PARAM;
+    }
+    if(argc > 2)
+    {
+        err = parse_dump_range(argv[2], &dump_address, &dump_size);
+        if(err != ERR_SUCCESS)
+            return err;
+    }
+
+    return run_flash_dump(p_session, argv[1], (argc > 2), dump_address, dump_size);
+}
+
+int script_wait_ready(struct touch_session *p_session, int argc, char **argv)
+{
+    int timeout_ms = SCRIPT_WAIT_READY_TIMEOUT_MSEC;
+
+    // Make Sure Data Valid
+    if(argc > 1)
+    {
+        timeout_ms = atoi(argv[1]);
+        if(timeout_ms < 0)
+        {
+            ERROR_PRINTF("Invalid Timeout: %d!\r\n", timeout_ms);
+            return ERR_INVALID_PARAM;
+        }
+    }
+
+    return wait_device_ready(p_session, timeout_ms);
+}
 
 /*******************************************
  * Help
@@ -249,6 +716,11 @@ void show_help_information(void)
     printf("-s <action_code>.\r\n");
     printf("Ex: hid_iap -s 1 \r\n");
 
+    // Firmware Verification
+    printf("\n[Firmware Verification]\r\n");
+    printf("-v. (Read Flash back and Compare with FW File after FW Update)\r\n");
+    printf("Ex: hid_iap -f firmware.ekt -v\r\n");
+
     // Firmware Information
     printf("\n[Firmware Information]\r\n");
     printf("-i.\r\n");
@@ -264,6 +736,74 @@ void show_help_information(void)
     printf("-c.\r\n");
     printf("Ex: hid_iap -c\r\n");
 
+    // Flash Dump
+    printf("\n[Flash Dump]\r\n");
+    printf("-u <dump_file_path>.\r\n");
+    printf("-r <address_in_hex>,<size_in_hex>. (Gen5/6/7: Word Address; Gen8: Offset from Info. ROM)\r\n");
+    printf("Ex: hid_iap -u /tmp/flash_dump.bin\r\n");
+    printf("Ex: hid_iap -u /tmp/info_rom_dump.bin -r 8000,200\r\n");
+
+    // Query
+    printf("\n[Query]\r\n");
+    printf("-Q <field>[,<field>...].\r\n");
+    show_query_field_names(g_query_field_table, sizeof(g_query_field_table) / sizeof(g_query_field_table[0]));
+    printf("Ex: hid_iap -Q fw_id,fw_version,bc_version\r\n");
+    printf("Ex: hid_iap -Q all -j\r\n");
+
+    // Retry Policy
+    printf("\n[Retry Policy]\r\n");
+    printf("-R <key>=<value>[,<key>=<value>...].\r\n");
+    show_retry_policy_format();
+    printf("Ex: hid_iap -R backoff=fixed,delay=50 -i\r\n");
+    printf("Ex: hid_iap -R count=5,delay=5,max=100,deadline=500,on=timeout+io -f firmware.ekt\r\n");
+
+    // Timing Profile
+    printf("\n[Timing Profile]\r\n");
+    printf("-T <profile_file_path>. (Learn Flash Write / Erase Latencies per Device, and Wait Less in Later Runs)\r\n");
+    printf("Ex: hid_iap -f firmware.ekt -T /var/tmp/hid_iap_timing.prof\r\n");
+
+    // Device Cache
+    printf("\n[Device Cache]\r\n");
+    printf("-C <cache_file_path>. (Reuse hidraw Node & Touch Identification of Previous Run if Device Unchanged)\r\n");
+    printf("Ex: hid_iap -C /var/tmp/hid_iap_device.cache -i\r\n");
+
+    // Device Lock
+    printf("\n[Device Lock]\r\n");
+    printf("-W <wait_ms>. (Max. Wait if Device is Used by Other hid_iap / hid_read_fwid, Default: %d ms, 0: No Wait)\r\n", HID_DEVICE_LOCK_WAIT_MSEC);
+    printf("Ex: hid_iap -W 0 -i\r\n");
+
+    // Touch Report Streaming
+    printf("\n[Touch Report Streaming]\r\n");
+    printf("-m <duration_in_sec>. (Report Rate, Interval Histogram & Dropped Reports of Finger / Pen Reports, 0: Until Ctrl-C)\r\n");
+    printf("-b <capture_file_path>. (Binary Capture of Timestamped Reports)\r\n");
+    printf("Ex: hid_iap -m 10\r\n");
+    printf("Ex: hid_iap -m 0 -b /tmp/touch_reports.bin\r\n");
+
+    // Pen Debug Report Capture
+    printf("\n[Pen Debug Report Capture]\r\n");
+    printf("-g <ring_file_path>. (Capture Pen Debug Reports to Memory-mapped Ring File until Ctrl-C, Oldest Overwritten)\r\n");
+    printf("-G <ring_size_in_MB>. (Default: %d MB)\r\n", REPORT_RING_DEFAULT_SIZE_MB);
+    printf("Ex: hid_iap -g /var/tmp/pen_debug.ring -G 256\r\n");
+
+    // Session Script
+    printf("\n[Session Script]\r\n");
+    printf("-x <script_file_path>. (Run Commands in One Device Session, Stop at First Failure, \"-\": Read from stdin)\r\n");
+    show_script_command_usage(g_script_command_table, sizeof(g_script_command_table) / sizeof(g_script_command_table[0]));
+    printf("Ex: hid_iap -x /tmp/production.script\r\n");
+    printf("Ex: echo \"info\" | hid_iap -x -\r\n");
+
+    // Firmware Compression
+    printf("\n[Firmware Compression]\r\n");
+    printf("-z <compressed_file_path>. (Compress Firmware File of \"-f\" and Exit, No Device Opened. Compressed Files are Accepted by \"-f\")\r\n");
+    printf("Ex: hid_iap -f firmware.ekt -z firmware.elz\r\n");
+
+    // Firmware Bundle
+    printf("\n[Firmware Bundle]\r\n");
+    printf("-B <bundle_file_path> <FWID>:<generation (5: Gen5/6/7, 8: Gen8)>:<file_path> ... (Create Bundle and Exit, No Device Opened)\r\n");
+    printf("   (\"-f <bundle_file_path>\" Updates with the Image Matching Information FWID of Touch)\r\n");
+    printf("Ex: hid_iap -B station.elb 2a03:5:fw_2a03.ekt 3110:8:fw_3110.elz\r\n");
+    printf("Ex: hid_iap -f station.elb\r\n");
+
     // Silent (Quiet) Mode
     printf("\n[Silent Mode]\r\n");
     printf("-q.\r\n");
@@ -289,6 +829,7 @@ void show_help_information(void)
 int open_device(void)
 {
     int err = ERR_SUCCESS;
+    unsigned int bus_type = 0;
 
     // open specific device on i2c bus //pseudo function
 
@@ -299,12 +840,47 @@ int open_device(void)
         goto OPEN_DEVICE_EXIT;
     }
 
+    // Information Page Read & Pipelining State before Belong to Previous Device Session
+    invalidate_info_page_cache();
+    gen8_invalidate_info_page_cache();
+    reset_command_pipeline();
+
+    // Connect to Cached Device (Skip Scanning /dev) if Still the Same Node
+    g_device_cache_hit = false;
+    if((strlen(g_device_cache_path) > 0) && \
+       (find_device_cache_entry(g_device_cache_path, ELAN_HID_VID, g_pid, &g_device_cache_entry) == ERR_SUCCESS))
+    {
+        DEBUG_PRINTF("Get HID Device Handle (Cached: %s).\r\n", g_device_cache_entry.hidraw_path);
+        err = g_pIntfGet->GetDeviceHandleByPath(g_device_cache_entry.hidraw_path, ELAN_HID_VID, g_device_cache_entry.pid);
+        if((err == ERR_SUCCESS) && (g_pIntfGet->GetDevBusType(&bus_type) == ERR_SUCCESS) && (bus_type == g_device_cache_entry.bus_type))
+        {
+            g_device_cache_hit = true;
+            goto OPEN_DEVICE_LOCK;
+        }
+        DEBUG_PRINTF("Cached Device Mismatched, Scan Devices.\r\n");
+        g_pIntfGet->Close();
+    }
+
     // Connect to Device
     DEBUG_PRINTF("Get HID Device Handle (VID=0x%x, PID=0x%x).\r\n", ELAN_HID_VID, g_pid);
     err = g_pIntfGet->GetDeviceHandle(ELAN_HID_VID, g_pid);
     if (err != ERR_SUCCESS)
     {
         ERROR_PRINTF("Device can't connected! err=0x%x.\n", err);
+        goto OPEN_DEVICE_EXIT;
+    }
+
+OPEN_DEVICE_LOCK:
+    // Lock Device against Other Tool Processes (e.g. hid_read_fwid)
+    if(g_lock_mode == HID_DEVICE_LOCK_NONE)
+        goto OPEN_DEVICE_EXIT;
+    err = g_pIntfGet->LockDevice(g_lock_mode, g_lock_wait_ms);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Device is busy! err=0x%x.\n", err);
+        g_device_cache_hit = false; // Cached Device is still Valid
+        g_pIntfGet->Close();
+        g_pIntfGet->UnlockDevice();
     }
 
 OPEN_DEVICE_EXIT:
@@ -326,8 +902,12 @@ int close_device(void)
         goto CLOSE_DEVICE_EXIT;
     }
 
-    // Release acquired touch device handler
+    // Release acquired touch device handler & device lock (End of Device Session)
     g_pIntfGet->Close();
+    g_pIntfGet->UnlockDevice();
+    invalidate_info_page_cache();
+    gen8_invalidate_info_page_cache();
+    reset_command_pipeline();
 
 CLOSE_DEVICE_EXIT:
     /*********************************/
@@ -335,6 +915,68 @@ CLOSE_DEVICE_EXIT:
     return err;
 }
 
+int update_device_cache(int session_err, unsigned char hello_packet, unsigned short bc_bc_version, unsigned short fw_bc_version, bool gen8_touch, bool recovery)
+{
+    int err = ERR_SUCCESS;
+    char hidraw_path[MAX_PATH] = {0};
+    struct device_cache_entry entry;
+
+    if((g_pIntfGet == NULL) || (g_pIntfGet->GetDevicePath(hidraw_path, sizeof(hidraw_path)) != ERR_SUCCESS))
+    {
+        // Not Connected: Drop Cached Device Used in This Run
+        if(g_device_cache_hit == true)
+            remove_device_cache_entry(g_device_cache_path, g_device_cache_entry.hidraw_path);
+        err = ERR_DEVICE_NOT_FOUND;
+        goto UPDATE_DEVICE_CACHE_EXIT;
+    }
+
+    // Identification may be Stale after Failure, and Recovery Mode should always be Re-detected
+    if((session_err != ERR_SUCCESS) || (recovery == true))
+    {
+        err = remove_device_cache_entry(g_device_cache_path, hidraw_path);
+        goto UPDATE_DEVICE_CACHE_EXIT;
+    }
+
+    memset(&entry, 0, sizeof(entry));
+    err = get_hidraw_identity(hidraw_path, &entry);
+    if(err != ERR_SUCCESS)
+    {
+        DEBUG_PRINTF("%s: Fail to Get Identity of %s! err=0x%x.\r\n", __func__, hidraw_path, err);
+        goto UPDATE_DEVICE_CACHE_EXIT;
+    }
+    g_pIntfGet->GetDevVidPid(&entry.vid, &entry.pid);
+    g_pIntfGet->GetDevBusType(&entry.bus_type);
+    entry.hello_packet = hello_packet;
+    entry.bc_bc_version = bc_bc_version;
+    entry.fw_bc_version = fw_bc_version;
+    entry.gen8_touch = gen8_touch;
+
+    err = store_device_cache_entry(g_device_cache_path, &entry);
+
+UPDATE_DEVICE_CACHE_EXIT:
+    return err;
+}
+
+// Drop Cached Device before Flash is Erased / Written, so an Interrupted Update never Leaves a Stale Entry
+// (Entry is Stored Again by update_device_cache() only after Successful Session)
+int invalidate_device_cache(void)
+{
+    int err = ERR_SUCCESS;
+    char hidraw_path[MAX_PATH] = {0};
+
+    if((strlen(g_device_cache_path) == 0) || (g_pIntfGet == NULL))
+        goto INVALIDATE_DEVICE_CACHE_EXIT;
+
+    if(g_pIntfGet->GetDevicePath(hidraw_path, sizeof(hidraw_path)) == ERR_SUCCESS)
+        err = remove_device_cache_entry(g_device_cache_path, hidraw_path);
+    if((g_device_cache_hit == true) && (strcmp(hidraw_path, g_device_cache_entry.hidraw_path) != 0))
+        err = remove_device_cache_entry(g_device_cache_path, g_device_cache_entry.hidraw_path);
+    DEBUG_PRINTF("%s: Device Cache Entry Removed before Update (err=0x%x).\r\n", __func__, err);
+
+INVALIDATE_DEVICE_CACHE_EXIT:
+    return err;
+}
+
 int get_bus_type(unsigned int *bus_type)
 {
     int nRet = ERR_SUCCESS;
@@ -374,12 +1016,28 @@ int reconnect_device(void)
     // Release acquired touch device handler
     g_pIntfGet->Close();
 
+    // Information Page Read & Pipelining State before Belong to Previous Device Session
+    invalidate_info_page_cache();
+    gen8_invalidate_info_page_cache();
+    reset_command_pipeline();
+
     // Connect to Device
     DEBUG_PRINTF("Get HID Device Handle (VID=0x%x, PID=0x%x).\r\n", ELAN_HID_VID, g_pid);
     err = g_pIntfGet->GetDeviceHandle(ELAN_HID_VID, g_pid);
     if (err != ERR_SUCCESS)
     {
         ERROR_PRINTF("Device can't connected! err=0x%x.\n", err);
+        goto RE_CONNECT_DEVICE_EXIT;
+    }
+
+    // Device Lock is Held across Reconnect (No-op unless Device Changed)
+    if(g_lock_mode == HID_DEVICE_LOCK_NONE)
+        goto RE_CONNECT_DEVICE_EXIT;
+    err = g_pIntfGet->LockDevice(g_lock_mode, g_lock_wait_ms);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Device is busy! err=0x%x.\n", err);
+        g_pIntfGet->Close();
     }
 
 RE_CONNECT_DEVICE_EXIT:
@@ -389,13 +1047,317 @@ RE_CONNECT_DEVICE_EXIT:
 }
 
 /*******************************************
- *  Initialize & Free Resource
+ *  Touch Operations
  ******************************************/
 
-int resource_init(void)
+int wait_device_ready(struct touch_session *p_session, int timeout_ms)
+{
+    int err = ERR_SUCCESS;
+    long elapsed_ms = 0;
+    struct timespec start_time,
+                    now_time;
+
+    // Device may Re-enumerate after Mode Switch, so Re-connect before Every Try
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    while (1)
+    {
+        err = reconnect_device();
+        if(err == ERR_SUCCESS)
+        {
+            err = detect_touch_state(p_session);
+            if(err == ERR_SUCCESS)
+                break;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &now_time);
+        elapsed_ms = (now_time.tv_sec - start_time.tv_sec) * 1000 + (now_time.tv_nsec - start_time.tv_nsec) / 1000000;
+        if(elapsed_ms >= timeout_ms)
+        {
+            ERROR_PRINTF("Device not Ready in %dms! err=0x%x.\r\n", timeout_ms, err);
+            goto WAIT_DEVICE_READY_EXIT;
+        }
+        usleep(SCRIPT_WAIT_READY_POLL_INTERVAL_MSEC * 1000);
+    }
+
+    if(g_msg_mode == FULL_MESSAGE)
+        printf("Device Ready: Hello Packet 0x%02x, %s Mode.\r\n", p_session->hello_packet, (p_session->recovery) ? "Recovery" : "Normal");
+
+WAIT_DEVICE_READY_EXIT:
+    return err;
+}
+
+int read_touch_info_fwid(const struct touch_session *p_session, unsigned short *p_info_fwid)
+{
+    if(p_session->gen8_touch) // Gen8 Touch
+        return gen8_read_info_fwid(p_info_fwid, p_session->recovery);
+    else // Gen5/6/7 Touch
+        return read_info_fwid(p_info_fwid, p_session->recovery);
+}
+
+// Open & check firmware file.
+// (Image of firmware bundle is selected by information FWID of touch, so bundle needs p_session of opened device.)
+int prepare_firmware_file(const char *p_firmware_filename, const struct touch_session *p_session)
 {
     int err = ERR_SUCCESS,
         firmware_size = 0;
+    unsigned short info_fwid = 0;
+
+    // Open Firmware File
+    if(is_firmware_bundle(p_firmware_filename))
+    {
+        if(p_session == NULL)
+        {
+            ERROR_PRINTF("Firmware bundle \"%s\" needs information FWID of touch!\r\n", p_firmware_filename);
+            err = ERR_INVALID_PARAM;
+            goto PREPARE_FIRMWARE_FILE_EXIT;
+        }
+        err = read_touch_info_fwid(p_session, &info_fwid);
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to read information FWID! err=0x%x.\r\n", err);
+            goto PREPARE_FIRMWARE_FILE_EXIT;
+        }
+        if(g_msg_mode == FULL_MESSAGE)
+            printf("Information FWID: %04x.\r\n", info_fwid);
+        err = open_firmware_bundle_file((char *)p_firmware_filename, strlen(p_firmware_filename), info_fwid, \
+                                        (p_session->gen8_touch) ? ELAN_TS_GEN_8 : ELAN_TS_GEN_5);
+    }
+    else
+        err = open_firmware_file((char *)p_firmware_filename, strlen(p_firmware_filename));
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to open firmware file \"%s\"! err=0x%x.\r\n", p_firmware_filename, err);
+        goto PREPARE_FIRMWARE_FILE_EXIT;
+    }
+
+    // Get Firmware Size
+    err = get_firmware_size(&firmware_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to open firmware size \"%s\"! err=0x%x.\r\n", p_firmware_filename, err);
+        goto PREPARE_FIRMWARE_FILE_CLOSE;
+    }
+
+    // Make Sure Firmware File Valid
+    //DEBUG_PRINTF("Firmware Size: %d.\r\n", firmware_size);
+    if(firmware_size <= 0)
+    {
+        ERROR_PRINTF("Invalid Firmware Size: %d!\r\n", firmware_size);
+        err = ERR_FILE_NOT_FOUND;
+        goto PREPARE_FIRMWARE_FILE_CLOSE;
+    }
+
+    return ERR_SUCCESS;
+
+PREPARE_FIRMWARE_FILE_CLOSE:
+    close_firmware_file();
+
+PREPARE_FIRMWARE_FILE_EXIT:
+    return err;
+}
+
+int parse_bundle_source(char *p_source_str, struct fw_bundle_source *p_source)
+{
+    unsigned long fwid = 0;
+    long generation = 0;
+    char *p_end = NULL;
+
+    // Format: <FWID (Hex)>:<Generation (5 / 8)>:<File Path>
+    fwid = strtoul(p_source_str, &p_end, 16);
+    if ((p_end == p_source_str) || (*p_end != ':') || (fwid > 0xFFFF))
+    {
+        ERROR_PRINTF("%s: Invalid Bundle Image \"%s\"!\r\n", __func__, p_source_str);
+        return ERR_INVALID_PARAM;
+    }
+    generation = strtol(p_end + 1, &p_end, 10);
+    if ((*p_end != ':') || ((generation != ELAN_TS_GEN_5) && (generation != ELAN_TS_GEN_8)) || (strlen(p_end + 1) == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Bundle Image \"%s\"!\r\n", __func__, p_source_str);
+        return ERR_INVALID_PARAM;
+    }
+
+    p_source->fwid = (unsigned short)fwid;
+    p_source->generation = (int)generation;
+    p_source->p_filename = p_end + 1;
+    return ERR_SUCCESS;
+}
+
+int parse_dump_range(const char *p_range, unsigned int *p_address, unsigned int *p_size)
+{
+    unsigned int address = 0,
+                 size = 0;
+    char *p_end = NULL;
+
+    // Format: <address>,<size> (Hex)
+    address = (unsigned int)strtoul(p_range, &p_end, 16);
+    if ((p_end == p_range) || (*p_end != ','))
+    {
+        ERROR_PRINTF("%s: Invalid Dump Range \"%s\"!\r\n", __func__, p_range);
+        return ERR_INVALID_PARAM;
+    }
+    size = (unsigned int)strtoul(p_end + 1, &p_end, 16);
+    if ((*p_end != '\0') || (size == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Dump Range \"%s\"!\r\n", __func__, p_range);
+        return ERR_INVALID_PARAM;
+    }
+
+    *p_address = address;
+    *p_size = size;
+    return ERR_SUCCESS;
+}
+
+int run_flash_dump(const struct touch_session *p_session, const char *p_dump_filename, bool dump_range_set, unsigned int dump_address, unsigned int dump_size)
+{
+    int err = ERR_SUCCESS;
+
+    // Bulk Read of Main Code is not Available in Boot Code
+    if(p_session->recovery == true)
+    {
+        ERROR_PRINTF("Flash Dump is not Supported in Recovery Mode!\r\n");
+        return ERR_FUNC_NOT_SUPPORT;
+    }
+
+    // Default Dump Region
+    if(dump_range_set == false)
+    {
+        dump_address = (p_session->gen8_touch) ? ELAN_GEN8_FLASH_DUMP_ADDR : ELAN_FLASH_DUMP_ADDR;
+        dump_size = (p_session->gen8_touch) ? ELAN_GEN8_FLASH_DUMP_SIZE : ELAN_FLASH_DUMP_SIZE;
+    }
+
+    DEBUG_PRINTF("Dump Flash (%s), Gen8 Touch: %s, Address: 0x%x, Size: 0x%x.\r\n", \
+                 p_dump_filename, (p_session->gen8_touch) ? "true" : "false", dump_address, dump_size);
+    if(p_session->gen8_touch) // Gen8 Touch
+        err = gen8_dump_flash((char *)p_dump_filename, strlen(p_dump_filename), dump_address, dump_size, g_msg_mode);
+    else // Gen5/6/7 Touch
+        err = dump_flash((char *)p_dump_filename, strlen(p_dump_filename), dump_address, dump_size, g_msg_mode);
+    if(err != ERR_SUCCESS)
+        ERROR_PRINTF("Fail to Dump Flash to \"%s\"!\r\n", p_dump_filename);
+
+    return err;
+}
+
+int run_firmware_update(bool gen8_touch, bool recovery, int skip_action_code)
+{
+    int err = ERR_SUCCESS;
+    unsigned int bus_type = 0;
+    struct calibration_result calibration_result;
+
+    // Device Identification is Stale from Here until Update Succeeds
+    invalidate_device_cache();
+
+    if(recovery == false) // Normal IAP
+    {
+        // Get FW Info.
+        DEBUG_PRINTF("Get FW Info.\r\n");
+        if(gen8_touch) // Gen8 Touch
+            err = gen8_get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
+        else // Gen5/6/7 Touch
+            err = get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Get FW Info!\r\n");
+            goto RUN_FIRMWARE_UPDATE_EXIT;
+        }
+    }
+
+    // Update Firmware
+    DEBUG_PRINTF("Update Firmware (%s), Gen8 Touch: %s, Recovery: %s, Skip Action Code: 0x%x.\r\n", \
+                 g_firmware_filename, \
+                 (gen8_touch) ? "true" : "false", \
+                 (recovery) ? "true" : "false", \
+                 skip_action_code);
+    if(gen8_touch) // Gen8 Touch
+        err = gen8_update_firmware(g_firmware_filename, strlen(g_firmware_filename), recovery, skip_action_code);
+    else // Gen5/6/7 Touch
+        err = update_firmware(g_firmware_filename, strlen(g_firmware_filename), recovery, skip_action_code);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Update Firmware (%s)!\r\n", g_firmware_filename);
+        goto RUN_FIRMWARE_UPDATE_EXIT;
+    }
+
+    // Get Bus Type
+    err = get_bus_type(&bus_type);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Get Bus Type! err=0x%x.\r\n", err);
+    }
+    DEBUG_PRINTF("Bus Type: 0x%02x.\r\n", bus_type);
+
+    // Re-connect Device if SPI
+    if (bus_type == BUS_SPI)
+    {
+        // Re-connect Device
+        err = reconnect_device();
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Re-connect Device! err=0x%x.\r\n", err);
+            goto RUN_FIRMWARE_UPDATE_EXIT;
+        }
+    }
+
+    // Re-calibrate Touch
+    DEBUG_PRINTF("Calibrate Touch...\r\n");
+    if(gen8_touch)
+    {
+        /* [Note] 2022/06/06
+        * With the information from FW Solution Team, it takes 100ms for touch to self-calibrate after power-on.
+        * For safety reasons, a waiting time of 300ms is recommended.
+        */
+        usleep(300 * 1000); // wait 300ms
+    }
+    else // Gen5/6/7 Touch
+    {
+        // Calibrate & Verify Calibration with Counter
+        err = calibrate_touch_and_get_counter_with_error_retry(&calibration_result, ERROR_RETRY_COUNT);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Calibrate Touch!\r\n");
+            goto RUN_FIRMWARE_UPDATE_EXIT;
+        }
+        DEBUG_PRINTF("Re-Calibration Time: %lums, Calibration Counter: %04x.\r\n", calibration_result.duration_ms, calibration_result.rek_counter);
+    }
+
+    // Verify FW Update with FW Information
+    DEBUG_PRINTF("Get FW Info.\r\n");
+    if(gen8_touch) // Gen8 Touch
+        err = gen8_get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
+    else // Gen5/6/7 Touch
+        err = get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Get FW Info!\r\n");
+        goto RUN_FIRMWARE_UPDATE_EXIT;
+    }
+
+RUN_FIRMWARE_UPDATE_EXIT:
+    return err;
+}
+
+int run_firmware_verification(bool gen8_touch)
+{
+    int err = ERR_SUCCESS;
+
+    // Verify Flash with FW File
+    DEBUG_PRINTF("Verify Firmware (%s)...\r\n", g_firmware_filename);
+    if(gen8_touch) // Gen8 Touch
+        err = gen8_verify_firmware(FULL_MESSAGE);
+    else // Gen5/6/7 Touch
+        err = verify_firmware(FULL_MESSAGE);
+    if(err != ERR_SUCCESS)
+        ERROR_PRINTF("Fail to Verify Firmware (%s)! err=0x%x.\r\n", g_firmware_filename, err);
+
+    return err;
+}
+
+/*******************************************
+ *  Initialize & Free Resource
+ ******************************************/
+
+int resource_init(void)
+{
+    int err = ERR_SUCCESS;
 
     //initialize_resource(); //pseudo function
 
@@ -413,31 +1375,18 @@ int resource_init(void)
 
     if(g_update_fw == true)
     {
-        // Open Firmware File
-        err = open_firmware_file(g_firmware_filename, strlen(g_firmware_filename));
-        if(err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("Fail to open firmware file \"%s\"! err=0x%x.\r\n", g_firmware_filename, err);
-            goto RESOURCE_INIT_EXIT;
-        }
-
-        // Get Firmware Size
-        err = get_firmware_size(&firmware_size);
-        if(err != ERR_SUCCESS)
+        // Firmware Bundle is Opened after Touch State Detected
+        g_firmware_bundle = is_firmware_bundle(g_firmware_filename);
+        if(g_firmware_bundle == false)
         {
-            ERROR_PRINTF("Fail to open firmware size \"%s\"! err=0x%x.\r\n", g_firmware_filename, err);
-            goto RESOURCE_INIT_EXIT;
-        }
-
-        // Make Sure Firmware File Valid
-        //DEBUG_PRINTF("Firmware Size: %d.\r\n", firmware_size);
-        if(firmware_size <= 0)
-        {
-            ERROR_PRINTF("Invalid Firmware Size: %d!\r\n", firmware_size);
-            err = ERR_FILE_NOT_FOUND;
-            goto RESOURCE_INIT_EXIT;
+            // Open & Check Firmware File
+            err = prepare_firmware_file(g_firmware_filename, NULL);
+            if(err != ERR_SUCCESS)
+            {
+                g_update_fw = false; // Already Closed
+                goto RESOURCE_INIT_EXIT;
+            }
         }
-
     }
 
     // Success
@@ -487,7 +1436,10 @@ int process_parameter(int argc, char **argv)
         pid = 0,
         pid_str_len = 0,
         file_path_len = 0,
-        action_code = 0;
+        action_code = 0,
+        lock_wait_ms = 0,
+        stream_duration_sec = 0,
+        ring_size_mb = 0;
     char file_path[FILE_NAME_LENGTH_MAX] = {0};
 
     while (1)
@@ -583,6 +1535,13 @@ int process_parameter(int argc, char **argv)
                 DEBUG_PRINTF("%s: Skip Action Code: %d.\r\n", __func__, g_skip_action_code);
                 break;
 
+            case 'v': /* Firmware Verification */
+
+                // Set FW Verification Flag
+                g_verify_fw = true;
+                DEBUG_PRINTF("%s: Verify FW: %s.\r\n", __func__, (g_verify_fw) ? "Enable" : "Disable");
+                break;
+
             case 'i': /* Firmware Information */
 
                 // Set "Get FW Info." Flag
@@ -604,6 +1563,234 @@ int process_parameter(int argc, char **argv)
                 DEBUG_PRINTF("%s: Get Calibration Counter: %s.\r\n", __func__, (g_get_rek_counter) ? "Enable" : "Disable");
                 break;
 
+            case 'u': /* Flash Dump File Path */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Dump File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Flash Dump Flag & File Path
+                g_dump_flash = true;
+                strcpy(g_dump_filename, optarg);
+                DEBUG_PRINTF("%s: Flash Dump: %s, File Path: \"%s\".\r\n", __func__, (g_dump_flash) ? "Yes" : "No", g_dump_filename);
+                break;
+
+            case 'r': /* Flash Dump Range */
+
+                // Format: <address>,<size> (Hex)
+                err = parse_dump_range(optarg, &g_dump_address, &g_dump_size);
+                if (err != ERR_SUCCESS)
+                    goto PROCESS_PARAM_EXIT;
+
+                // Set Dump Range Flag
+                g_dump_range_set = true;
+                DEBUG_PRINTF("%s: Dump Range: Address 0x%x, Size 0x%x.\r\n", __func__, g_dump_address, g_dump_size);
+                break;
+
+            case 'Q': /* Query */
+
+                // Parse Field List
+                err = parse_query_field_list(optarg, g_query_field_table, sizeof(g_query_field_table) / sizeof(g_query_field_table[0]), \
+                                             g_query_field, QUERY_FIELD_COUNT_MAX, &g_query_field_count);
+                if (err != ERR_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid Query Field List \"%s\"!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Query Flag
+                g_query = true;
+                DEBUG_PRINTF("%s: Query: %ld field(s).\r\n", __func__, g_query_field_count);
+                break;
+
+            case 'j': /* JSON Output of Query */
+
+                // Set Query Format
+                g_query_format = QUERY_FORMAT_JSON;
+                DEBUG_PRINTF("%s: Query Format: JSON.\r\n", __func__);
+                break;
+
+            case 'R': /* Retry Policy */
+
+                // Parse Retry Policy
+                err = parse_retry_policy(optarg);
+                if (err != ERR_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid Retry Policy \"%s\"!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+                break;
+
+            case 'T': /* Timing Profile */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Timing Profile Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Timing Profile Path
+                strcpy(g_timing_profile_path, optarg);
+                DEBUG_PRINTF("%s: Timing Profile: \"%s\".\r\n", __func__, g_timing_profile_path);
+                break;
+
+            case 'C': /* Device Cache */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Device Cache Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Device Cache Path
+                strcpy(g_device_cache_path, optarg);
+                DEBUG_PRINTF("%s: Device Cache: \"%s\".\r\n", __func__, g_device_cache_path);
+                break;
+
+            case 'W': /* Device Lock Wait */
+
+                // Make Sure Data Valid
+                lock_wait_ms = atoi(optarg);
+                if (lock_wait_ms < 0)
+                {
+                    ERROR_PRINTF("%s: Invalid Lock Wait: %d!\n", __func__, lock_wait_ms);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Device Lock Wait
+                g_lock_wait_ms = lock_wait_ms;
+                DEBUG_PRINTF("%s: Lock Wait: %d ms.\r\n", __func__, g_lock_wait_ms);
+                break;
+
+            case 'm': /* Touch Report Streaming */
+
+                // Make Sure Data Valid
+                stream_duration_sec = atoi(optarg);
+                if (stream_duration_sec < 0)
+                {
+                    ERROR_PRINTF("%s: Invalid Stream Duration: %d!\n", __func__, stream_duration_sec);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Streaming Flag & Duration
+                g_stream_reports = true;
+                g_stream_duration_sec = (unsigned int)stream_duration_sec;
+                DEBUG_PRINTF("%s: Stream Reports: %u sec.\r\n", __func__, g_stream_duration_sec);
+                break;
+
+            case 'b': /* Report Capture File Path */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Capture File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Capture File Path
+                strcpy(g_capture_filename, optarg);
+                DEBUG_PRINTF("%s: Capture File: \"%s\".\r\n", __func__, g_capture_filename);
+                break;
+
+            case 'g': /* Pen Debug Ring File Path */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Pen Debug Ring File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Pen Debug Capture Flag & Ring File Path
+                g_capture_pen_debug = true;
+                strcpy(g_pen_debug_ring_path, optarg);
+                DEBUG_PRINTF("%s: Pen Debug Ring File: \"%s\".\r\n", __func__, g_pen_debug_ring_path);
+                break;
+
+            case 'G': /* Pen Debug Ring Size */
+
+                // Make Sure Data Valid
+                ring_size_mb = atoi(optarg);
+                if ((ring_size_mb <= 0) || (ring_size_mb > REPORT_RING_MAX_SIZE_MB))
+                {
+                    ERROR_PRINTF("%s: Invalid Pen Debug Ring Size: %d MB!\n", __func__, ring_size_mb);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Pen Debug Ring Size
+                g_pen_debug_ring_size_mb = (unsigned int)ring_size_mb;
+                DEBUG_PRINTF("%s: Pen Debug Ring Size: %u MB.\r\n", __func__, g_pen_debug_ring_size_mb);
+                break;
+
+            case 'x': /* Session Script File Path */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Script File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Script Flag & File Path
+                g_run_script = true;
+                strcpy(g_script_path, optarg);
+                DEBUG_PRINTF("%s: Session Script: \"%s\".\r\n", __func__, g_script_path);
+                break;
+
+            case 'z': /* Compressed Firmware File Path */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Compressed File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Compression Flag & File Path
+                g_compress_fw = true;
+                strcpy(g_compressed_filename, optarg);
+                DEBUG_PRINTF("%s: Compress FW to \"%s\".\r\n", __func__, g_compressed_filename);
+                break;
+
+            case 'B': /* Firmware Bundle File Path (Images Follow as Arguments) */
+
+                // Check if filename is valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || (file_path_len >= FILE_NAME_LENGTH_MAX))
+                {
+                    ERROR_PRINTF("%s: Bundle File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Bundle Creation Flag & File Path
+                g_create_bundle = true;
+                strcpy(g_bundle_filename, optarg);
+                DEBUG_PRINTF("%s: Create FW Bundle \"%s\".\r\n", __func__, g_bundle_filename);
+                break;
+
             case 'q': /* Silent Mode (Quiet) */
 
                 // Enable Silent Mode
@@ -631,12 +1818,101 @@ int process_parameter(int argc, char **argv)
         }
     }
 
+    // Images of FW bundle: <FWID>:<Generation>:<File Path> ...
+    if(g_create_bundle == true)
+    {
+        if((optind >= argc) || ((argc - optind) > ELAN_FW_BUNDLE_ENTRY_COUNT_MAX))
+        {
+            ERROR_PRINTF("%s: Please Input 1~%d Bundle Images (<FWID>:<Generation>:<File Path>)!\r\n", __func__, ELAN_FW_BUNDLE_ENTRY_COUNT_MAX);
+            err = ERR_INVALID_PARAM;
+            goto PROCESS_PARAM_EXIT;
+        }
+        for(g_bundle_source_count = 0; optind < argc; optind++, g_bundle_source_count++)
+        {
+            err = parse_bundle_source(argv[optind], &g_bundle_source[g_bundle_source_count]);
+            if(err != ERR_SUCCESS)
+                goto PROCESS_PARAM_EXIT;
+        }
+    }
+
     // Check if PID is not null
     if(g_pid == 0)
     {
         DEBUG_PRINTF("%s: PID is not set, look for an appropriate PID...\r\n", __func__);
     }
 
+    // Query only reads touch, so it can not be mixed with FW update or re-calibration
+    if((g_query == true) && ((g_update_fw == true) || (g_rek == true)))
+    {
+        ERROR_PRINTF("%s: Query can not be Set with FW Update or Re-Calibration!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // FW verification compares flash with the FW file, so it needs FW update
+    if((g_verify_fw == true) && (g_update_fw == false))
+    {
+        ERROR_PRINTF("%s: FW Verification can only be Set with FW Update!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // Output of Query is a Single Record
+    if(g_query == true)
+        g_msg_mode = SILENT_MODE;
+
+    // Flash dump only reads touch, so it can not be mixed with FW update, re-calibration or query
+    if((g_dump_flash == true) && ((g_update_fw == true) || (g_rek == true) || (g_query == true)))
+    {
+        ERROR_PRINTF("%s: Flash Dump can not be Set with FW Update, Re-Calibration or Query!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+    if((g_dump_range_set == true) && (g_dump_flash == false))
+    {
+        ERROR_PRINTF("%s: Please Input Dump File Path!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // Session script carries its own operations, so it can not be mixed with operation options
+    if((g_run_script == true) && \
+       ((g_update_fw == true) || (g_verify_fw == true) || (g_get_fw_info == true) || (g_rek == true) || (g_get_rek_counter == true) || \
+        (g_dump_flash == true) || (g_dump_range_set == true) || (g_query == true) || (g_stream_reports == true) || (g_capture_pen_debug == true)))
+    {
+        ERROR_PRINTF("%s: Session Script can not be Set with Other Operations (-f/-v/-i/-k/-c/-u/-r/-Q/-m/-g)!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // FW compression runs offline on the FW file, so it needs "-f" and no device operation
+    if((g_compress_fw == true) && \
+       ((g_update_fw == false) || (g_verify_fw == true) || (g_get_fw_info == true) || (g_rek == true) || (g_get_rek_counter == true) || \
+        (g_dump_flash == true) || (g_dump_range_set == true) || (g_query == true) || (g_stream_reports == true) || (g_capture_pen_debug == true) || \
+        (g_run_script == true)))
+    {
+        ERROR_PRINTF("%s: FW Compression can only be Set with FW File Path (-f)!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+    if((g_compress_fw == true) && (is_firmware_bundle(g_firmware_filename) == true))
+    {
+        ERROR_PRINTF("%s: FW Bundle can not be Compressed, Please Compress its Images!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // FW bundle creation runs offline on the image files, so it can not be mixed with other options
+    if((g_create_bundle == true) && \
+       ((g_update_fw == true) || (g_verify_fw == true) || (g_get_fw_info == true) || (g_rek == true) || (g_get_rek_counter == true) || \
+        (g_dump_flash == true) || (g_dump_range_set == true) || (g_query == true) || (g_stream_reports == true) || (g_capture_pen_debug == true) || \
+        (g_run_script == true) || (g_compress_fw == true)))
+    {
+        ERROR_PRINTF("%s: FW Bundle Creation can not be Set with Other Operations!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
     return ERR_SUCCESS;
 
 PROCESS_PARAM_EXIT:
@@ -651,13 +1927,16 @@ PROCESS_PARAM_EXIT:
 int main(int argc, char **argv)
 {
     int err = ERR_SUCCESS;
-    unsigned int bus_type = 0;
     unsigned short fw_bc_version = 0,
-                   bc_bc_version = 0;
+                   bc_bc_version = 0,
+                   fw_version = 0;
     unsigned char hello_packet = 0;
     bool gen8_touch = false,	// True if Gen8 Touch
          recovery = false;		// True if Recovery Mode
     message_mode_t msg_mode;
+    struct touch_session session;
+    struct timing_device_key timing_device_key;
+    struct calibration_result calibration_result;
 
     // Process Parameter
     err = process_parameter(argc, argv);
@@ -678,6 +1957,24 @@ int main(int argc, char **argv)
         goto EXIT;
     }
 
+    /* Compress Firmware File (No Device) */
+    if(g_compress_fw == true)
+    {
+        err = compress_firmware_file(g_firmware_filename, g_compressed_filename, g_msg_mode);
+        if(err != ERR_SUCCESS)
+            ERROR_PRINTF("Fail to Compress Firmware File! err=0x%x.\r\n", err);
+        goto EXIT;
+    }
+
+    /* Create Firmware Bundle (No Device) */
+    if(g_create_bundle == true)
+    {
+        err = create_firmware_bundle(g_bundle_filename, g_bundle_source, g_bundle_source_count, g_msg_mode);
+        if(err != ERR_SUCCESS)
+            ERROR_PRINTF("Fail to Create Firmware Bundle! err=0x%x.\r\n", err);
+        goto EXIT;
+    }
+
     /* Initialize Resource */
     err = resource_init();
     if (err != ERR_SUCCESS)
@@ -687,6 +1984,8 @@ int main(int argc, char **argv)
     }
 
     /* Open Device */
+    if((g_stream_reports == true) || (g_capture_pen_debug == true)) // Passive Listener (hidraw Gives Every Reader Own Copy), No Lock
+        g_lock_mode = HID_DEVICE_LOCK_NONE;
     err = open_device() ;
     if (err != ERR_SUCCESS)
     {
@@ -694,63 +1993,83 @@ int main(int argc, char **argv)
         goto EXIT2;
     }
 
+    /* Stream Touch Reports (No Command Sent) */
+    if(g_stream_reports == true)
+    {
+        err = stream_reports(g_stream_duration_sec, g_capture_filename, g_msg_mode);
+        if(err != ERR_SUCCESS)
+            ERROR_PRINTF("Fail to Stream Touch Reports! err=0x%x.\r\n", err);
+        goto EXIT2;
+    }
+
+    /* Capture Pen Debug Reports (No Command Sent) */
+    if(g_capture_pen_debug == true)
+    {
+        err = capture_pen_debug_reports(g_pen_debug_ring_path, g_pen_debug_ring_size_mb, g_msg_mode);
+        if(err != ERR_SUCCESS)
+            ERROR_PRINTF("Fail to Capture Pen Debug Reports! err=0x%x.\r\n", err);
+        goto EXIT2;
+    }
+
     /* Detect Touch State */
 
-    // Get Hello Packet
-    err = get_hello_packet_bc_version_with_error_retry(&hello_packet, &bc_bc_version, ERROR_RETRY_COUNT);
-    if(err != ERR_SUCCESS)
+    // Cached Identification (Normal Mode Only), Trusted if Main Code still Answers One FW Version Query
+    if(g_device_cache_hit == true)
+    {
+        err = get_firmware_info(NULL, &fw_version, NULL, NULL, g_device_cache_entry.gen8_touch);
+        if(err == ERR_SUCCESS)
+        {
+            session.hello_packet = g_device_cache_entry.hello_packet;
+            session.bc_bc_version = g_device_cache_entry.bc_bc_version;
+            session.fw_bc_version = g_device_cache_entry.fw_bc_version;
+            session.gen8_touch = g_device_cache_entry.gen8_touch;
+            session.recovery = false;
+            DEBUG_PRINTF("Hello Packet: 0x%02x, Normal Mode BC Version: 0x%04x (Cached, FW Version: 0x%04x).\r\n", \
+                         session.hello_packet, session.fw_bc_version, fw_version);
+        }
+        else
+        {
+            DEBUG_PRINTF("Cached Device does not Answer in Normal Mode (err=0x%x), Detect Touch State.\r\n", err);
+            reset_command_pipeline(); // Probe Failure is not a Pipelining Failure
+        }
+    }
+    if((g_device_cache_hit == false) || (err != ERR_SUCCESS))
+    {
+        err = detect_touch_state(&session);
+        if(err != ERR_SUCCESS)
+            goto EXIT2;
+    }
+    hello_packet = session.hello_packet;
+    bc_bc_version = session.bc_bc_version;
+    fw_bc_version = session.fw_bc_version;
+    gen8_touch = session.gen8_touch;
+    recovery = session.recovery;
+
+    /* Query Fields (Same Device Session) */
+    if(g_query == true)
     {
-        ERROR_PRINTF("Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", err);
+        memset(&g_query_cache, 0, sizeof(g_query_cache));
+        err = run_query(&session, g_query_field, g_query_field_count, g_query_format);
         goto EXIT2;
     }
-    DEBUG_PRINTF("Hello Packet: 0x%02x, Recovery Mode BC Version: 0x%04x.\r\n", hello_packet, bc_bc_version);
 
-    // Identify HW Series & Touch State
-    switch (hello_packet)
+    /* Load Timing Profile of This Device */
+    if(strlen(g_timing_profile_path) > 0)
     {
-        case ELAN_HID_NORMAL_MODE_HELLO_PACKET:
-            // BC Version (Normal Mode)
-            err = get_boot_code_version(&fw_bc_version);
-            if(err != ERR_SUCCESS)
-            {
-                ERROR_PRINTF("%s: Fail to Get BC Version (Normal Mode)! err=0x%x.\r\n", __func__, err);
-                goto EXIT2;
-            }
-            DEBUG_PRINTF("Normal Mode BC Version: 0x%04x.\r\n", fw_bc_version);
-
-            // Special Case: First BC of EM32F901 / EM32F902
-            if((HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_HID) /* EM32F901 */ ||
-               (HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_HID) /* FM32F902 */)
-                gen8_touch = true;     // Gen8 Touch
-            else
-                gen8_touch = false;    // Gen5/6/7 Touch
-            recovery = false;          // Normal Mode
-            break;
-
-        case ELAN_GEN8_HID_NORMAL_MODE_HELLO_PACKET:
-            gen8_touch = true;         // Gen8 Touch
-            recovery = false;          // Normal Mode
-            break;
-
-        case ELAN_HID_RECOVERY_MODE_HELLO_PACKET:
-            // Special Case: First BC of EM32F901 / EM32F902
-            if((HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_HID) /* EM32F901 */ ||
-               (HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_HID) /* FM32F902 */)
-                gen8_touch = true;     // Gen8 Touch
-            else
-                gen8_touch = false;    // Gen5/6/7 Touch
-            recovery = true;           // Recovery Mode
-            break;
-
-        case ELAN_GEN8_HID_RECOVERY_MODE_HELLO_PACKET:
-            gen8_touch = true;         // Gen8 Touch
-            recovery = true;           // Recovery Mode
-            break;
-
-        default:
-            ERROR_PRINTF("%s: Unknown Hello Packet! (0x%02x) \r\n", __func__, hello_packet);
-            err = ERR_UNKNOWN_DEVICE_TYPE;
+        memset(&timing_device_key, 0, sizeof(timing_device_key));
+        g_pIntfGet->GetDevVidPid(&timing_device_key.vid, &timing_device_key.pid);
+        get_bus_type(&timing_device_key.bus_type);
+        if(recovery == true)
+            timing_device_key.bc_version = bc_bc_version;
+        else if((fw_bc_version != 0) || (get_boot_code_version(&fw_bc_version) == ERR_SUCCESS))
+            timing_device_key.bc_version = fw_bc_version;
+
+        err = load_timing_profile(g_timing_profile_path, &timing_device_key);
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Load Timing Profile \"%s\"! err=0x%x.\r\n", g_timing_profile_path, err);
             goto EXIT2;
+        }
     }
 
     // Reconfigure if Recovery Mode
@@ -762,6 +2081,30 @@ int main(int argc, char **argv)
         g_get_rek_counter = false;     // Disable Get Calibration Counter
     }
 
+    /* Run Session Script (Same Device Session) */
+    if(g_run_script == true)
+    {
+        session.fw_bc_version = fw_bc_version; // May be Read for Timing Profile
+        err = run_session_script(g_script_path, g_script_command_table, sizeof(g_script_command_table) / sizeof(g_script_command_table[0]), \
+                                 &session, g_msg_mode);
+
+        // Touch State at End of Script (for Device Cache)
+        hello_packet = session.hello_packet;
+        bc_bc_version = session.bc_bc_version;
+        fw_bc_version = session.fw_bc_version;
+        gen8_touch = session.gen8_touch;
+        recovery = session.recovery;
+        goto EXIT2;
+    }
+
+    /* Dump Flash */
+    if(g_dump_flash == true)
+    {
+        err = run_flash_dump(&session, g_dump_filename, g_dump_range_set, g_dump_address, g_dump_size);
+        if(err != ERR_SUCCESS)
+            goto EXIT2;
+    }
+
     /* Get FW Information */
     if((g_get_fw_info == true) && (g_update_fw == false))
     {
@@ -778,7 +2121,8 @@ int main(int argc, char **argv)
     }
 
     /* Get Calibration Counter */
-    if((g_get_rek_counter == true) && (g_update_fw == false))
+    // (Gen5/6/7 touch reads calibration counter with re-calibration.)
+    if((g_get_rek_counter == true) && (g_update_fw == false) && ((g_rek == false) || gen8_touch))
     {
         DEBUG_PRINTF("Get Calibration Counter.\r\n");
 
@@ -805,26 +2149,21 @@ int main(int argc, char **argv)
     {
         if(gen8_touch == false) // Gen5/6/7 Touch
         {
+            // Calibrate & Verify Calibration with Counter
             DEBUG_PRINTF("Calibrate Touch...\r\n");
-            err = calibrate_touch_with_error_retry(ERROR_RETRY_COUNT);
+            err = calibrate_touch_and_get_counter_with_error_retry(&calibration_result, ERROR_RETRY_COUNT);
             if (err != ERR_SUCCESS)
             {
                 ERROR_PRINTF("Fail to Calibrate Touch!\r\n");
                 goto EXIT2;
             }
+            printf("Re-Calibration Time: %lums.\r\n", calibration_result.duration_ms);
 
-            // If with getting calibration counter, change message mode to FULL_MESSAGE.
+            // If with getting calibration counter, show counter.
             if(g_get_rek_counter == true)
-                msg_mode = FULL_MESSAGE;
-            else // In General Case
-                msg_mode = NO_MESSAGE;
-
-            // Verify Calibration with Counter
-            err = get_calibration_counter(msg_mode);
-            if(err != ERR_SUCCESS)
             {
-                ERROR_PRINTF("Fail to Get Calibration Counter!\r\n");
-                goto EXIT2;
+                printf("--------------------------------\r\n");
+                printf("Calibration Counter: %04x.\r\n", calibration_result.rek_counter);
             }
         }
         else // Gen8 Touch
@@ -840,95 +2179,35 @@ int main(int argc, char **argv)
     /* Update FW */
     if(g_update_fw == true)
     {
-        if(recovery == false) // Normal IAP
+        // Select Image of Firmware Bundle by Information FWID (Same Device Session)
+        if(g_firmware_bundle == true)
         {
-            // Get FW Info.
-            DEBUG_PRINTF("Get FW Info.\r\n");
-            if(gen8_touch) // Gen8 Touch
-                err = gen8_get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
-            else // Gen5/6/7 Touch
-                err = get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
+            err = prepare_firmware_file(g_firmware_filename, &session);
             if(err != ERR_SUCCESS)
-            {
-                ERROR_PRINTF("Fail to Get FW Info!\r\n");
                 goto EXIT2;
-            }
-        }
-
-        // Update Firmware
-        DEBUG_PRINTF("Update Firmware (%s), Gen8 Touch: %s, Recovery: %s, Skip Action Code: 0x%x.\r\n", \
-                     g_firmware_filename, \
-                     (gen8_touch) ? "true" : "false", \
-                     (recovery) ? "true" : "false", \
-                     g_skip_action_code);
-        if(gen8_touch) // Gen8 Touch
-            err = gen8_update_firmware(g_firmware_filename, strlen(g_firmware_filename), recovery, g_skip_action_code);
-        else // Gen5/6/7 Touch
-            err = update_firmware(g_firmware_filename, strlen(g_firmware_filename), recovery, g_skip_action_code);
-        if (err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("Fail to Update Firmware (%s)!\r\n", g_firmware_filename);
-            goto EXIT2;
         }
 
-        // Get Bus Type
-        err = get_bus_type(&bus_type);
-        if(err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("Fail to Get Bus Type! err=0x%x.\r\n", err);
-        }
-        DEBUG_PRINTF("Bus Type: 0x%02x.\r\n", bus_type);
-
-        // Re-connect Device if SPI
-        if (bus_type == BUS_SPI)
+        // Refuse Verification before Flash is Touched, not after a Good Update
+        if(g_verify_fw == true)
         {
-            // Re-connect Device
-            err = reconnect_device();
+            err = (gen8_touch) ? gen8_check_firmware_verifiable() : check_firmware_verifiable();
             if(err != ERR_SUCCESS)
             {
-                ERROR_PRINTF("Fail to Re-connect Device! err=0x%x.\r\n", err);
-                goto EXIT2;
-            }
-        }
-
-        // Re-calibrate Touch
-        DEBUG_PRINTF("Calibrate Touch...\r\n");
-        if(gen8_touch)
-        {
-            /* [Note] 2022/06/06
-            * With the information from FW Solution Team, it takes 100ms for touch to self-calibrate after power-on.
-            * For safety reasons, a waiting time of 300ms is recommended.
-            */
-            usleep(300 * 1000); // wait 300ms
-        }
-        else // Gen5/6/7 Touch
-        {
-            err = calibrate_touch_with_error_retry(ERROR_RETRY_COUNT);
-            if (err != ERR_SUCCESS)
-            {
-                ERROR_PRINTF("Fail to Calibrate Touch!\r\n");
+                ERROR_PRINTF("Flash of This Firmware (%s) can not be Verified (\"-v\"), Firmware not Updated! err=0x%x.\r\n", g_firmware_filename, err);
                 goto EXIT2;
             }
         }
 
-        // Verify FW Update with FW Information
-        DEBUG_PRINTF("Get FW Info.\r\n");
-        if(gen8_touch) // Gen8 Touch
-            err = gen8_get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
-        else // Gen5/6/7 Touch
-            err = get_firmware_information(FULL_MESSAGE); // Disable Silent Mode
+        err = run_firmware_update(gen8_touch, recovery, g_skip_action_code);
         if(err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("Fail to Get FW Info!\r\n");
             goto EXIT2;
-        }
 
-        // Verify Calibration with Counter
-        err = get_calibration_counter(NO_MESSAGE);
-        if(err != ERR_SUCCESS)
+        // Verify Flash with FW File
+        if(g_verify_fw == true)
         {
-            ERROR_PRINTF("Fail to Get Calibration Counter!\r\n");
-            goto EXIT2;
+            err = run_firmware_verification(gen8_touch);
+            if(err != ERR_SUCCESS)
+                goto EXIT2;
         }
     }
 
@@ -936,9 +2215,19 @@ int main(int argc, char **argv)
     err = ERR_SUCCESS;
 
 EXIT2:
+    /* Update Device Cache (Only Successful Normal Mode Session is Cached) */
+    if((strlen(g_device_cache_path) > 0) && (g_lock_mode == HID_DEVICE_LOCK_EXCLUSIVE)) // Command Session Only
+        update_device_cache(err, hello_packet, bc_bc_version, fw_bc_version, gen8_touch, recovery);
+
     /* Close Device */
     close_device();
 
+    /* Retry Statistics */
+    show_retry_stats();
+
+    /* Save Timing Profile (Latencies Observed in This Run) */
+    save_timing_profile();
+
 EXIT1:
     /* Release Resource */
     resource_free();
@@ -0,0 +1,106 @@
+/** @file
+
+  Header of Daemon Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsDaemonUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_DAEMON_UTILITY_H__
+#define __ELAN_TS_DAEMON_UTILITY_H__
+#pragma once
+
+#include "ElanTsDebug.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Path of Unix Domain Socket
+#ifndef DAEMON_SOCKET_PATH
+#define DAEMON_SOCKET_PATH              "/run/hid_read_fwid.sock"
+#endif //DAEMON_SOCKET_PATH
+
+// Directory of Device Nodes (Watched for hidraw Hotplug)
+#ifndef DAEMON_DEV_DIR
+#define DAEMON_DEV_DIR                  "/dev"
+#endif //DAEMON_DEV_DIR
+
+// Max. Length of Request
+#ifndef DAEMON_REQUEST_LENGTH_MAX
+#define DAEMON_REQUEST_LENGTH_MAX       256
+#endif //DAEMON_REQUEST_LENGTH_MAX
+
+// Timeout of Receiving Request / Sending Response (ms)
+#ifndef DAEMON_REQUEST_TIMEOUT_MS
+#define DAEMON_REQUEST_TIMEOUT_MS       1000
+#endif //DAEMON_REQUEST_TIMEOUT_MS
+
+// Max. Number of Clients Sending Request at the Same Time (Others Wait in Listen Backlog)
+#ifndef DAEMON_CLIENT_COUNT_MAX
+#define DAEMON_CLIENT_COUNT_MAX         16
+#endif //DAEMON_CLIENT_COUNT_MAX
+
+// Timeout of Waiting Response in Client (ms), Including Touch Info. Read from Device
+#ifndef DAEMON_RESPONSE_TIMEOUT_MS
+#define DAEMON_RESPONSE_TIMEOUT_MS      10000
+#endif //DAEMON_RESPONSE_TIMEOUT_MS
+
+// Delay of Refresh after Change Notified (ms), Coalescing Bursts of udev Events
+#ifndef DAEMON_REFRESH_DELAY_MS
+#define DAEMON_REFRESH_DELAY_MS         50
+#endif //DAEMON_REFRESH_DELAY_MS
+
+// Refresh Flags
+#ifndef DAEMON_REFRESH_HID_DEVICE
+#define DAEMON_REFRESH_HID_DEVICE       0x01
+#endif //DAEMON_REFRESH_HID_DEVICE
+
+#ifndef DAEMON_REFRESH_MAPPING_FILE
+#define DAEMON_REFRESH_MAPPING_FILE     0x02
+#endif //DAEMON_REFRESH_MAPPING_FILE
+
+#ifndef DAEMON_REFRESH_ALL
+#define DAEMON_REFRESH_ALL              (DAEMON_REFRESH_HID_DEVICE | DAEMON_REFRESH_MAPPING_FILE)
+#endif //DAEMON_REFRESH_ALL
+
+/*******************************************
+ * Global Data Structure Declaration
+ ******************************************/
+
+// Refresh Cached Data (refresh_flags: DAEMON_REFRESH_*)
+typedef int (*daemon_refresh_handler)(unsigned int refresh_flags);
+
+// Handle Request, Response Written to stdout
+typedef int (*daemon_request_handler)(const char *p_request);
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Socket Path
+int set_daemon_socket_path(const char *p_socket_path);
+
+// Daemon
+int run_daemon(const char *p_watch_file_path, bool foreground, daemon_refresh_handler refresh_handler, daemon_request_handler request_handler);
+
+// Client
+int send_daemon_request(const char *p_request, int *p_result);
+
+#endif //__ELAN_TS_DAEMON_UTILITY_H__
@@ -24,6 +24,16 @@
  * Definitions
  ******************************************/
 
+// Root of DRM Connectors in sysfs (EDID: ${DRM_SYSFS_ROOT}/card*-*/edid)
+#ifndef DRM_SYSFS_ROOT
+#define DRM_SYSFS_ROOT          "/sys/class/drm"
+#endif //DRM_SYSFS_ROOT
+
+// Size of EDID Base Block
+#ifndef EDID_BLOCK_SIZE
+#define EDID_BLOCK_SIZE         128
+#endif //EDID_BLOCK_SIZE
+
 // Path of modetest command
 #ifndef MODETEST_CMD
 #define MODETEST_CMD            "/usr/bin/modetest -a"
@@ -58,7 +68,12 @@
  * Function Prototype
  ******************************************/
 
+// DRM sysfs Root
+int set_drm_sysfs_root(const char *p_drm_sysfs_root);
+
 // EDID Info.
+int get_edid_manufacturer_product_code_from_sysfs(unsigned short *p_manufacturer_code, unsigned short *p_product_code);
+int get_edid_manufacturer_product_code_from_modetest(unsigned short *p_manufacturer_code, unsigned short *p_product_code);
 int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsigned short *p_product_code);
 int show_edid_manufacturer_product_code(unsigned short manufacturer_code, unsigned short product_code);
 
@@ -49,6 +49,20 @@
 #define SYSTEM_NAME_LENGTH       16
 #endif //SYSTEM_NAME_LENGTH
 
+// Precompiled FWID Mapping Table (Binary)
+#ifndef FWID_MAPPING_BIN_MAGIC
+#define FWID_MAPPING_BIN_MAGIC   "ELANFWID"
+#endif //FWID_MAPPING_BIN_MAGIC
+
+#ifndef FWID_MAPPING_BIN_VERSION
+#define FWID_MAPPING_BIN_VERSION 2
+#endif //FWID_MAPPING_BIN_VERSION
+
+// Hash Index: Empty Bucket / End of Chain
+#ifndef FWID_MAPPING_NO_ENTRY
+#define FWID_MAPPING_NO_ENTRY    0xFFFFFFFF
+#endif //FWID_MAPPING_NO_ENTRY
+
 /*******************************************
  * Data Structure Declaration
  ******************************************/
@@ -61,6 +75,46 @@ typedef struct lcm_dev_info
     unsigned short windows_fwid;
 } DEV_INFO, *PDEV_INFO;
 
+// FWID Mapping Entry (Also the Record Layout of Binary Table)
+struct fwid_mapping_entry
+{
+    unsigned short manufacturer_code;
+    unsigned short product_code;
+    unsigned short chrome_fwid;
+    unsigned short windows_fwid;
+    unsigned int next;          // Next Entry in Same Bucket (FWID_MAPPING_NO_ENTRY: End of Chain)
+};
+
+/* Binary Table Layout (Host Byte Order):
+ * +--------------------------------+
+ * | struct fwid_mapping_bin_header |
+ * +--------------------------------+
+ * | unsigned int bucket[n]         |  n = bucket_count (power of 2)
+ * +--------------------------------+
+ * | struct fwid_mapping_entry[m]   |  m = entry_count
+ * +--------------------------------+
+ */
+struct fwid_mapping_bin_header
+{
+    char magic[8];              // FWID_MAPPING_BIN_MAGIC
+    unsigned int version;       // FWID_MAPPING_BIN_VERSION
+    unsigned int entry_count;
+    unsigned int bucket_count;
+    unsigned int reserved;
+};
+
+// FWID Mapping Database (Hash Index Keyed on Manufacturer Code & Product Code)
+struct fwid_mapping_db
+{
+    struct fwid_mapping_entry *p_entry;
+    unsigned int entry_count;
+    unsigned int entry_capacity;
+    unsigned int *p_bucket;
+    unsigned int bucket_count;
+    void *p_map;                // Mapped Binary Table (NULL if Parsed from Text)
+    size_t map_size;
+};
+
 // System Type
 enum system_type
 {
@@ -94,6 +148,15 @@ int get_fwid_from_edid(struct lcm_dev_info *p_dev_info, size_t dev_info_size, un
 int show_fwid(system_type system, unsigned short fwid, bool silent_mode);
 
 int get_fwid_from_rom(unsigned short *p_fwid, bool recovery);
+
+// FWID Mapping Database
+int load_fwid_mapping_db(const char *p_file_path, struct fwid_mapping_db *p_db);
+int parse_fwid_mapping_db(FILE *fd_mapping_file, struct fwid_mapping_db *p_db);
+int save_fwid_mapping_db(const char *p_file_path, struct fwid_mapping_db *p_db);
+void free_fwid_mapping_db(struct fwid_mapping_db *p_db);
+int lookup_fwid_mapping_db(struct fwid_mapping_db *p_db, unsigned short manufacturer_code, unsigned short product_code, const struct fwid_mapping_entry **pp_entry);
+int get_fwid_from_mapping_db(struct fwid_mapping_db *p_db, unsigned short manufacturer_code, unsigned short product_code, system_type system, unsigned short *p_fwid);
+int show_fwid_mapping_db(struct fwid_mapping_db *p_db);
 int show_fwid_from_rom(unsigned short fwid);
 
 #endif //__ELAN_TS_LCM_DEVICE_UTILITY_H__
@@ -0,0 +1,626 @@
+/** @file
+
+  Implementation of Daemon Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsDaemonUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>             /* read, write, close, dup, dup2, fork */
+#include <sys/socket.h>
+#include <sys/un.h>             /* sockaddr_un */
+#include <sys/inotify.h>
+#include "BuildConfig.h"
+#include "ErrCode.h"
+#include "ElanTsDaemonUtility.h"
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Client Sending Request (Polled with Listening Socket, so a Slow Client never Blocks Others)
+struct daemon_client
+{
+    int fd;
+    size_t request_len;
+    char request[DAEMON_REQUEST_LENGTH_MAX];
+    unsigned long long deadline_ms;         // CLOCK_MONOTONIC
+};
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Path of Unix Domain Socket
+static char g_daemon_socket_path[sizeof(((struct sockaddr_un *)0)->sun_path)] = DAEMON_SOCKET_PATH;
+
+// Signal Flags
+static volatile sig_atomic_t g_daemon_exit = 0;
+static volatile sig_atomic_t g_daemon_reload = 0;
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Socket Path
+int set_daemon_socket_path(const char *p_socket_path)
+{
+    int err = ERR_SUCCESS;
+
+    // Validate Input Parameter
+    if ((p_socket_path == NULL) || (strlen(p_socket_path) == 0) || (strlen(p_socket_path) >= sizeof(g_daemon_socket_path)))
+    {
+        ERROR_PRINTF("%s: Invalid Socket Path! (p_socket_path=0x%p)\r\n", __func__, p_socket_path);
+        err = ERR_INVALID_PARAM;
+        goto SET_DAEMON_SOCKET_PATH_EXIT;
+    }
+
+    strcpy(g_daemon_socket_path, p_socket_path);
+    DEBUG_PRINTF("%s: Daemon Socket: \"%s\".\r\n", __func__, g_daemon_socket_path);
+
+SET_DAEMON_SOCKET_PATH_EXIT:
+    return err;
+}
+
+static void daemon_signal_handler(int signal_number)
+{
+    if (signal_number == SIGHUP)
+        g_daemon_reload = 1;
+    else // SIGTERM, SIGINT
+        g_daemon_exit = 1;
+}
+
+static int init_daemon_signal(void)
+{
+    struct sigaction action;
+
+    // No SA_RESTART, so that poll() is interrupted by signals
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = daemon_signal_handler;
+    sigemptyset(&action.sa_mask);
+    if ((sigaction(SIGTERM, &action, NULL) < 0) || (sigaction(SIGINT, &action, NULL) < 0) || (sigaction(SIGHUP, &action, NULL) < 0))
+        return ERR_IO_ERROR;
+
+    // Client closed early: Fail the write() instead of being killed
+    signal(SIGPIPE, SIG_IGN);
+
+    return ERR_SUCCESS;
+}
+
+static int open_daemon_socket(struct sockaddr_un *p_addr)
+{
+    int socket_fd = -1,
+        probe_fd = -1;
+
+    memset(p_addr, 0, sizeof(struct sockaddr_un));
+    p_addr->sun_family = AF_UNIX;
+    strcpy(p_addr->sun_path, g_daemon_socket_path);
+
+    // Check if Another Daemon is Running, Otherwise Remove Stale Socket
+    probe_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe_fd >= 0)
+    {
+        if (connect(probe_fd, (struct sockaddr *)p_addr, sizeof(struct sockaddr_un)) == 0)
+        {
+            ERROR_PRINTF("%s: Daemon is already running on \"%s\"!\r\n", __func__, g_daemon_socket_path);
+            close(probe_fd);
+            return -1;
+        }
+        close(probe_fd);
+    }
+    unlink(g_daemon_socket_path);
+
+    // Non-blocking: Pending Connections are Accepted until None Left
+    socket_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (socket_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to create socket! errno=%d.\r\n", __func__, errno);
+        return -1;
+    }
+
+    if ((bind(socket_fd, (struct sockaddr *)p_addr, sizeof(struct sockaddr_un)) < 0) || (listen(socket_fd, 16) < 0))
+    {
+        ERROR_PRINTF("%s: Fail to listen on \"%s\"! errno=%d.\r\n", __func__, g_daemon_socket_path, errno);
+        close(socket_fd);
+        return -1;
+    }
+
+    return socket_fd;
+}
+
+static unsigned long long get_daemon_time_ms(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000ULL + (unsigned long long)now.tv_nsec / 1000000ULL;
+}
+
+// Receive Available Part of Request Line (Non-blocking), Complete at Newline, EOF or Full Buffer
+static int receive_daemon_request(struct daemon_client *p_client, bool *p_complete)
+{
+    ssize_t read_len = 0;
+
+    *p_complete = false;
+    while (p_client->request_len < (sizeof(p_client->request) - 1))
+    {
+        read_len = read(p_client->fd, &p_client->request[p_client->request_len], sizeof(p_client->request) - 1 - p_client->request_len);
+        if (read_len < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) // Rest not Arrived yet
+                return ERR_SUCCESS;
+            return ERR_IO_ERROR;
+        }
+        if (read_len == 0) // EOF
+            break;
+        p_client->request_len += read_len;
+
+        if (memchr(p_client->request, '\n', p_client->request_len) != NULL)
+            break;
+    }
+
+    *p_complete = true;
+    return ERR_SUCCESS;
+}
+
+static int serve_daemon_request(int client_fd, char *p_request, daemon_request_handler request_handler)
+{
+    int err = ERR_SUCCESS,
+        result = ERR_SUCCESS,
+        stdout_fd = -1,
+        trailer_len = 0;
+    char trailer[16] = {0},
+         *p_newline = NULL;
+    struct timeval timeout;
+
+    p_newline = strchr(p_request, '\n');
+    if (p_newline != NULL)
+        *p_newline = '\0';
+    DEBUG_PRINTF("%s: Request \"%s\".\r\n", __func__, p_request);
+
+    // Response is Written through stdout: Blocking, but Make Sure Slow Client not Blocking Daemon
+    fcntl(client_fd, F_SETFL, fcntl(client_fd, F_GETFL) & ~O_NONBLOCK);
+    timeout.tv_sec = DAEMON_REQUEST_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (DAEMON_REQUEST_TIMEOUT_MS % 1000) * 1000;
+    setsockopt(client_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    // Handle Request with stdout Redirected to Client, so Existing Output Formats are Reused
+    fflush(stdout);
+    stdout_fd = dup(STDOUT_FILENO);
+    if ((stdout_fd < 0) || (dup2(client_fd, STDOUT_FILENO) < 0))
+    {
+        ERROR_PRINTF("%s: Fail to redirect stdout! errno=%d.\r\n", __func__, errno);
+        err = ERR_IO_ERROR;
+        goto SERVE_DAEMON_REQUEST_EXIT;
+    }
+
+    result = request_handler(p_request);
+
+    fflush(stdout);
+    dup2(stdout_fd, STDOUT_FILENO);
+
+    // Trailer: NUL + Result of Request
+    trailer_len = snprintf(trailer, sizeof(trailer), "%c%d\n", '\0', result);
+    if (send(client_fd, trailer, trailer_len, MSG_NOSIGNAL) != trailer_len)
+    {
+        ERROR_PRINTF("%s: Fail to send result! errno=%d.\r\n", __func__, errno);
+        err = ERR_IO_ERROR;
+    }
+
+SERVE_DAEMON_REQUEST_EXIT:
+    if (stdout_fd >= 0)
+        close(stdout_fd);
+    return err;
+}
+
+static int read_daemon_events(int inotify_fd, int dev_wd, int file_wd, const char *p_file_name, unsigned int *p_refresh_flags)
+{
+    char event_buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    const struct inotify_event *p_event = NULL;
+    ssize_t read_len = 0,
+            offset = 0;
+
+    while ((read_len = read(inotify_fd, event_buf, sizeof(event_buf))) > 0)
+    {
+        for (offset = 0; offset < read_len; offset += sizeof(struct inotify_event) + p_event->len)
+        {
+            p_event = (const struct inotify_event *)&event_buf[offset];
+
+            if (p_event->mask & IN_Q_OVERFLOW) // Events Lost
+                *p_refresh_flags |= DAEMON_REFRESH_ALL;
+            else if ((p_event->wd == dev_wd) && (p_event->len > 0) && (strncmp(p_event->name, "hidraw", 6) == 0))
+                *p_refresh_flags |= DAEMON_REFRESH_HID_DEVICE;
+            else if ((p_event->wd == file_wd) && (p_event->len > 0) && (strcmp(p_event->name, p_file_name) == 0))
+                *p_refresh_flags |= DAEMON_REFRESH_MAPPING_FILE;
+        }
+    }
+
+    return ERR_SUCCESS;
+}
+
+static int detach_daemon(void)
+{
+    pid_t pid = 0;
+    int null_fd = -1;
+
+    fflush(stdout);
+    fflush(stderr);
+
+    pid = fork();
+    if (pid < 0)
+    {
+        ERROR_PRINTF("%s: Fail to fork! errno=%d.\r\n", __func__, errno);
+        return ERR_IO_ERROR;
+    }
+    if (pid > 0) // Parent: Daemon is Ready to Serve
+        exit(ERR_SUCCESS);
+
+    // Child
+    setsid();
+    null_fd = open("/dev/null", O_RDWR);
+    if (null_fd >= 0)
+    {
+        dup2(null_fd, STDIN_FILENO);
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        if (null_fd > STDERR_FILENO)
+            close(null_fd);
+    }
+
+    return ERR_SUCCESS;
+}
+
+// Daemon
+int run_daemon(const char *p_watch_file_path, bool foreground, daemon_refresh_handler refresh_handler, daemon_request_handler request_handler)
+{
+    int err = ERR_SUCCESS,
+        listen_fd = -1,
+        inotify_fd = -1,
+        client_fd = -1,
+        client_err = ERR_SUCCESS,
+        dev_wd = -1,
+        file_wd = -1,
+        poll_timeout_ms = 0,
+        remaining_ms = 0,
+        ret = 0;
+    unsigned int refresh_flags = 0;
+    unsigned long long now_ms = 0;
+    size_t client_count = 0,
+           client_index = 0;
+    bool request_complete = false;
+    char watch_dir[MAX_PATH] = {0};
+    const char *p_file_name = "";
+    char *p_slash = NULL;
+    struct sockaddr_un addr;
+    struct daemon_client clients[DAEMON_CLIENT_COUNT_MAX];
+    struct pollfd poll_fds[2 + DAEMON_CLIENT_COUNT_MAX];
+
+    // Validate Input Parameter
+    if ((refresh_handler == NULL) || (request_handler == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (refresh_handler=0x%p, request_handler=0x%p)\r\n", __func__, refresh_handler, request_handler);
+        err = ERR_INVALID_PARAM;
+        goto RUN_DAEMON_EXIT;
+    }
+
+    // stdout is Redirected to Clients while Serving Requests, so Keep Debug Message out of Replies
+    g_debug_to_stderr = true;
+
+    // Listen on Unix Domain Socket
+    listen_fd = open_daemon_socket(&addr);
+    if (listen_fd < 0)
+    {
+        err = ERR_IO_ERROR;
+        goto RUN_DAEMON_EXIT;
+    }
+
+    // Watch hidraw Nodes & Mapping File
+    inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to init inotify! errno=%d.\r\n", __func__, errno);
+        err = ERR_IO_ERROR;
+        goto RUN_DAEMON_EXIT_1;
+    }
+
+    dev_wd = inotify_add_watch(inotify_fd, DAEMON_DEV_DIR, IN_CREATE | IN_DELETE | IN_ATTRIB);
+    if (dev_wd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to watch \"%s\"! errno=%d.\r\n", __func__, DAEMON_DEV_DIR, errno);
+        err = ERR_IO_ERROR;
+        goto RUN_DAEMON_EXIT_1;
+    }
+
+    if ((p_watch_file_path != NULL) && (strcmp(p_watch_file_path, "") != 0))
+    {
+        // Watch Parent Directory, so Replaced File (Rename / Re-create) is also Caught
+        strncpy(watch_dir, p_watch_file_path, sizeof(watch_dir) - 1);
+        p_slash = strrchr(watch_dir, '/');
+        if (p_slash == NULL)
+        {
+            p_file_name = p_watch_file_path;
+            strcpy(watch_dir, ".");
+        }
+        else
+        {
+            p_file_name = p_watch_file_path + (p_slash - watch_dir) + 1;
+            if (p_slash == watch_dir) // Root Directory
+                p_slash[1] = '\0';
+            else
+                *p_slash = '\0';
+        }
+
+        file_wd = inotify_add_watch(inotify_fd, watch_dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+        if (file_wd < 0)
+        {
+            ERROR_PRINTF("%s: Fail to watch \"%s\"! errno=%d.\r\n", __func__, watch_dir, errno);
+            err = ERR_IO_ERROR;
+            goto RUN_DAEMON_EXIT_1;
+        }
+    }
+
+    // Gather Data Once
+    err = refresh_handler(DAEMON_REFRESH_ALL);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to gather system info.! err=0x%x.\r\n", __func__, err);
+        goto RUN_DAEMON_EXIT_1;
+    }
+
+    err = init_daemon_signal();
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to install signal handlers! errno=%d.\r\n", __func__, errno);
+        goto RUN_DAEMON_EXIT_1;
+    }
+
+    // Run in Background (Parent Returns after Socket Ready)
+    if (foreground == false)
+    {
+        err = detach_daemon();
+        if (err != ERR_SUCCESS)
+            goto RUN_DAEMON_EXIT_1;
+    }
+    DEBUG_PRINTF("%s: Listening on \"%s\".\r\n", __func__, g_daemon_socket_path);
+
+    while (g_daemon_exit == 0)
+    {
+        if (g_daemon_reload != 0) // SIGHUP
+        {
+            g_daemon_reload = 0;
+            refresh_flags |= DAEMON_REFRESH_ALL;
+        }
+
+        // Poll Listening Socket (while Client Slot Free), inotify & Clients Sending Request
+        poll_fds[0].fd = (client_count < DAEMON_CLIENT_COUNT_MAX) ? listen_fd : -1; // Negative fd is Ignored
+        poll_fds[0].events = POLLIN;
+        poll_fds[0].revents = 0;
+        poll_fds[1].fd = inotify_fd;
+        poll_fds[1].events = POLLIN;
+        poll_fds[1].revents = 0;
+        for (client_index = 0; client_index < client_count; client_index++)
+        {
+            poll_fds[2 + client_index].fd = clients[client_index].fd;
+            poll_fds[2 + client_index].events = POLLIN;
+            poll_fds[2 + client_index].revents = 0;
+        }
+
+        // Refresh after Changes Settled, Wake up at Earliest Request Timeout
+        poll_timeout_ms = (refresh_flags != 0) ? DAEMON_REFRESH_DELAY_MS : -1;
+        now_ms = get_daemon_time_ms();
+        for (client_index = 0; client_index < client_count; client_index++)
+        {
+            remaining_ms = (clients[client_index].deadline_ms > now_ms) ? (int)(clients[client_index].deadline_ms - now_ms) : 0;
+            if ((poll_timeout_ms < 0) || (remaining_ms < poll_timeout_ms))
+                poll_timeout_ms = remaining_ms;
+        }
+
+        ret = poll(poll_fds, 2 + client_count, poll_timeout_ms);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            ERROR_PRINTF("%s: Fail to poll! errno=%d.\r\n", __func__, errno);
+            err = ERR_IO_ERROR;
+            break;
+        }
+        if ((ret == 0) && (refresh_flags != 0)) // Timeout
+        {
+            DEBUG_PRINTF("%s: Refresh (flags=0x%x).\r\n", __func__, refresh_flags);
+            refresh_handler(refresh_flags);
+            refresh_flags = 0;
+        }
+
+        if (poll_fds[1].revents & POLLIN)
+            read_daemon_events(inotify_fd, dev_wd, file_wd, p_file_name, &refresh_flags);
+
+        // Receive Requests, Serve Complete Ones & Drop Timed-out Ones
+        // (Backwards, so Last Client Moved into a Removed Slot is Already Handled)
+        for (client_index = client_count; client_index-- > 0; )
+        {
+            request_complete = false;
+            client_err = ERR_SUCCESS;
+            if (poll_fds[2 + client_index].revents != 0)
+                client_err = receive_daemon_request(&clients[client_index], &request_complete);
+
+            if (request_complete)
+            {
+                if (clients[client_index].request_len > 0) // Otherwise Connection Probe (e.g. Another Daemon Starting)
+                {
+                    // Never Answer from Stale Data
+                    if (refresh_flags != 0)
+                    {
+                        DEBUG_PRINTF("%s: Refresh (flags=0x%x).\r\n", __func__, refresh_flags);
+                        refresh_handler(refresh_flags);
+                        refresh_flags = 0;
+                    }
+                    serve_daemon_request(clients[client_index].fd, clients[client_index].request, request_handler);
+                }
+            }
+            else if (client_err != ERR_SUCCESS)
+            {
+                ERROR_PRINTF("%s: Fail to receive request! errno=%d.\r\n", __func__, errno);
+            }
+            else if (get_daemon_time_ms() >= clients[client_index].deadline_ms)
+            {
+                ERROR_PRINTF("%s: Request Timeout!\r\n", __func__);
+            }
+            else // Rest of Request not Arrived yet
+            {
+                continue;
+            }
+
+            close(clients[client_index].fd);
+            clients[client_index] = clients[--client_count];
+        }
+
+        // Accept New Clients
+        if (poll_fds[0].revents & POLLIN)
+        {
+            while (client_count < DAEMON_CLIENT_COUNT_MAX)
+            {
+                client_fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                if (client_fd < 0)
+                    break;
+
+                memset(&clients[client_count], 0, sizeof(struct daemon_client));
+                clients[client_count].fd = client_fd;
+                clients[client_count].deadline_ms = get_daemon_time_ms() + DAEMON_REQUEST_TIMEOUT_MS;
+                client_count++;
+                client_fd = -1;
+            }
+        }
+    }
+    DEBUG_PRINTF("%s: Exit.\r\n", __func__);
+
+    for (client_index = 0; client_index < client_count; client_index++)
+        close(clients[client_index].fd);
+
+RUN_DAEMON_EXIT_1:
+    if (inotify_fd >= 0)
+        close(inotify_fd);
+    if (listen_fd >= 0)
+    {
+        close(listen_fd);
+        unlink(g_daemon_socket_path);
+    }
+
+RUN_DAEMON_EXIT:
+    return err;
+}
+
+// Client
+int send_daemon_request(const char *p_request, int *p_result)
+{
+    int err = ERR_SUCCESS,
+        socket_fd = -1;
+    ssize_t read_len = 0,
+            body_len = 0;
+    size_t trailer_len = 0;
+    bool trailer_found = false;
+    char buf[4096] = {0},
+         trailer[16] = {0},
+         *p_nul = NULL;
+    struct sockaddr_un addr;
+    struct timeval timeout;
+
+    // Validate Input Parameter
+    if ((p_request == NULL) || (p_result == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_request=0x%p, p_result=0x%p)\r\n", __func__, p_request, p_result);
+        err = ERR_INVALID_PARAM;
+        goto SEND_DAEMON_REQUEST_EXIT;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, g_daemon_socket_path);
+
+    socket_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if ((socket_fd < 0) || (connect(socket_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0))
+    {
+        ERROR_PRINTF("%s: Fail to connect to daemon on \"%s\"! errno=%d.\r\n", __func__, g_daemon_socket_path, errno);
+        err = ERR_DEVICE_NOT_FOUND;
+        goto SEND_DAEMON_REQUEST_EXIT_1;
+    }
+
+    timeout.tv_sec = DAEMON_RESPONSE_TIMEOUT_MS / 1000;
+    timeout.tv_usec = (DAEMON_RESPONSE_TIMEOUT_MS % 1000) * 1000;
+    setsockopt(socket_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    // Send Request Line
+    snprintf(buf, sizeof(buf), "%s\n", p_request);
+    if (send(socket_fd, buf, strlen(buf), MSG_NOSIGNAL) != (ssize_t)strlen(buf))
+    {
+        ERROR_PRINTF("%s: Fail to send request! errno=%d.\r\n", __func__, errno);
+        err = ERR_IO_ERROR;
+        goto SEND_DAEMON_REQUEST_EXIT_1;
+    }
+    shutdown(socket_fd, SHUT_WR);
+
+    // Receive Response: Output + NUL + Result
+    while ((read_len = read(socket_fd, buf, sizeof(buf))) > 0)
+    {
+        body_len = read_len;
+        if (trailer_found == false)
+        {
+            p_nul = (char *)memchr(buf, '\0', read_len);
+            if (p_nul != NULL)
+            {
+                body_len = p_nul - buf;
+                trailer_found = true;
+            }
+            fwrite(buf, 1, body_len, stdout);
+            if (trailer_found == false)
+                continue;
+            body_len++; // Skip NUL
+        }
+        else
+        {
+            body_len = 0;
+        }
+
+        // Collect Trailer
+        if ((read_len - body_len) > (ssize_t)(sizeof(trailer) - 1 - trailer_len))
+            read_len = body_len + (sizeof(trailer) - 1 - trailer_len);
+        memcpy(&trailer[trailer_len], &buf[body_len], read_len - body_len);
+        trailer_len += read_len - body_len;
+    }
+    fflush(stdout);
+
+    if (read_len < 0)
+    {
+        ERROR_PRINTF("%s: Fail to receive response! errno=%d.\r\n", __func__, errno);
+        err = (errno == EAGAIN) ? ERR_IO_TIMEOUT : ERR_IO_ERROR;
+        goto SEND_DAEMON_REQUEST_EXIT_1;
+    }
+    if ((trailer_found == false) || (trailer_len == 0))
+    {
+        ERROR_PRINTF("%s: Incomplete response!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto SEND_DAEMON_REQUEST_EXIT_1;
+    }
+
+    *p_result = (int)strtol(trailer, NULL, 10);
+    err = ERR_SUCCESS;
+
+SEND_DAEMON_REQUEST_EXIT_1:
+    if (socket_fd >= 0)
+        close(socket_fd);
+
+SEND_DAEMON_REQUEST_EXIT:
+    return err;
+}
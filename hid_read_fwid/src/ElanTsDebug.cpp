@@ -1,15 +0,0 @@
-//
-// ElanTsDebug.cpp: Implementation of Elan Touchscreen Debug Utility.
-//
-// Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
-//////////////////////////////////////////////////////////////////////
-
-#include "ElanTsDebug.h"
-
-//////////////////////////////////////////////////////////////////////
-// Global Variable
-//////////////////////////////////////////////////////////////////////
-
-// Debug
-bool g_debug = false;
-
@@ -15,6 +15,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>             /* read, close */
+#include <dirent.h>             /* opendir, readdir, closedir */
+#include "BuildConfig.h"
 #include "ErrCode.h"
 #include "ElanTsEdidUtility.h"
 
@@ -22,12 +26,163 @@
  * Global Variable Declaration
  ***************************************************/
 
+// Root of DRM Connectors in sysfs
+static char g_drm_sysfs_root[MAX_PATH] = DRM_SYSFS_ROOT;
+
 /***************************************************
  * Function Implements
  ***************************************************/
 
-// EDID
-int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+// DRM sysfs Root
+int set_drm_sysfs_root(const char *p_drm_sysfs_root)
+{
+    int err = ERR_SUCCESS;
+
+    // Check if Parameter Invalid
+    if ((p_drm_sysfs_root == NULL) || (strlen(p_drm_sysfs_root) == 0) || (strlen(p_drm_sysfs_root) >= sizeof(g_drm_sysfs_root)))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_drm_sysfs_root=0x%p)\r\n", __func__, p_drm_sysfs_root);
+        err = ERR_INVALID_PARAM;
+        goto SET_DRM_SYSFS_ROOT_EXIT;
+    }
+
+    strcpy(g_drm_sysfs_root, p_drm_sysfs_root);
+    DEBUG_PRINTF("%s: DRM sysfs root: \"%s\".\r\n", __func__, g_drm_sysfs_root);
+
+SET_DRM_SYSFS_ROOT_EXIT:
+    return err;
+}
+
+// Check if EDID Base Block Starts with a Known Header
+// (Standard header, or AUO / BOE panel blobs accepted by the modetest parser as well.)
+static bool is_known_edid_header(const unsigned char *p_edid)
+{
+    const unsigned char edid_headers[][8] =
+    {
+        {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},   // STANDARD_EDID_HEADER
+        {0xb3, 0x6f, 0x02, 0x00, 0xb0, 0x04, 0xec, 0x04},   // AUO_EDID_HEADER
+        {0xac, 0x70, 0x02, 0x00, 0xb0, 0x04, 0x00, 0x05},   // BOE_EDID_HEADER
+    };
+    size_t index = 0;
+
+    for(index = 0; index < (sizeof(edid_headers) / sizeof(edid_headers[0])); index++)
+    {
+        if(memcmp(p_edid, edid_headers[index], sizeof(edid_headers[index])) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+// Check if DRM Connector is Built-in Panel (eDP / LVDS / DSI)
+static bool is_internal_drm_connector(const char *p_connector_name)
+{
+    return ((strstr(p_connector_name, "-eDP-") != NULL) || \
+            (strstr(p_connector_name, "-LVDS-") != NULL) || \
+            (strstr(p_connector_name, "-DSI-") != NULL));
+}
+
+// EDID (sysfs)
+int get_edid_manufacturer_product_code_from_sysfs(unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+{
+    int err = ERR_SUCCESS,
+        fd = -1,
+        read_bytes = 0;
+    unsigned char edid[EDID_BLOCK_SIZE] = {0};
+    char edid_file_path[MAX_PATH * 2] = {0},
+         found_connector_name[MAX_PATH] = {0};
+    bool edid_found = false,
+         found_connector_internal = false,
+         connector_internal = false;
+    unsigned short manufacturer_code = 0,
+                   product_code = 0;
+    DIR *pDirectory = NULL;
+    struct dirent *pDirEntry = NULL;
+
+    // Check if Parameter Invalid
+    if ((p_manufacturer_code == NULL) || (p_product_code == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_manufacturer_code=0x%p, p_product_code=0x%p)\r\n", __func__, p_manufacturer_code, p_product_code);
+        err = ERR_INVALID_PARAM;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT;
+    }
+
+    // Open DRM Directory
+    pDirectory = opendir(g_drm_sysfs_root);
+    if (pDirectory == NULL)
+    {
+        DEBUG_PRINTF("%s: Fail to Open Directory %s! errno=%d.\r\n", __func__, g_drm_sysfs_root, errno);
+        err = ERR_FILE_NOT_FOUND;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT;
+    }
+
+    // Traverse DRM Connectors (card*-*)
+    while ((pDirEntry = readdir(pDirectory)) != NULL)
+    {
+        if ((strncmp(pDirEntry->d_name, "card", 4) != 0) || (strchr(pDirEntry->d_name, '-') == NULL))
+            continue;
+
+        /* Built-in panel is preferred; among the same kind, pick the smallest name
+         * so that the result does not depend on readdir() order. */
+        connector_internal = is_internal_drm_connector(pDirEntry->d_name);
+        if (edid_found == true)
+        {
+            if ((found_connector_internal == true) && (connector_internal == false))
+                continue;
+            if ((found_connector_internal == connector_internal) && (strcmp(pDirEntry->d_name, found_connector_name) > 0))
+                continue;
+        }
+
+        // Read EDID Base Block (Empty if Connector Disconnected)
+        snprintf(edid_file_path, sizeof(edid_file_path), "%s/%s/edid", g_drm_sysfs_root, pDirEntry->d_name);
+        fd = open(edid_file_path, O_RDONLY);
+        if (fd < 0)
+            continue;
+        read_bytes = read(fd, edid, sizeof(edid));
+        close(fd);
+        if (read_bytes < 12 /* Header (8) + Manufacturer Code (2) + Product Code (2) */)
+            continue;
+
+        // Validate EDID Header
+        if (is_known_edid_header(edid) == false)
+        {
+            DEBUG_PRINTF("%s: Invalid EDID header in \"%s\".\r\n", __func__, edid_file_path);
+            continue;
+        }
+
+        /* Keep the same byte order as the hex dump of modetest ("00ffffffffffff00" + "06af" + "3d31"),
+         * which is the key format of FWID mapping table. */
+        manufacturer_code = (unsigned short)((edid[8] << 8) | edid[9]);
+        product_code      = (unsigned short)((edid[10] << 8) | edid[11]);
+        DEBUG_PRINTF("%s: \"%s\": manufacturer_code: %04x, product_code: %04x.\r\n", __func__, \
+                     pDirEntry->d_name, manufacturer_code, product_code);
+
+        strncpy(found_connector_name, pDirEntry->d_name, sizeof(found_connector_name) - 1);
+        found_connector_internal = connector_internal;
+        *p_manufacturer_code = manufacturer_code;
+        *p_product_code = product_code;
+        edid_found = true;
+    }
+
+    // Close Directory
+    closedir(pDirectory);
+
+    if (edid_found == false)
+    {
+        err = ERR_DATA_NOT_FOUND;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT;
+    }
+    DEBUG_PRINTF("%s: EDID from \"%s\".\r\n", __func__, found_connector_name);
+
+    // Success
+    err = ERR_SUCCESS;
+
+GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT:
+    return err;
+}
+
+// EDID (modetest)
+int get_edid_manufacturer_product_code_from_modetest(unsigned short *p_manufacturer_code, unsigned short *p_product_code)
 {
     int err = ERR_SUCCESS;
     char buf[1024] = {0};
@@ -44,7 +199,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     {
         ERROR_PRINTF("%s: Invalid Parameter! (p_manufacturer_code=0x%p, p_product_code=0x%p)\r\n", __func__, p_manufacturer_code, p_product_code);
         err = ERR_INVALID_PARAM;
-        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT;
     }
 
     /* Open the command for reading. */
@@ -53,7 +208,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     {
         ERROR_PRINTF("%s: Command \"%s\" failed! errno=%d.\r\n", __func__, MODETEST_CMD, errno);
         err = ERR_SYSTEM_COMMAND_FAIL;
-        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT;
     }
 
     /* Read the output line by line */
@@ -103,7 +258,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     {
         // Terminate the process and return error code
         err = ERR_DATA_NOT_FOUND;
-        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT;
     }
 
     /* Parse found EDID information */
@@ -126,6 +281,24 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     // Success
     err = ERR_SUCCESS;
 
+GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT:
+    return err;
+}
+
+// EDID
+int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+{
+    int err = ERR_SUCCESS;
+
+    // Read Binary EDID from sysfs
+    err = get_edid_manufacturer_product_code_from_sysfs(p_manufacturer_code, p_product_code);
+    if ((err == ERR_SUCCESS) || (err == ERR_INVALID_PARAM))
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+
+    // Fallback: Parse EDID from Output of modetest
+    DEBUG_PRINTF("%s: No EDID from sysfs (err=0x%x), fallback to \"%s\".\r\n", __func__, err, MODETEST_CMD);
+    err = get_edid_manufacturer_product_code_from_modetest(p_manufacturer_code, p_product_code);
+
 GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT:
     return err;
 }
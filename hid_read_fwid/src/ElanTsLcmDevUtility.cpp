@@ -14,6 +14,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>             /* close */
+#include <sys/mman.h>           /* mmap, munmap */
+#include <sys/stat.h>
 #include "ErrCode.h"
 #include "ElanTsLcmDevUtility.h"
 
@@ -52,6 +57,13 @@ int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_info *p_dev_in
     // Read mapping file line by line
     while (fgets(line, sizeof(line), fd_mapping_file) != NULL)
     {
+        // Make Sure Not Overrun Input Buffer (Use FWID Mapping Database for Larger Tables)
+        if ((size_t)dev_info_index >= (dev_info_size / sizeof(struct lcm_dev_info)))
+        {
+            DEBUG_PRINTF("%s: Device Info. Buffer Full (%d)! Remaining lines are ignored.\r\n", __func__, dev_info_index);
+            break;
+        }
+
         token_index = 0;
         token = strtok(line, ",");
         while (token != NULL)
@@ -200,3 +212,432 @@ GET_FWID_FROM_EDID_EXIT:
     return err;
 }
 
+
+/***************************************************
+ * FWID Mapping Database
+ ***************************************************/
+
+// Hash of (Manufacturer Code, Product Code) into Bucket Count (Power of 2)
+static unsigned int fwid_mapping_hash(unsigned short manufacturer_code, unsigned short product_code, unsigned int bucket_count)
+{
+    unsigned int key = ((unsigned int)manufacturer_code << 16) | product_code,
+                 bucket_bits = 0;
+
+    while ((1U << bucket_bits) < bucket_count)
+        bucket_bits++;
+
+    // Only One Bucket (Shift by 32 is Undefined)
+    if (bucket_bits == 0)
+        return 0;
+
+    // Fibonacci Hashing: Take the High Bits of the Product
+    return (key * 2654435761U) >> (32 - bucket_bits);
+}
+
+// Parse Hex Field of Mapping File (Empty Field => 0)
+static unsigned short parse_fwid_mapping_field(const char *p_field, size_t field_len)
+{
+    char field[FWID_LENGTH_MAX] = {0};
+
+    if ((field_len == 0) || (field_len >= sizeof(field)))
+        return 0;
+
+    memcpy(field, p_field, field_len);
+    return (unsigned short)strtol(field, NULL, 16);
+}
+
+// Build Hash Index of All Entries
+static int build_fwid_mapping_index(struct fwid_mapping_db *p_db)
+{
+    int err = ERR_SUCCESS;
+    unsigned int bucket_count = 1,
+                 bucket_index = 0,
+                 entry_index = 0,
+                 chain_index = 0;
+    bool duplicated = false;
+
+    // Load Factor <= 0.5
+    while (bucket_count < (p_db->entry_count * 2))
+        bucket_count <<= 1;
+
+    p_db->p_bucket = (unsigned int *)malloc(sizeof(unsigned int) * bucket_count);
+    if (p_db->p_bucket == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to allocate %d buckets!\r\n", __func__, bucket_count);
+        err = ERR_NO_MEMORY;
+        goto BUILD_FWID_MAPPING_INDEX_EXIT;
+    }
+    memset(p_db->p_bucket, 0xFF, sizeof(unsigned int) * bucket_count); // FWID_MAPPING_NO_ENTRY
+    p_db->bucket_count = bucket_count;
+
+    for (entry_index = 0; entry_index < p_db->entry_count; entry_index++)
+    {
+        bucket_index = fwid_mapping_hash(p_db->p_entry[entry_index].manufacturer_code, p_db->p_entry[entry_index].product_code, bucket_count);
+
+        // The first row wins if a panel is listed twice (same as linear scan of get_fwid_from_edid())
+        duplicated = false;
+        for (chain_index = p_db->p_bucket[bucket_index]; chain_index != FWID_MAPPING_NO_ENTRY; chain_index = p_db->p_entry[chain_index].next)
+        {
+            if ((p_db->p_entry[chain_index].manufacturer_code == p_db->p_entry[entry_index].manufacturer_code) && \
+                (p_db->p_entry[chain_index].product_code == p_db->p_entry[entry_index].product_code))
+            {
+                DEBUG_PRINTF("%s: Duplicated panel %04x.%04x is ignored.\r\n", __func__, \
+                             p_db->p_entry[entry_index].manufacturer_code, p_db->p_entry[entry_index].product_code);
+                duplicated = true;
+                break;
+            }
+        }
+
+        p_db->p_entry[entry_index].next = FWID_MAPPING_NO_ENTRY;
+        if (duplicated == true)
+            continue;
+
+        // Insert to Head of Chain
+        p_db->p_entry[entry_index].next = p_db->p_bucket[bucket_index];
+        p_db->p_bucket[bucket_index] = entry_index;
+    }
+
+BUILD_FWID_MAPPING_INDEX_EXIT:
+    return err;
+}
+
+int parse_fwid_mapping_db(FILE *fd_mapping_file, struct fwid_mapping_db *p_db)
+{
+    int err = ERR_SUCCESS;
+    char line[1024] = {0},
+         *p_field[3] = {NULL, NULL, NULL},
+         *p_cursor = NULL;
+    size_t field_len[3] = {0, 0, 0};
+    unsigned int field_index = 0;
+    unsigned short manufacturer_code = 0,
+                   product_code = 0;
+    struct fwid_mapping_entry *p_new_entry = NULL;
+    char dot = 0;
+
+    if ((fd_mapping_file == NULL) || (p_db == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (fd_mapping_file=0x%p, p_db=0x%p)\r\n", __func__, fd_mapping_file, p_db);
+        err = ERR_INVALID_PARAM;
+        goto PARSE_FWID_MAPPING_DB_EXIT;
+    }
+    memset(p_db, 0, sizeof(struct fwid_mapping_db));
+
+    // Read mapping file line by line: "${manufacturer}.${product},${chrome_fwid},${windows_fwid},"
+    while (fgets(line, sizeof(line), fd_mapping_file) != NULL)
+    {
+        // Split Fields (Empty Fields Kept, unlike strtok())
+        memset(p_field, 0, sizeof(p_field));
+        memset(field_len, 0, sizeof(field_len));
+        p_cursor = line;
+        for (field_index = 0; field_index < 3; field_index++)
+        {
+            p_field[field_index] = p_cursor;
+            field_len[field_index] = strcspn(p_cursor, ",\r\n");
+            p_cursor += field_len[field_index];
+            if (*p_cursor != ',')
+                break;
+            p_cursor++;
+        }
+
+        // Panel Info. (Header Line or Invalid Lines Skipped)
+        if ((field_len[0] != 9) || (sscanf(p_field[0], "%4hx%c%4hx", &manufacturer_code, &dot, &product_code) != 3) || (dot != '.'))
+        {
+            DEBUG_PRINTF("%s: Skip line \"%.*s\".\r\n", __func__, (int)field_len[0], line);
+            continue;
+        }
+
+        // Grow Entry Array
+        if (p_db->entry_count == p_db->entry_capacity)
+        {
+            p_new_entry = (struct fwid_mapping_entry *)realloc(p_db->p_entry, sizeof(struct fwid_mapping_entry) * ((p_db->entry_capacity == 0) ? 128 : (p_db->entry_capacity * 2)));
+            if (p_new_entry == NULL)
+            {
+                ERROR_PRINTF("%s: Fail to allocate memory for %d entries!\r\n", __func__, p_db->entry_capacity * 2);
+                err = ERR_NO_MEMORY;
+                goto PARSE_FWID_MAPPING_DB_EXIT_1;
+            }
+            p_db->p_entry = p_new_entry;
+            p_db->entry_capacity = (p_db->entry_capacity == 0) ? 128 : (p_db->entry_capacity * 2);
+        }
+
+        p_new_entry = &p_db->p_entry[p_db->entry_count];
+        p_new_entry->manufacturer_code = manufacturer_code;
+        p_new_entry->product_code = product_code;
+        p_new_entry->chrome_fwid = (p_field[1] != NULL) ? parse_fwid_mapping_field(p_field[1], field_len[1]) : 0;
+        p_new_entry->windows_fwid = (p_field[2] != NULL) ? parse_fwid_mapping_field(p_field[2], field_len[2]) : 0;
+        p_new_entry->next = FWID_MAPPING_NO_ENTRY;
+        p_db->entry_count++;
+    }
+
+    // Build Hash Index
+    err = build_fwid_mapping_index(p_db);
+    if (err != ERR_SUCCESS)
+        goto PARSE_FWID_MAPPING_DB_EXIT_1;
+    DEBUG_PRINTF("%s: %d entries, %d buckets.\r\n", __func__, p_db->entry_count, p_db->bucket_count);
+
+    // Success
+    err = ERR_SUCCESS;
+    goto PARSE_FWID_MAPPING_DB_EXIT;
+
+PARSE_FWID_MAPPING_DB_EXIT_1:
+    free_fwid_mapping_db(p_db);
+
+PARSE_FWID_MAPPING_DB_EXIT:
+    return err;
+}
+
+int load_fwid_mapping_db(const char *p_file_path, struct fwid_mapping_db *p_db)
+{
+    int err = ERR_SUCCESS,
+        fd = -1;
+    struct stat file_stat;
+    struct fwid_mapping_bin_header *p_header = NULL;
+    void *p_map = NULL;
+    FILE *fd_mapping_file = NULL;
+
+    if ((p_file_path == NULL) || (p_db == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_file_path=0x%p, p_db=0x%p)\r\n", __func__, p_file_path, p_db);
+        err = ERR_INVALID_PARAM;
+        goto LOAD_FWID_MAPPING_DB_EXIT;
+    }
+    memset(p_db, 0, sizeof(struct fwid_mapping_db));
+
+    fd = open(p_file_path, O_RDONLY);
+    if ((fd < 0) || (fstat(fd, &file_stat) < 0))
+    {
+        ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"! errno=%d.\r\n", __func__, p_file_path, errno);
+        err = ERR_FILE_NOT_FOUND;
+        goto LOAD_FWID_MAPPING_DB_EXIT_1;
+    }
+
+    //
+    // Precompiled Binary Table: Map & Use As-Is
+    //
+    if ((size_t)file_stat.st_size >= sizeof(struct fwid_mapping_bin_header))
+    {
+        p_map = mmap(NULL, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (p_map == MAP_FAILED)
+        {
+            ERROR_PRINTF("%s: Fail to map \"%s\"! errno=%d.\r\n", __func__, p_file_path, errno);
+            err = ERR_FILE_IO_ERROR;
+            goto LOAD_FWID_MAPPING_DB_EXIT_1;
+        }
+
+        p_header = (struct fwid_mapping_bin_header *)p_map;
+        if (memcmp(p_header->magic, FWID_MAPPING_BIN_MAGIC, sizeof(p_header->magic)) == 0)
+        {
+            // Validate Header & Size
+            if ((p_header->version != FWID_MAPPING_BIN_VERSION) || \
+                (p_header->bucket_count == 0) || ((p_header->bucket_count & (p_header->bucket_count - 1)) != 0) || \
+                ((size_t)file_stat.st_size != sizeof(struct fwid_mapping_bin_header) + \
+                                              (sizeof(unsigned int) * (size_t)p_header->bucket_count) + \
+                                              (sizeof(struct fwid_mapping_entry) * (size_t)p_header->entry_count)))
+            {
+                ERROR_PRINTF("%s: Invalid binary FWID mapping table \"%s\"! (version=%d, entry_count=%d, bucket_count=%d, size=%ld)\r\n", \
+                             __func__, p_file_path, p_header->version, p_header->entry_count, p_header->bucket_count, (long)file_stat.st_size);
+                munmap(p_map, file_stat.st_size);
+                err = ERR_DATA_PATTERN;
+                goto LOAD_FWID_MAPPING_DB_EXIT_1;
+            }
+
+            p_db->bucket_count = p_header->bucket_count;
+            p_db->p_bucket = (unsigned int *)((unsigned char *)p_map + sizeof(struct fwid_mapping_bin_header));
+            p_db->entry_count = p_header->entry_count;
+            p_db->entry_capacity = p_header->entry_count;
+            p_db->p_entry = (struct fwid_mapping_entry *)(p_db->p_bucket + p_db->bucket_count);
+            p_db->p_map = p_map;
+            p_db->map_size = file_stat.st_size;
+            DEBUG_PRINTF("%s: Binary table \"%s\" mapped (%d entries, %d buckets).\r\n", __func__, p_file_path, p_db->entry_count, p_db->bucket_count);
+
+            err = ERR_SUCCESS;
+            goto LOAD_FWID_MAPPING_DB_EXIT_1;
+        }
+
+        // Not a Binary Table
+        munmap(p_map, file_stat.st_size);
+    }
+
+    //
+    // Text Table: Parse & Build Index
+    //
+    fd_mapping_file = fdopen(fd, "r");
+    if (fd_mapping_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"! errno=%d.\r\n", __func__, p_file_path, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto LOAD_FWID_MAPPING_DB_EXIT_1;
+    }
+
+    err = parse_fwid_mapping_db(fd_mapping_file, p_db);
+    fclose(fd_mapping_file); // Also Close fd
+    goto LOAD_FWID_MAPPING_DB_EXIT;
+
+LOAD_FWID_MAPPING_DB_EXIT_1:
+    if (fd >= 0)
+        close(fd);
+
+LOAD_FWID_MAPPING_DB_EXIT:
+    return err;
+}
+
+int save_fwid_mapping_db(const char *p_file_path, struct fwid_mapping_db *p_db)
+{
+    int err = ERR_SUCCESS;
+    struct fwid_mapping_bin_header header;
+    FILE *fd = NULL;
+
+    if ((p_file_path == NULL) || (p_db == NULL) || (p_db->p_bucket == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_file_path=0x%p, p_db=0x%p)\r\n", __func__, p_file_path, p_db);
+        err = ERR_INVALID_PARAM;
+        goto SAVE_FWID_MAPPING_DB_EXIT;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FWID_MAPPING_BIN_MAGIC, sizeof(header.magic));
+    header.version = FWID_MAPPING_BIN_VERSION;
+    header.entry_count = p_db->entry_count;
+    header.bucket_count = p_db->bucket_count;
+
+    fd = fopen(p_file_path, "wb");
+    if (fd == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to create \"%s\"! errno=%d.\r\n", __func__, p_file_path, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto SAVE_FWID_MAPPING_DB_EXIT;
+    }
+
+    if ((fwrite(&header, sizeof(header), 1, fd) != 1) || \
+        (fwrite(p_db->p_bucket, sizeof(unsigned int), p_db->bucket_count, fd) != p_db->bucket_count) || \
+        (fwrite(p_db->p_entry, sizeof(struct fwid_mapping_entry), p_db->entry_count, fd) != p_db->entry_count))
+    {
+        ERROR_PRINTF("%s: Fail to write \"%s\"! errno=%d.\r\n", __func__, p_file_path, errno);
+        err = ERR_FILE_IO_ERROR;
+    }
+
+    if (fclose(fd) != 0)
+        err = ERR_FILE_IO_ERROR;
+
+SAVE_FWID_MAPPING_DB_EXIT:
+    return err;
+}
+
+void free_fwid_mapping_db(struct fwid_mapping_db *p_db)
+{
+    if (p_db == NULL)
+        return;
+
+    if (p_db->p_map != NULL) // Binary Table
+    {
+        munmap(p_db->p_map, p_db->map_size);
+    }
+    else // Text Table
+    {
+        free(p_db->p_entry);
+        free(p_db->p_bucket);
+    }
+
+    memset(p_db, 0, sizeof(struct fwid_mapping_db));
+    return;
+}
+
+int lookup_fwid_mapping_db(struct fwid_mapping_db *p_db, unsigned short manufacturer_code, unsigned short product_code, const struct fwid_mapping_entry **pp_entry)
+{
+    int err = ERR_DATA_NOT_FOUND;
+    unsigned int entry_index = FWID_MAPPING_NO_ENTRY,
+                 chain_length = 0;
+
+    if ((p_db == NULL) || (pp_entry == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_db=0x%p, pp_entry=0x%p)\r\n", __func__, p_db, pp_entry);
+        err = ERR_INVALID_PARAM;
+        goto LOOKUP_FWID_MAPPING_DB_EXIT;
+    }
+
+    if (p_db->bucket_count == 0)
+        goto LOOKUP_FWID_MAPPING_DB_EXIT;
+
+    entry_index = p_db->p_bucket[fwid_mapping_hash(manufacturer_code, product_code, p_db->bucket_count)];
+    while ((entry_index != FWID_MAPPING_NO_ENTRY) && (entry_index < p_db->entry_count) && (chain_length < p_db->entry_count))
+    {
+        if ((p_db->p_entry[entry_index].manufacturer_code == manufacturer_code) && \
+            (p_db->p_entry[entry_index].product_code == product_code))
+        {
+            *pp_entry = &p_db->p_entry[entry_index];
+            err = ERR_SUCCESS;
+            break;
+        }
+
+        entry_index = p_db->p_entry[entry_index].next;
+        chain_length++; // Guard against corrupted binary tables
+    }
+
+LOOKUP_FWID_MAPPING_DB_EXIT:
+    return err;
+}
+
+int get_fwid_from_mapping_db(struct fwid_mapping_db *p_db, unsigned short manufacturer_code, unsigned short product_code, system_type system, unsigned short *p_fwid)
+{
+    int err = ERR_SUCCESS;
+    unsigned short fwid = 0;
+    const struct fwid_mapping_entry *p_entry = NULL;
+
+    // Check if Parameter Invalid
+    if ((p_db == NULL) || (manufacturer_code == 0) || (product_code == 0) || (system == UNKNOWN) || (p_fwid == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_db=0x%p, manufacturer_code=0x%x, product_code=0x%x, system=%d, p_fwid=0x%p)\r\n", \
+                     __func__, p_db, manufacturer_code, product_code, system, p_fwid);
+        err = ERR_INVALID_PARAM;
+        goto GET_FWID_FROM_MAPPING_DB_EXIT;
+    }
+
+    err = lookup_fwid_mapping_db(p_db, manufacturer_code, product_code, &p_entry);
+    if (err != ERR_SUCCESS)
+    {
+        DEBUG_PRINTF("%s: Panel %04x.%04x Not Found.\r\n", __func__, manufacturer_code, product_code);
+        goto GET_FWID_FROM_MAPPING_DB_EXIT;
+    }
+
+    fwid = (system == CHROME) ? p_entry->chrome_fwid : p_entry->windows_fwid;
+    DEBUG_PRINTF("%s: [%s] FWID: %04x.\r\n", __func__, (system == CHROME) ? "Chrome" : "Windows", fwid);
+    if (fwid == 0x0) // NULL FWID
+    {
+        DEBUG_PRINTF("%s: NULL FWID.\r\n", __func__);
+        err = ERR_DATA_NOT_FOUND;
+        goto GET_FWID_FROM_MAPPING_DB_EXIT;
+    }
+
+    *p_fwid = fwid;
+    err = ERR_SUCCESS;
+
+GET_FWID_FROM_MAPPING_DB_EXIT:
+    return err;
+}
+
+int show_fwid_mapping_db(struct fwid_mapping_db *p_db)
+{
+    int err = ERR_SUCCESS;
+    unsigned int index = 0;
+
+    // Check if Parameter Invalid
+    if (p_db == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_db=0x%p)\r\n", __func__, p_db);
+        err = ERR_INVALID_PARAM;
+        goto SHOW_FWID_MAPPING_DB_EXIT;
+    }
+
+    printf("--------------------------------------\r\n");
+    printf("LCM Devices:\r\n");
+
+    for (index = 0; index < p_db->entry_count; index++)
+    {
+        printf("Device %d: panel_info \"%04x.%04x\", chrome_fwid %04x, windows_fwid %04x.\r\n", index + 1 /* Line 0 is Header */, \
+               p_db->p_entry[index].manufacturer_code, p_db->p_entry[index].product_code, \
+               p_db->p_entry[index].chrome_fwid, p_db->p_entry[index].windows_fwid);
+    }
+
+SHOW_FWID_MAPPING_DB_EXIT:
+    return err;
+}
@@ -15,13 +15,19 @@
 #include <getopt.h>
 #include "ElanTsDebug.h"
 #include "HIDLinuxGet.h"
+#include "ElanTsHidIo.h"
 #include "ElanTsHidUtility.h"
 #include "ElanTsFuncApi.h"
+#include "ElanTsMemInfo.h"
 #include "ElanTsHidDevUtility.h"
 #include "ElanTsEdidUtility.h"
 #include "ElanTsLcmDevUtility.h"
+#include "ElanTsDaemonUtility.h"
+#include "ElanTsQueryUtility.h"
+#include "ElanTsRetryUtility.h"
 #include "ElanGen8TsHidHwParameters.h"
 #include "ElanGen8TsFuncApi.h"
+#include "ElanGen8TsMemInfo.h"
 
 /*******************************************
  * Definitions
@@ -37,6 +43,28 @@
 #define ELAN_TOOL_SW_RELEASE_DATE	"2024-05-21"
 #endif //ELAN_TOOL_SW_RELEASE_DATE
 
+// Request of Daemon
+#ifndef DAEMON_QUERY_FORMAT
+#define DAEMON_QUERY_FORMAT            "query info=%d validate=%d pid=%d system=%d quiet=%d"
+#endif //DAEMON_QUERY_FORMAT
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// System Info. (HID Device / Panel EDID / LCM Device / Touch)
+struct system_info
+{
+    struct hidraw_devinfo hid_dev_info[DEV_INFO_SET_MAX];
+    bool edid_info_found;
+    unsigned short edid_manufacturer_code;
+    unsigned short edid_product_code;
+    struct fwid_mapping_db fwid_mapping_db;
+    bool touch_info_valid; // Touch Info. Read from Current Device
+    struct touch_session touch_session;
+    unsigned short info_fwid;
+};
+
 /*******************************************
  * Feature Configurations
  ******************************************/
@@ -45,9 +73,6 @@
  * Global Variables Declaration
  ******************************************/
 
-// InterfaceGet Class
-CHIDLinuxGet *g_pIntfGet = NULL; // Pointer to HID Inteface Class (CHIDLinuxGet)
-
 // Validate Touchscreen Device
 bool g_validate_dev = false;
 
@@ -60,6 +85,10 @@ bool g_lookup_fwid = false;
 // FWID Mapping Table
 char g_fwid_mapping_file_path[FILE_NAME_LENGTH_MAX] = {0};
 
+// Compile FWID Mapping Table (Text to Binary)
+bool g_compile_mapping_file = false;
+char g_compiled_mapping_file_path[FILE_NAME_LENGTH_MAX] = {0};
+
 // System Inforamtion
 bool g_show_system_info = false;
 
@@ -69,17 +98,44 @@ system_type g_system_type = UNKNOWN;
 // Silent Mode (Quiet)
 bool g_silent_mode = false;
 
+// Daemon Mode (Serve Queries on Unix Domain Socket)
+bool g_daemon_mode = false;
+
+// Client Mode (Query Daemon)
+bool g_client_mode = false;
+
+// System Info. (Cached by Daemon)
+struct system_info g_system_info;
+
 // Help Info.
 bool g_help = false;
 
+// Query (Multiple Fields in One Device Session)
+bool g_query = false;
+const struct query_field *g_query_field[QUERY_FIELD_COUNT_MAX] = {NULL};
+size_t g_query_field_count = 0;
+query_format_t g_query_format = QUERY_FORMAT_KEY_VALUE;
+
+// Device Lock (Max. Wait for Other Process)
+int g_lock_wait_ms = HID_DEVICE_LOCK_WAIT_MSEC;
+
 // Parameter Option Settings
-const char* const short_options = "p:P:f:s:iqdh";
+const char* const short_options = "p:P:f:o:s:e:DCS:Q:jR:W:iqdh";
 const struct option long_options[] =
 {
     { "pid",                     1, NULL, 'p'},
     { "pid_hex",                 1, NULL, 'P'},
     { "mapping_file_path",       1, NULL, 'f'},
+    { "compile_mapping_file",    1, NULL, 'o'},
     { "system",                  1, NULL, 's'},
+    { "drm_sysfs_root",          1, NULL, 'e'},
+    { "daemon",                  0, NULL, 'D'},
+    { "client",                  0, NULL, 'C'},
+    { "socket_path",             1, NULL, 'S'},
+    { "query",                   1, NULL, 'Q'},
+    { "json",                    0, NULL, 'j'},
+    { "retry",                   1, NULL, 'R'},
+    { "lock_wait",               1, NULL, 'W'},
     { "dev_info",                0, NULL, 'i'},
     { "quiet",                   0, NULL, 'q'},
     { "debug",                   0, NULL, 'd'},
@@ -96,28 +152,49 @@ int show_info_fwid(unsigned short info_fwid);
 // FWID
 int show_fwid(system_type system, unsigned short fwid, bool silent_mode);
 
-// System Info. (HID Device / Panel EDID / LCM Device)
+// Touch Info. (Touch State / Information FWID)
+int read_touch_info(struct touch_session *p_touch_session, unsigned short *p_info_fwid);
+
+// System Info. (HID Device / Panel EDID)
 int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
-                    unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, \
-                    char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
-                    struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size);
+                    unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found);
+
+// LCM Device Info. (FWID Mapping Table)
+int get_lcm_dev_info(char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
+                     struct fwid_mapping_db *p_fwid_mapping_db);
 
 int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
                      bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
-                     bool lookup_fwid, struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size, \
+                     bool lookup_fwid, struct fwid_mapping_db *p_fwid_mapping_db, \
                      unsigned short info_fwid);
 
+// FWID (Mapping Table by Panel EDID, or Information FWID)
+int lookup_fwid(struct system_info *p_system_info, system_type system, unsigned short *p_fwid);
+
+// Query (System Info. / FWID)
+int process_query(struct system_info *p_system_info);
+
+// Query Fields
+int query_hello_packet(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_recovery(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_fw_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_fw_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_test_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_bc_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_info_fwid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_rek_counter(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_remark_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_edid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+int query_fwid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+
+// Daemon
+int daemon_refresh(unsigned int refresh_flags);
+int daemon_request(const char *p_request);
+
 // Help
 void show_help_information(void);
 
-// HID Raw I/O Function
-int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
-int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
-
-// Abstract Device I/O Function
-int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
-int read_data(unsigned char *data_buf, int len, int timeout_ms);
-int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+// Device Function
 int open_device(void);
 int close_device(void);
 
@@ -127,321 +204,685 @@ int resource_init(void);
 int resource_free(void);
 int main(int argc, char **argv);
 
+// Query Field Table
+const struct query_field g_query_field_table[] =
+{
+    { "hello_packet",   query_hello_packet },
+    { "recovery",       query_recovery },
+    { "fw_id",          query_fw_id },
+    { "fw_version",     query_fw_version },
+    { "test_version",   query_test_version },
+    { "bc_version",     query_bc_version },
+    { "info_fwid",      query_info_fwid },
+    { "rek_counter",    query_rek_counter },
+    { "remark_id",      query_remark_id },
+    { "edid",           query_edid },
+    { "fwid",           query_fwid },
+};
+
 /*******************************************
- * HID Raw I/O Functions
+ * Function Implementation
  ******************************************/
 
-int __hidraw_write(unsigned char* buf, int len, int timeout_ms)
+int show_info_fwid(unsigned short info_fwid)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
 
-    if(g_pIntfGet == NULL)
+    printf("--------------------------------------\r\n");
+    printf("Touch Information:\r\n");
+    printf("Information FWID: %04x.\r\n", info_fwid);
+
+    return err;
+}
+
+int show_fwid(system_type system, unsigned short fwid, bool silent_mode)
+{
+    int err = ERR_SUCCESS;
+
+    // Check if Parameter Invalid
+    if(system == UNKNOWN)
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_WRITE_EXIT;
+        ERROR_PRINTF("%s: Unknown System Type (%d)!\r\n", __func__, system);
+        err = ERR_INVALID_PARAM;
+        goto SHOW_FWID_EXIT;
     }
 
-    nRet = g_pIntfGet->WriteRawBytes(buf, len, timeout_ms);
+    if(silent_mode == true)
+    {
+        printf("%04x", fwid);
+    }
+    else //if(silent_mode == false)
+    {
+        printf("--------------------------------------\r\n");
+        printf("System: %s.\r\n", (system == CHROME) ? "Chrome" : "Windows");
+        printf("FWID: %04x.\r\n", fwid);
+    }
 
-__HIDRAW_WRITE_EXIT:
-    return nRet;
+SHOW_FWID_EXIT:
+    return err;
 }
 
-int __hidraw_read(unsigned char* buf, int len, int timeout_ms)
+// System Info. (HID Device / Panel EDID)
+int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
+                    unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
+    bool edid_info_found = false;
 
-    if(g_pIntfGet == NULL)
+    // Validate HID Device Buffer
+    if((p_hid_dev_info == NULL) || (hid_dev_info_size == 0))
+    {
+        ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
+                     __func__, p_hid_dev_info, hid_dev_info_size);
+        err = ERR_INVALID_PARAM;
+        goto GET_SYSTEM_INFO_EXIT;
+    }
+
+    // Validate Panel EDID Info.
+    if((p_edid_manufacturer_code == NULL) || (p_edid_product_code == NULL) || (p_edid_info_found == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Panel EDID Data Buffer! (p_edid_manufacturer_code=0x%p, p_edid_product_code=0x%p, p_edid_info_found=0x%p)\r\n", \
+                     __func__, p_edid_manufacturer_code, p_edid_product_code, p_edid_info_found);
+        err = ERR_INVALID_PARAM;
+        goto GET_SYSTEM_INFO_EXIT;
+    }
+
+    // Get HID Device Info.
+    err = get_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
+    if(err != ERR_SUCCESS)
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_READ_EXIT;
+        ERROR_PRINTF("%s: Fail to Get HID Dev Info.! err=0x%x.\r\n", __func__, err);
+        goto GET_SYSTEM_INFO_EXIT;
+    }
+
+    // Get EDID Manufacturer Code & Product Code
+    err = get_edid_manufacturer_product_code(p_edid_manufacturer_code, p_edid_product_code);
+    if (err != ERR_SUCCESS)
+    {
+        //ERROR_PRINTF("%s: Fail to get EDID manufacturer code & product code ! err=0x%x.\r\n", __func__, err);
+        if(err == ERR_DATA_NOT_FOUND)
+        {
+            /* Set Flag for EDID Info. Not Found */
+
+            // [Note] 2020/10/27
+            // Since EDID information of BOE NV133FHM-N62 V8.1 can not be read by modetest command (used in Acer Karben project),
+            // we add a new flag an flow to avoid process terminated by edid information read fail.
+            edid_info_found = false;
+        }
+        else // Other
+        {
+            edid_info_found = false;
+            goto GET_SYSTEM_INFO_EXIT;
+        }
     }
+    edid_info_found = true;
+    DEBUG_PRINTF("%s: EDID Info. Found? %s.\r\n", __func__, (edid_info_found) ? "true" : "false");
+    *p_edid_info_found = edid_info_found;
 
-    nRet = g_pIntfGet->ReadRawBytes(buf, len, timeout_ms);
+    // Success
+    err = ERR_SUCCESS;
 
-__HIDRAW_READ_EXIT:
-    return nRet;
+GET_SYSTEM_INFO_EXIT:
+    return err;
 }
 
-int __hidraw_write_command(unsigned char* buf, int len, int timeout_ms)
+// LCM Device Info. (FWID Mapping Table)
+int get_lcm_dev_info(char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
+                     struct fwid_mapping_db *p_fwid_mapping_db)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
 
-    if(g_pIntfGet == NULL)
+    // Validate FWID Mapping Table File Path
+    if((p_fwid_mapping_file_path == NULL) || (fwid_mapping_file_path_size == 0))
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_WRITE_EXIT;
+        ERROR_PRINTF("%s: Invalid FWID Mapping Table File Path! (p_fwid_mapping_file_path=0x%p, fwid_mapping_file_path_size=%ld)\r\n", \
+                     __func__, p_fwid_mapping_file_path, fwid_mapping_file_path_size);
+        err = ERR_INVALID_PARAM;
+        goto GET_LCM_DEV_INFO_EXIT;
     }
 
-    nRet = g_pIntfGet->WriteCommand(buf, len, timeout_ms);
+    // Validate FWID Mapping Database
+    if(p_fwid_mapping_db == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid FWID Mapping Database! (p_fwid_mapping_db=0x%p)\r\n", __func__, p_fwid_mapping_db);
+        err = ERR_INVALID_PARAM;
+        goto GET_LCM_DEV_INFO_EXIT;
+    }
+
+    // Get LCM Device Info.
+    if(strcmp(p_fwid_mapping_file_path, "") != 0) // File path has been configured
+    {
+        /* Load FWID Mapping File (Text Table or Precompiled Binary Table) */
+        err = load_fwid_mapping_db(p_fwid_mapping_file_path, p_fwid_mapping_db);
+        if (err == ERR_FILE_NOT_FOUND)
+        {
+            ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"!\r\n", __func__, p_fwid_mapping_file_path);
+            goto GET_LCM_DEV_INFO_EXIT;
+        }
+        else if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to parse FWID mapping file, err=%d.", __func__, err);
+            //goto GET_LCM_DEV_INFO_EXIT;
+        }
+    }
 
-__HIDRAW_WRITE_EXIT:
-    return nRet;
+    // Success
+    err = ERR_SUCCESS;
+
+GET_LCM_DEV_INFO_EXIT:
+    return err;
 }
 
-int __hidraw_read_data(unsigned char* buf, int len, int timeout_ms)
+int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
+                     bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
+                     bool lookup_fwid, struct fwid_mapping_db *p_fwid_mapping_db, \
+                     unsigned short info_fwid)
 {
-    int nRet = ERR_SUCCESS;
+    int err = ERR_SUCCESS;
 
-    if(g_pIntfGet == NULL)
+    // Validate HID Device Buffer
+    if((p_hid_dev_info == NULL) || (hid_dev_info_size == 0))
     {
-        nRet = ERR_NO_INTERFACE_CREATED;
-        goto __HIDRAW_READ_EXIT;
+        ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
+                     __func__, p_hid_dev_info, hid_dev_info_size);
+        err = ERR_INVALID_PARAM;
+        goto SHOW_SYSTEM_INFO_EXIT;
     }
 
-    nRet = g_pIntfGet->ReadData(buf, len, timeout_ms);
+    // Validate FWID Mapping Database
+    if(p_fwid_mapping_db == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid FWID Mapping Database! (p_fwid_mapping_db=0x%p)\r\n", __func__, p_fwid_mapping_db);
+        err = ERR_INVALID_PARAM;
+        goto SHOW_SYSTEM_INFO_EXIT;
+    }
 
-__HIDRAW_READ_EXIT:
-    return nRet;
-}
+    // Show HID Device Info.
+    err = show_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to show elan HID Device! err=0x%x.\r\n", __func__, err);
+        goto SHOW_SYSTEM_INFO_EXIT;
+    }
 
-/***************************************************
- * Abstract I/O Functions
- ***************************************************/
+    // SHow EDID Info.
+    if(edid_info_found == true) // EDID Info. Found
+    {
+        show_edid_manufacturer_product_code(edid_manufacturer_code, edid_product_code);
+    }
+    else // EDID Info. Not Found
+    {
+        ERROR_PRINTF("%s: EDID Info. Not Found!\r\n", __func__);
+    }
 
-int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
-{
-    //write_bytes_from_buffer_to_i2c(cmd_buf); //pseudo function
+    // Show LCM Device Info.
+    if(lookup_fwid == true) // Lookup FWID has been Requested
+    {
+        err = show_fwid_mapping_db(p_fwid_mapping_db);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to show LCM Device Information! err=0x%x.\r\n", __func__, err);
+            goto SHOW_SYSTEM_INFO_EXIT;
+        }
+    }
 
-    /*** example *********************/
-    return __hidraw_write_command(cmd_buf, len, timeout_ms);
-    /*********************************/
-}
+    // Show Information FWID
+    show_info_fwid(info_fwid);
 
-int read_data(unsigned char *data_buf, int len, int timeout_ms)
-{
-    //read_bytes_from_i2c_to_buffer(data_buf, len, timeout); //pseudo function
+    // Success
+    err = ERR_SUCCESS;
 
-    /*** example *********************/
-    return __hidraw_read_data(data_buf, len, timeout_ms);
-    /*********************************/
+SHOW_SYSTEM_INFO_EXIT:
+    return err;
 }
 
-int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+// Touch Info. (Touch State / Information FWID)
+int read_touch_info(struct touch_session *p_touch_session, unsigned short *p_info_fwid)
 {
-    unsigned char vendor_cmd_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+    int err = ERR_SUCCESS;
+    struct touch_session session;
 
-    // Add HID Header
-    vendor_cmd_buf[0] = ELAN_HID_OUTPUT_REPORT_ID;
-    memcpy(&vendor_cmd_buf[1], cmd_buf, len);
+    // Validate Input Parameter
+    if((p_touch_session == NULL) || (p_info_fwid == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_touch_session=0x%p, p_info_fwid=0x%p)\r\n", __func__, p_touch_session, p_info_fwid);
+        err = ERR_INVALID_PARAM;
+        goto READ_TOUCH_INFO_EXIT;
+    }
 
-    return __hidraw_write(vendor_cmd_buf, sizeof(vendor_cmd_buf), timeout_ms);
-}
+    /* Detect Touch State */
+    memset(&session, 0, sizeof(session));
+    err = detect_touch_state(&session);
+    if(err != ERR_SUCCESS)
+        goto READ_TOUCH_INFO_EXIT;
 
-/*******************************************
- * Function Implementation
- ******************************************/
+    /* Read Information FWID */
+    if(session.gen8_touch) // Gen8 Touch
+        err = gen8_read_info_fwid(p_info_fwid, session.recovery);
+    else // Gen5/6/7 Touch
+        err = read_info_fwid(p_info_fwid, session.recovery);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Read Information FWID! err=0x%x.\r\n", err);
+        goto READ_TOUCH_INFO_EXIT;
+    }
 
-int show_info_fwid(unsigned short info_fwid)
-{
-    int err = ERR_SUCCESS;
+    *p_touch_session = session;
 
-    printf("--------------------------------------\r\n");
-    printf("Touch Information:\r\n");
-    printf("Information FWID: %04x.\r\n", info_fwid);
+    // Success
+    err = ERR_SUCCESS;
 
+READ_TOUCH_INFO_EXIT:
     return err;
 }
 
-int show_fwid(system_type system, unsigned short fwid, bool silent_mode)
+// FWID (Mapping Table by Panel EDID, or Information FWID)
+int lookup_fwid(struct system_info *p_system_info, system_type system, unsigned short *p_fwid)
 {
     int err = ERR_SUCCESS;
+    unsigned short fwid = 0,
+                   fwid_from_edid = 0;
 
-    // Check if Parameter Invalid
-    if(system == UNKNOWN)
+    // Validate Input Parameter
+    if((p_system_info == NULL) || (p_fwid == NULL))
     {
-        ERROR_PRINTF("%s: Unknown System Type (%d)!\r\n", __func__, system);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_system_info=0x%p, p_fwid=0x%p)\r\n", __func__, p_system_info, p_fwid);
         err = ERR_INVALID_PARAM;
-        goto SHOW_FWID_EXIT;
+        goto LOOKUP_FWID_EXIT;
     }
 
-    if(silent_mode == true)
+    if(p_system_info->edid_info_found == true) // EDID Info. Found
     {
-        printf("%04x", fwid);
+        /* Get FWID from EDID */
+        err = get_fwid_from_mapping_db(&p_system_info->fwid_mapping_db, p_system_info->edid_manufacturer_code, p_system_info->edid_product_code, system, &fwid_from_edid);
+        if (err == ERR_SUCCESS) // FWID from EDID Found
+        {
+            DEBUG_PRINTF("fwid_from_edid Found: 0x%x.\r\n", fwid_from_edid);
+            fwid = fwid_from_edid;
+        }
+        else // FWID from EDID Not Found
+        {
+            if (err == ERR_DATA_NOT_FOUND) // Can not find FWID from Mapping Table
+            {
+                // Use Information FWID Instead
+                DEBUG_PRINTF("fwid_from_edid Not Found, use info_fwid (%x) instead.\r\n", p_system_info->info_fwid);
+                fwid = p_system_info->info_fwid;
+            }
+            else // if ((err != ERR_SUCCESS) && (err != ERR_DATA_NOT_FOUND))
+            {
+                ERROR_PRINTF("%s: Fail to get %s FWID! err=0x%x.\r\n", __func__, (system == CHROME) ? "chrome" : "windows", err);
+                goto LOOKUP_FWID_EXIT;
+            }
+        }
     }
-    else //if(silent_mode == false)
+    else // EDID Info. Not Found
     {
-        printf("--------------------------------------\r\n");
-        printf("System: %s.\r\n", (system == CHROME) ? "Chrome" : "Windows");
-        printf("FWID: %04x.\r\n", fwid);
+        // Use Information FWID Instead
+        DEBUG_PRINTF("EDID read failed, use info_fwid (%x) instead.\r\n", p_system_info->info_fwid);
+        fwid = p_system_info->info_fwid;
     }
 
-SHOW_FWID_EXIT:
+    *p_fwid = fwid;
+    err = ERR_SUCCESS;
+
+LOOKUP_FWID_EXIT:
     return err;
 }
 
-// System Info. (HID Device / Panel EDID / LCM Device)
-int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
-                    unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found, \
-                    char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
-                    struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size)
+// Query (System Info. / FWID)
+int process_query(struct system_info *p_system_info)
 {
     int err = ERR_SUCCESS;
-    bool edid_info_found = false;
-    FILE *p_fd_fwid_mapping_file = NULL;
+    unsigned short fwid = 0;
 
-    // Validate HID Device Buffer
-    if((p_hid_dev_info == NULL) || (hid_dev_info_size == 0))
+    // Validate Input Parameter
+    if(p_system_info == NULL)
     {
-        ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
-                     __func__, p_hid_dev_info, hid_dev_info_size);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_system_info=0x%p)\r\n", __func__, p_system_info);
         err = ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        goto PROCESS_QUERY_EXIT;
     }
 
-    // Validate Panel EDID Info.
-    if((p_edid_manufacturer_code == NULL) || (p_edid_product_code == NULL) || (p_edid_info_found == NULL))
+    // Check if Recovery Mode
+    if(p_system_info->touch_session.recovery == true)
     {
-        ERROR_PRINTF("%s: Invalid Panel EDID Data Buffer! (p_edid_manufacturer_code=0x%p, p_edid_product_code=0x%p, p_edid_info_found=0x%p)\r\n", \
-                     __func__, p_edid_manufacturer_code, p_edid_product_code, p_edid_info_found);
-        err = ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        if(g_silent_mode == false) // Not in Silent Mode
+            printf("In Recovery Mode.\r\n");
     }
 
-    // Validate FWID Mapping Table File Path
-    if((p_fwid_mapping_file_path == NULL) || (fwid_mapping_file_path_size == 0))
+    /* Show System Information */
+    if(g_show_system_info == true)
     {
-        ERROR_PRINTF("%s: Invalid FWID Mapping Table File Path! (p_fwid_mapping_file_path=0x%p, fwid_mapping_file_path_size=%ld)\r\n", \
-                     __func__, p_fwid_mapping_file_path, fwid_mapping_file_path_size);
-        err = ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        err = show_system_info(p_system_info->hid_dev_info, sizeof(p_system_info->hid_dev_info), \
+                               p_system_info->edid_info_found, p_system_info->edid_manufacturer_code, p_system_info->edid_product_code, \
+                               g_lookup_fwid, &p_system_info->fwid_mapping_db, \
+                               p_system_info->info_fwid);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Show System Info.! err=0x%x.\r\n", __func__, err);
+            goto PROCESS_QUERY_EXIT;
+        }
     }
 
-    // Validate LCM Device Buffer
-    if((p_lcm_dev_info == NULL) || (lcm_dev_info_size == 0))
-    {
-        ERROR_PRINTF("%s: Invalid LCM Device Buffer! (p_lcm_dev_info=0x%p, lcm_dev_info_size=%ld)\r\n", \
-                     __func__, p_lcm_dev_info, lcm_dev_info_size);
-        err = ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
-    }
+    /* Validate Elan Touchsceen Device */
+    if(g_validate_dev == true)
+    {
+        err = validate_elan_hid_device(p_system_info->hid_dev_info, sizeof(p_system_info->hid_dev_info), g_pid, g_silent_mode);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to validate elan HID Device (PID: %04x)! err=0x%x.\r\n", __func__, g_pid, err);
+            goto PROCESS_QUERY_EXIT;
+        }
+    }
+
+    if(g_lookup_fwid == true) // Lookup FWID has been Requested
+    {
+        /* Get FWID from EDID (or Information FWID) */
+        err = lookup_fwid(p_system_info, g_system_type, &fwid);
+        if (err != ERR_SUCCESS)
+        {
+            goto PROCESS_QUERY_EXIT;
+        }
+
+        /* Show FWID */
+        err = show_fwid(g_system_type, fwid, g_silent_mode);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to show %s FWID! err=0x%x.\r\n", __func__, (g_system_type == CHROME) ? "chrome" : "windows", err);
+            goto PROCESS_QUERY_EXIT;
+        }
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+PROCESS_QUERY_EXIT:
+    return err;
+}
+
+/*******************************************
+ * Query Fields
+ ******************************************/
+
+int query_hello_packet(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    snprintf(p_value_buf, value_buf_size, "%02x", p_session->hello_packet);
+    return ERR_SUCCESS;
+}
+
+int query_recovery(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    snprintf(p_value_buf, value_buf_size, "%s", (p_session->recovery) ? "true" : "false");
+    return ERR_SUCCESS;
+}
+
+int query_fw_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short fw_id = 0;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = get_firmware_id(&fw_id);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", fw_id);
+
+    return err;
+}
+
+int query_fw_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short fw_version = 0;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = get_fw_version(&fw_version);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", fw_version);
+
+    return err;
+}
+
+int query_test_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short test_version = 0;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    if(p_session->gen8_touch) // Gen8 Touch
+        err = gen8_get_test_version(&test_version);
+    else // Gen5/6/7 Touch
+        err = get_test_version(&test_version);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", test_version);
+
+    return err;
+}
+
+int query_bc_version(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short bc_version = 0;
+
+    if(p_session->recovery) // Already Reported with Hello Packet
+        bc_version = p_session->bc_bc_version;
+    else // Normal Mode
+        err = get_boot_code_version(&bc_version);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", bc_version);
+
+    return err;
+}
+
+int query_info_fwid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    // Already Read with Touch Info.
+    (void)p_session;
+    snprintf(p_value_buf, value_buf_size, "%04x", g_system_info.info_fwid);
+    return ERR_SUCCESS;
+}
+
+int query_rek_counter(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short rek_counter = 0;
+
+    // Main Code Command
+    if(p_session->recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    // Gen8 touch does not support calibration counter, reported as 0 (Same as gen8_get_calibration_counter()).
+    if(p_session->gen8_touch == false)
+        err = get_rek_counter(&rek_counter);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", rek_counter);
+
+    return err;
+}
+
+int query_remark_id(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS,
+        index = 0;
+    unsigned short remark_id = 0;
+    unsigned char gen8_remark_id[ELAN_GEN8_REMARK_ID_LEN] = {0};
+
+    if(p_session->gen8_touch) // Gen8 Touch
+    {
+        err = gen8_read_remark_id(gen8_remark_id, sizeof(gen8_remark_id), p_session->recovery);
+        if(err != ERR_SUCCESS)
+            goto QUERY_REMARK_ID_EXIT;
+
+        for(index = 0; index < ELAN_GEN8_REMARK_ID_LEN; index++)
+            snprintf(&p_value_buf[index * 2], value_buf_size - (index * 2), "%02x", gen8_remark_id[index]);
+    }
+    else // Gen5/6/7 Touch
+    {
+        err = get_rom_data(ELAN_INFO_ROM_REMARK_ID_MEMORY_ADDR, p_session->recovery, &remark_id);
+        if(err != ERR_SUCCESS)
+            goto QUERY_REMARK_ID_EXIT;
+
+        snprintf(p_value_buf, value_buf_size, "%04x", remark_id);
+    }
+
+QUERY_REMARK_ID_EXIT:
+    return err;
+}
+
+int query_edid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    (void)p_session;
+
+    // Panel EDID not Found
+    if(g_system_info.edid_info_found == false)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    snprintf(p_value_buf, value_buf_size, "%04x.%04x", g_system_info.edid_manufacturer_code, g_system_info.edid_product_code);
+    return ERR_SUCCESS;
+}
+
+int query_fwid(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned short fwid = 0;
+
+    (void)p_session;
+
+    // Lookup FWID not Requested
+    if(g_lookup_fwid == false)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = lookup_fwid(&g_system_info, g_system_type, &fwid);
+    if(err == ERR_SUCCESS)
+        snprintf(p_value_buf, value_buf_size, "%04x", fwid);
 
-    // Get HID Device Info.
-    err = get_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
-    if(err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("%s: Fail to Get HID Dev Info.! err=0x%x.\r\n", __func__, err);
-        goto GET_SYSTEM_INFO_EXIT;
-    }
+    return err;
+}
 
-    // Get EDID Manufacturer Code & Product Code
-    err = get_edid_manufacturer_product_code(p_edid_manufacturer_code, p_edid_product_code);
-    if (err != ERR_SUCCESS)
-    {
-        //ERROR_PRINTF("%s: Fail to get EDID manufacturer code & product code ! err=0x%x.\r\n", __func__, err);
-        if(err == ERR_DATA_NOT_FOUND)
-        {
-            /* Set Flag for EDID Info. Not Found */
+/*******************************************
+ * Daemon
+ ******************************************/
 
-            // [Note] 2020/10/27
-            // Since EDID information of BOE NV133FHM-N62 V8.1 can not be read by modetest command (used in Acer Karben project),
-            // we add a new flag an flow to avoid process terminated by edid information read fail.
-            edid_info_found = false;
-        }
-        else // Other
-        {
-            edid_info_found = false;
-            goto GET_SYSTEM_INFO_EXIT;
-        }
-    }
-    edid_info_found = true;
-    DEBUG_PRINTF("%s: EDID Info. Found? %s.\r\n", __func__, (edid_info_found) ? "true" : "false");
-    *p_edid_info_found = edid_info_found;
+// Refresh Cached System Info. (Called on hidraw / Mapping File Change)
+int daemon_refresh(unsigned int refresh_flags)
+{
+    int err = ERR_SUCCESS;
 
-    // Get LCM Device Info.
-    if(strcmp(g_fwid_mapping_file_path, "") != 0) // File path has been configured
+    // HID Device & Panel EDID
+    if(refresh_flags & DAEMON_REFRESH_HID_DEVICE)
     {
-        // Open FWID Mapping File
-        p_fd_fwid_mapping_file = fopen(p_fwid_mapping_file_path, "r");
-        DEBUG_PRINTF("%s: p_fd_fwid_mapping_file=0x%p.\r\n", __func__, p_fd_fwid_mapping_file);
-        if (p_fd_fwid_mapping_file == NULL)
+        memset(g_system_info.hid_dev_info, 0, sizeof(g_system_info.hid_dev_info));
+        err = get_system_info(g_system_info.hid_dev_info, sizeof(g_system_info.hid_dev_info), \
+                              &g_system_info.edid_manufacturer_code, &g_system_info.edid_product_code, &g_system_info.edid_info_found);
+        if (err != ERR_SUCCESS)
         {
-            ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"!\r\n", __func__, g_fwid_mapping_file_path);
-            err = ERR_FILE_NOT_FOUND;
-            goto GET_SYSTEM_INFO_EXIT;
+            ERROR_PRINTF("%s: Fail to Get System Info.! err=0x%x.\r\n", __func__, err);
+            goto DAEMON_REFRESH_EXIT;
         }
 
-        /* Parse FWID Mapping File */
-        err = parse_fwid_mapping_file(p_fd_fwid_mapping_file, p_lcm_dev_info, lcm_dev_info_size);
+        // Touch may have been re-enumerated (e.g. after FW update): Read Touch Info. again at next query
+        g_system_info.touch_info_valid = false;
+    }
+
+    // FWID Mapping Table
+    if(refresh_flags & DAEMON_REFRESH_MAPPING_FILE)
+    {
+        free_fwid_mapping_db(&g_system_info.fwid_mapping_db);
+        err = get_lcm_dev_info(g_fwid_mapping_file_path, sizeof(g_fwid_mapping_file_path), &g_system_info.fwid_mapping_db);
         if (err != ERR_SUCCESS)
         {
-            ERROR_PRINTF("%s: Fail to parse FWID mapping file, err=%d.", __func__, err);
-            //goto GET_SYSTEM_INFO_EXIT;
+            ERROR_PRINTF("%s: Fail to Get LCM Device Info.! err=0x%x.\r\n", __func__, err);
+            goto DAEMON_REFRESH_EXIT;
         }
-
-        // Close FWID Mapping File
-        fclose(p_fd_fwid_mapping_file);
-        p_fd_fwid_mapping_file = NULL;
     }
 
     // Success
     err = ERR_SUCCESS;
 
-GET_SYSTEM_INFO_EXIT:
+DAEMON_REFRESH_EXIT:
     return err;
 }
 
-int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
-                     bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
-                     bool lookup_fwid, struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size, \
-                     unsigned short info_fwid)
+// Answer Query from Client (Output Redirected to Client)
+int daemon_request(const char *p_request)
 {
-    int err = ERR_SUCCESS;
-
-    // Validate HID Device Buffer
-    if((p_hid_dev_info == NULL) || (hid_dev_info_size == 0))
+    int err = ERR_SUCCESS,
+        show_system_info = 0,
+        validate_dev = 0,
+        pid = 0,
+        system = 0,
+        silent_mode = 0;
+    bool mapping_file_loaded = g_lookup_fwid;
+
+    // Save Settings of Daemon
+    bool daemon_show_system_info = g_show_system_info,
+         daemon_validate_dev = g_validate_dev,
+         daemon_silent_mode = g_silent_mode;
+    int daemon_pid = g_pid;
+    system_type daemon_system_type = g_system_type;
+
+    // Parse Query
+    if((p_request == NULL) || \
+       (sscanf(p_request, DAEMON_QUERY_FORMAT, &show_system_info, &validate_dev, &pid, &system, &silent_mode) != 5) || \
+       (system < UNKNOWN) || (system > WINDOWS))
     {
-        ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
-                     __func__, p_hid_dev_info, hid_dev_info_size);
+        ERROR_PRINTF("%s: Invalid Request \"%s\"!\r\n", __func__, (p_request == NULL) ? "" : p_request);
         err = ERR_INVALID_PARAM;
-        goto SHOW_SYSTEM_INFO_EXIT;
+        goto DAEMON_REQUEST_EXIT;
     }
 
-    // Validate LCM Device Buffer
-    if((p_lcm_dev_info == NULL) || (lcm_dev_info_size == 0))
+    // Make sure mapping file loaded if FWID lookup requested
+    if((system != UNKNOWN) && (mapping_file_loaded == false))
     {
-        ERROR_PRINTF("%s: Invalid LCM Device Buffer! (p_lcm_dev_info=0x%p, lcm_dev_info_size=%ld)\r\n", \
-                     __func__, p_lcm_dev_info, lcm_dev_info_size);
+        ERROR_PRINTF("%s: Please Input FW Mapping File!\r\n", __func__);
         err = ERR_INVALID_PARAM;
-        goto SHOW_SYSTEM_INFO_EXIT;
-    }
-
-    // Show HID Device Info.
-    err = show_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
-    if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("%s: Fail to show elan HID Device! err=0x%x.\r\n", __func__, err);
-        goto SHOW_SYSTEM_INFO_EXIT;
-    }
-
-    // SHow EDID Info.
-    if(edid_info_found == true) // EDID Info. Found
-    {
-        show_edid_manufacturer_product_code(edid_manufacturer_code, edid_product_code);
-    }
-    else // EDID Info. Not Found
-    {
-        ERROR_PRINTF("%s: EDID Info. Not Found!\r\n", __func__);
+        goto DAEMON_REQUEST_EXIT;
     }
 
-    // Show LCM Device Info.
-    if(lookup_fwid == true) // Lookup FWID has been Requested
+    // Read Touch Info. from Device (Only First Query after Device Changed)
+    if(g_system_info.touch_info_valid == false)
     {
-        err = show_lcm_dev_info(p_lcm_dev_info, lcm_dev_info_size);
+        err = open_device();
         if (err != ERR_SUCCESS)
         {
-            ERROR_PRINTF("%s: Fail to show LCM Device Information! err=0x%x.\r\n", __func__, err);
-            goto SHOW_SYSTEM_INFO_EXIT;
+            ERROR_PRINTF("%s: Fail to Open Device! err=0x%x.\r\n", __func__, err);
+            goto DAEMON_REQUEST_EXIT;
         }
-    }
 
-    // Show Information FWID
-    show_info_fwid(info_fwid);
+        err = read_touch_info(&g_system_info.touch_session, &g_system_info.info_fwid);
+        close_device();
+        if (err != ERR_SUCCESS)
+            goto DAEMON_REQUEST_EXIT;
+        g_system_info.touch_info_valid = true;
+    }
 
-    // Success
-    err = ERR_SUCCESS;
+    // Apply Settings of Query
+    g_show_system_info = (show_system_info != 0);
+    g_validate_dev = (validate_dev != 0);
+    g_pid = pid;
+    g_lookup_fwid = (system != UNKNOWN);
+    g_system_type = (system_type)system;
+    g_silent_mode = (silent_mode != 0);
+
+    err = process_query(&g_system_info);
+
+DAEMON_REQUEST_EXIT:
+    // Restore Settings of Daemon
+    g_show_system_info = daemon_show_system_info;
+    g_validate_dev = daemon_validate_dev;
+    g_pid = daemon_pid;
+    g_lookup_fwid = mapping_file_loaded;
+    g_system_type = daemon_system_type;
+    g_silent_mode = daemon_silent_mode;
 
-SHOW_SYSTEM_INFO_EXIT:
     return err;
 }
 
@@ -466,6 +907,12 @@ void show_help_information(void)
     printf("-f <fwid_mapping_table_file_path>.\r\n");
     printf("Ex: hid_read_fwid -f fwid_mapping_table.txt\r\n");
     printf("Ex: hid_read_fwid -f /tmp/fwid_mapping_table.txt\r\n");
+    printf("Ex: hid_read_fwid -f /tmp/fwid_mapping_table.bin\r\n");
+
+    // Compile FWID Mapping Table
+    printf("\n[Compile FWID Mapping Table]\r\n");
+    printf("-o <binary_fwid_mapping_table_file_path>.\r\n");
+    printf("Ex: hid_read_fwid -f fwid_mapping_table.txt -o fwid_mapping_table.bin\r\n");
 
     // System/Platform
     printf("\n[System Platform]\r\n");
@@ -473,6 +920,45 @@ void show_help_information(void)
     printf("Ex: hid_read_fwid -s chrome\r\n");
     printf("Ex: hid_read_fwid -s windows\r\n");
 
+    // DRM sysfs Root (EDID Source)
+    printf("\n[DRM sysfs Root]\r\n");
+    printf("-e <drm_sysfs_root_path>.\r\n");
+    printf("Ex: hid_read_fwid -e /sys/class/drm\r\n");
+
+    // Daemon Mode
+    printf("\n[Daemon Mode]\r\n");
+    printf("-D.\r\n");
+    printf("Ex: hid_read_fwid -P 2a03 -f fwid_mapping_table.txt -D\r\n");
+
+    // Client Mode
+    printf("\n[Client Mode]\r\n");
+    printf("-C.\r\n");
+    printf("Ex: hid_read_fwid -C -s chrome -q\r\n");
+    printf("Ex: hid_read_fwid -C -i\r\n");
+
+    // Socket Path of Daemon
+    printf("\n[Daemon Socket Path]\r\n");
+    printf("-S <socket_path>.\r\n");
+    printf("Ex: hid_read_fwid -S /tmp/hid_read_fwid.sock -C -s chrome\r\n");
+
+    // Query
+    printf("\n[Query]\r\n");
+    printf("-Q <field>[,<field>...].\r\n");
+    show_query_field_names(g_query_field_table, sizeof(g_query_field_table) / sizeof(g_query_field_table[0]));
+    printf("Ex: hid_read_fwid -Q fw_id,fw_version,info_fwid\r\n");
+    printf("Ex: hid_read_fwid -f fwid_mapping_table.txt -s chrome -Q all -j\r\n");
+
+    // Retry Policy
+    printf("\n[Retry Policy]\r\n");
+    printf("-R <key>=<value>[,<key>=<value>...].\r\n");
+    show_retry_policy_format();
+    printf("Ex: hid_read_fwid -R count=5,delay=5,deadline=200 -Q fw_id\r\n");
+
+    // Device Lock
+    printf("\n[Device Lock]\r\n");
+    printf("-W <wait_ms>. (Max. Wait if Device is Used by Other hid_iap / hid_read_fwid, Default: %d ms, 0: No Wait)\r\n", HID_DEVICE_LOCK_WAIT_MSEC);
+    printf("Ex: hid_read_fwid -W 0 -Q fw_id\r\n");
+
     // Device Information
     printf("\n[Device Information]\r\n");
     printf("-i.\r\n");
@@ -513,12 +999,26 @@ int open_device(void)
         goto OPEN_DEVICE_EXIT;
     }
 
+    // Information Page Read & Pipelining State before Belong to Previous Device Session
+    invalidate_info_page_cache();
+    gen8_invalidate_info_page_cache();
+    reset_command_pipeline();
+
     // Connect to Device
     DEBUG_PRINTF("Get HID Device Handle (VID=0x%x, PID=0x%x).\r\n", ELAN_HID_VID, g_pid);
     err = g_pIntfGet->GetDeviceHandle(ELAN_HID_VID, g_pid);
     if (err != ERR_SUCCESS)
     {
         ERROR_PRINTF("Device can't connected! err=0x%x.\n", err);
+        goto OPEN_DEVICE_EXIT;
+    }
+
+    // Lock Device against Other Tool Processes (e.g. hid_iap Updating Firmware)
+    err = g_pIntfGet->LockDevice(HID_DEVICE_LOCK_EXCLUSIVE, g_lock_wait_ms);
+    if (err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("Device is busy! err=0x%x.\n", err);
+        g_pIntfGet->Close();
     }
 
 OPEN_DEVICE_EXIT:
@@ -540,8 +1040,12 @@ int close_device(void)
         goto CLOSE_DEVICE_EXIT;
     }
 
-    // Release acquired touch device handler
+    // Release acquired touch device handler & device lock
     g_pIntfGet->Close();
+    g_pIntfGet->UnlockDevice();
+    invalidate_info_page_cache();
+    gen8_invalidate_info_page_cache();
+    reset_command_pipeline();
 
 CLOSE_DEVICE_EXIT:
     /*********************************/
@@ -612,7 +1116,8 @@ int process_parameter(int argc, char **argv)
         pid = 0,
         pid_str_len = 0,
         file_path_len = 0,
-        system_str_len = 0;
+        system_str_len = 0,
+        lock_wait_ms = 0;
     char file_path[FILE_NAME_LENGTH_MAX] = {0},
          system[SYSTEM_NAME_LENGTH] = {0};
 
@@ -698,6 +1203,23 @@ int process_parameter(int argc, char **argv)
                 DEBUG_PRINTF("%s: FWID Lookup: %s, Mapping File: \"%s\".\r\n", __func__, (g_lookup_fwid) ? "Enable" : "Disable", g_fwid_mapping_file_path);
                 break;
 
+            case 'o': /* Compile FWID Mapping Table */
+
+                // Make Sure Path Valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || ((size_t)file_path_len >= sizeof(g_compiled_mapping_file_path)))
+                {
+                    ERROR_PRINTF("%s: Invalid String Length for File Path: %d!\n", __func__, file_path_len);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Global File Path
+                g_compile_mapping_file = true;
+                strcpy(g_compiled_mapping_file_path, optarg);
+                DEBUG_PRINTF("%s: Compile FWID Mapping File to \"%s\".\r\n", __func__, g_compiled_mapping_file_path);
+                break;
+
             case 's': /* System Type */
 
                 // Make Sure Format Valid
@@ -730,6 +1252,91 @@ int process_parameter(int argc, char **argv)
                 }
                 break;
 
+            case 'e': /* DRM sysfs Root */
+
+                // Set Root of DRM Connectors to Read EDID from
+                err = set_drm_sysfs_root(optarg);
+                if (err != ERR_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid DRM sysfs Root (%s)!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+                break;
+
+            case 'D': /* Daemon Mode */
+
+                // Serve Queries on Unix Domain Socket
+                g_daemon_mode = true;
+                DEBUG_PRINTF("%s: Daemon Mode: %s.\r\n", __func__, (g_daemon_mode) ? "Enable" : "Disable");
+                break;
+
+            case 'C': /* Client Mode */
+
+                // Query Daemon instead of Device
+                g_client_mode = true;
+                DEBUG_PRINTF("%s: Client Mode: %s.\r\n", __func__, (g_client_mode) ? "Enable" : "Disable");
+                break;
+
+            case 'S': /* Socket Path of Daemon */
+
+                err = set_daemon_socket_path(optarg);
+                if (err != ERR_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid Socket Path (%s)!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+                break;
+
+            case 'Q': /* Query */
+
+                // Parse Field List
+                err = parse_query_field_list(optarg, g_query_field_table, sizeof(g_query_field_table) / sizeof(g_query_field_table[0]), \
+                                             g_query_field, QUERY_FIELD_COUNT_MAX, &g_query_field_count);
+                if (err != ERR_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid Query Field List \"%s\"!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Query Flag
+                g_query = true;
+                DEBUG_PRINTF("%s: Query: %ld field(s).\r\n", __func__, g_query_field_count);
+                break;
+
+            case 'j': /* JSON Output of Query */
+
+                // Set Query Format
+                g_query_format = QUERY_FORMAT_JSON;
+                DEBUG_PRINTF("%s: Query Format: JSON.\r\n", __func__);
+                break;
+
+            case 'R': /* Retry Policy */
+
+                // Parse Retry Policy
+                err = parse_retry_policy(optarg);
+                if (err != ERR_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid Retry Policy \"%s\"!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+                break;
+
+            case 'W': /* Device Lock Wait */
+
+                // Make Sure Data Valid
+                lock_wait_ms = atoi(optarg);
+                if (lock_wait_ms < 0)
+                {
+                    ERROR_PRINTF("%s: Invalid Lock Wait: %d!\n", __func__, lock_wait_ms);
+                    err = ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Device Lock Wait
+                g_lock_wait_ms = lock_wait_ms;
+                DEBUG_PRINTF("%s: Lock Wait: %d ms.\r\n", __func__, g_lock_wait_ms);
+                break;
+
             case 'i': /* Sytem Information */
 
                 // Show System Information
@@ -764,6 +1371,49 @@ int process_parameter(int argc, char **argv)
         }
     }
 
+    // Compile mode only needs the source mapping file
+    if(g_compile_mapping_file == true)
+    {
+        if(g_lookup_fwid == false)
+        {
+            ERROR_PRINTF("%s: Please Input FW Mapping File!\r\n", __func__);
+            err = ERR_INVALID_PARAM;
+            goto PROCESS_PARAM_EXIT;
+        }
+        return ERR_SUCCESS;
+    }
+
+    // Daemon & Client are exclusive
+    if((g_daemon_mode == true) && (g_client_mode == true))
+    {
+        ERROR_PRINTF("%s: Daemon Mode and Client Mode can not be Set at the Same Time!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // Query reads current device directly, so it can not be mixed with daemon or client
+    if((g_query == true) && ((g_daemon_mode == true) || (g_client_mode == true)))
+    {
+        ERROR_PRINTF("%s: Query can not be Set with Daemon Mode or Client Mode!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // Output of Query is a Single Record
+    if(g_query == true)
+        g_silent_mode = true;
+
+    // Daemon: System type is set by each query
+    if(g_daemon_mode == true)
+        return ERR_SUCCESS;
+
+    // Client: Mapping file is loaded by daemon, so FWID lookup is requested by system type only
+    if(g_client_mode == true)
+    {
+        g_lookup_fwid = (g_system_type != UNKNOWN);
+        return ERR_SUCCESS;
+    }
+
     // Make sure mapping file and system type set at the same time
     if((g_lookup_fwid == true) && (g_system_type == UNKNOWN))
     {
@@ -791,24 +1441,12 @@ PROCESS_PARAM_EXIT:
 
 int main(int argc, char **argv)
 {
-    int err = ERR_SUCCESS;
-    bool recovery = false,       // True if Recovery Mode
-         gen8_touch = false,     // True if Gen8 Touch
-         edid_info_found = true;
-    unsigned char hello_packet = 0;
-    unsigned short fw_bc_version = 0,
-                   bc_bc_version = 0,
-                   fwid = 0,
-                   info_fwid = 0, // Information FWID: FWID from Information ROM
-                   fwid_from_edid = 0,
-                   edid_manufacturer_code = 0,
-                   edid_product_code = 0;
-    struct hidraw_devinfo hid_dev_info[DEV_INFO_SET_MAX];
-    struct lcm_dev_info   lcm_panel_info[DEV_INFO_SET_MAX];
+    int err = ERR_SUCCESS,
+        result = ERR_SUCCESS;
+    char request[DAEMON_REQUEST_LENGTH_MAX] = {0};
 
     // Initialize Data Variables
-    memset(hid_dev_info, 0, sizeof(hid_dev_info));
-    memset(lcm_panel_info, 0, sizeof(lcm_panel_info));
+    memset(&g_system_info, 0, sizeof(g_system_info));
 
     /* Process Parameter */
     err = process_parameter(argc, argv);
@@ -827,6 +1465,39 @@ int main(int argc, char **argv)
         goto EXIT;
     }
 
+    /* Compile FWID Mapping Table (No Device Access) */
+    if(g_compile_mapping_file == true)
+    {
+        err = load_fwid_mapping_db(g_fwid_mapping_file_path, &g_system_info.fwid_mapping_db);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Load FWID Mapping File \"%s\"! err=0x%x.\r\n", g_fwid_mapping_file_path, err);
+            goto EXIT;
+        }
+
+        err = save_fwid_mapping_db(g_compiled_mapping_file_path, &g_system_info.fwid_mapping_db);
+        if (err != ERR_SUCCESS)
+            ERROR_PRINTF("Fail to Save FWID Mapping File \"%s\"! err=0x%x.\r\n", g_compiled_mapping_file_path, err);
+        else if (g_silent_mode == false)
+            printf("%d entries compiled to \"%s\".\r\n", g_system_info.fwid_mapping_db.entry_count, g_compiled_mapping_file_path);
+        goto EXIT;
+    }
+
+    /* Query Daemon (No Device Access) */
+    if(g_client_mode == true)
+    {
+        snprintf(request, sizeof(request), DAEMON_QUERY_FORMAT, \
+                 g_show_system_info, g_validate_dev, g_pid, g_system_type, g_silent_mode);
+        err = send_daemon_request(request, &result);
+        if (err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Query hid_read_fwid Daemon! err=0x%x.\r\n", err);
+            goto EXIT;
+        }
+        err = result;
+        goto EXIT;
+    }
+
     /* Initialize Resource */
     err = resource_init();
     if (err != ERR_SUCCESS)
@@ -835,6 +1506,15 @@ int main(int argc, char **argv)
         goto EXIT1;
     }
 
+    /* Serve Queries until SIGTERM (Foreground in Debug Mode) */
+    if(g_daemon_mode == true)
+    {
+        err = run_daemon(g_fwid_mapping_file_path, g_debug, daemon_refresh, daemon_request);
+        if (err != ERR_SUCCESS)
+            ERROR_PRINTF("Fail to Run Daemon! err=0x%x.\r\n", err);
+        goto EXIT1;
+    }
+
     /* Open Device */
     err = open_device() ;
     if (err != ERR_SUCCESS)
@@ -843,159 +1523,43 @@ int main(int argc, char **argv)
         goto EXIT2;
     }
 
-    /* Detect Touch State */
-
-    // Get Hello Packet
-    err = get_hello_packet_bc_version_with_error_retry(&hello_packet, &bc_bc_version, ERROR_RETRY_COUNT);
-    if(err != ERR_SUCCESS)
+    /* Detect Touch State & Read Information FWID */
+    err = read_touch_info(&g_system_info.touch_session, &g_system_info.info_fwid);
+    if (err != ERR_SUCCESS)
     {
-        ERROR_PRINTF("Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", err);
         goto EXIT2;
     }
-    DEBUG_PRINTF("Hello Packet: 0x%02x, Recovery Mode BC Version: 0x%04x.\r\n", hello_packet, bc_bc_version);
-
-    // Identify HW Series & Touch State
-    switch (hello_packet)
-    {
-        case ELAN_HID_NORMAL_MODE_HELLO_PACKET:
-            // BC Version (Normal Mode)
-            err = get_boot_code_version(&fw_bc_version);
-            if(err != ERR_SUCCESS)
-            {
-                ERROR_PRINTF("%s: Fail to Get BC Version (Normal Mode)! err=0x%x.\r\n", __func__, err);
-                goto EXIT2;
-            }
-            DEBUG_PRINTF("Normal Mode BC Version: 0x%04x.\r\n", fw_bc_version);
-
-            // Special Case: First BC of EM32F901 / EM32F902
-            if((HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_HID) /* EM32F901 */ ||
-               (HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_HID) /* FM32F902 */)
-                gen8_touch = true;     // Gen8 Touch
-            else
-                gen8_touch = false;    // Gen5/6/7 Touch
-            recovery = false;          // Normal Mode
-            break;
-
-        case ELAN_GEN8_HID_NORMAL_MODE_HELLO_PACKET:
-            gen8_touch = true;         // Gen8 Touch
-            recovery = false;          // Normal Mode
-            break;
-
-        case ELAN_HID_RECOVERY_MODE_HELLO_PACKET:
-            // Special Case: First BC of EM32F901 / EM32F902
-            if((HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_HID) /* EM32F901 */ ||
-               (HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_HID) /* FM32F902 */)
-                gen8_touch = true;     // Gen8 Touch
-            else
-                gen8_touch = false;    // Gen5/6/7 Touch
-            recovery = true;           // Recovery Mode
-            break;
-
-        case ELAN_GEN8_HID_RECOVERY_MODE_HELLO_PACKET:
-            gen8_touch = true;         // Gen8 Touch
-            recovery = true;           // Recovery Mode
-            break;
-
-        default:
-            ERROR_PRINTF("%s: Unknown Hello Packet! (0x%02x) \r\n", __func__, hello_packet);
-            err = ERR_UNKNOWN_DEVICE_TYPE;
-            goto EXIT2;
-    }
-
-    // Check if Recovery Mode
-    if(recovery == true)
-    {
-        if(g_silent_mode == false) // Not in Silent Mode
-            printf("In Recovery Mode.\r\n");
-    }
+    g_system_info.touch_info_valid = true;
 
     /* Get System Info. */
-    err = get_system_info(hid_dev_info, sizeof(hid_dev_info), \
-                          &edid_manufacturer_code, &edid_product_code, &edid_info_found, \
-                          g_fwid_mapping_file_path, sizeof(g_fwid_mapping_file_path), \
-                          lcm_panel_info, sizeof(lcm_panel_info));
+    err = get_system_info(g_system_info.hid_dev_info, sizeof(g_system_info.hid_dev_info), \
+                          &g_system_info.edid_manufacturer_code, &g_system_info.edid_product_code, &g_system_info.edid_info_found);
     if (err != ERR_SUCCESS)
     {
         ERROR_PRINTF("Fail to Get System Info.! err=0x%x.\r\n", err);
         goto EXIT2;
     }
 
-    /* Read Information FWID */
-    if(gen8_touch) // Gen8 Touch
-        err = gen8_read_info_fwid(&info_fwid, recovery);
-    else // Gen5/6/7 Touch
-        err = read_info_fwid(&info_fwid, recovery);
+    /* Get LCM Device Info. */
+    err = get_lcm_dev_info(g_fwid_mapping_file_path, sizeof(g_fwid_mapping_file_path), &g_system_info.fwid_mapping_db);
     if (err != ERR_SUCCESS)
     {
-        ERROR_PRINTF("Fail to Read Information FWID! err=0x%x.\r\n", err);
+        ERROR_PRINTF("Fail to Get LCM Device Info.! err=0x%x.\r\n", err);
         goto EXIT2;
     }
 
-    /* Show System Information */
-    if(g_show_system_info == true)
-    {
-        err = show_system_info(hid_dev_info, sizeof(hid_dev_info), \
-                               edid_info_found, edid_manufacturer_code, edid_product_code, \
-                               g_lookup_fwid, lcm_panel_info, sizeof(lcm_panel_info), \
-                               info_fwid);
-        if (err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("%s: Fail to Show System Info.! err=0x%x.\r\n", __func__, err);
-            goto EXIT2;
-        }
-    }
-
-    /* Validate Elan Touchsceen Device */
-    if(g_validate_dev == true)
+    /* Query Fields (Same Device Session) */
+    if(g_query == true)
     {
-        err = validate_elan_hid_device(hid_dev_info, sizeof(hid_dev_info), g_pid, g_silent_mode);
-        if (err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("%s: Fail to validate elan HID Device (PID: %04x)! err=0x%x.\r\n", __func__, g_pid, err);
-            goto EXIT2;
-        }
+        err = run_query(&g_system_info.touch_session, g_query_field, g_query_field_count, g_query_format);
+        goto EXIT2;
     }
 
-    if(g_lookup_fwid == true) // Lookup FWID has been Requested
+    /* Show System Info. / FWID */
+    err = process_query(&g_system_info);
+    if (err != ERR_SUCCESS)
     {
-        if(edid_info_found == true) // EDID Info. Found
-        {
-            /* Get FWID from EDID */
-            err = get_fwid_from_edid(lcm_panel_info, sizeof(lcm_panel_info), edid_manufacturer_code, edid_product_code, g_system_type, &fwid_from_edid);
-            if (err == ERR_SUCCESS) // FWID from EDID Found
-            {
-                DEBUG_PRINTF("fwid_from_edid Found: 0x%x.\r\n", fwid_from_edid);
-                fwid = fwid_from_edid;
-            }
-            else // FWID from EDID Not Found
-            {
-                if (err == ERR_DATA_NOT_FOUND) // Can not find FWID from Mapping Table
-                {
-                    // Use Information FWID Instead
-                    DEBUG_PRINTF("fwid_from_edid Not Found, use info_fwid (%x) instead.\r\n", info_fwid);
-                    fwid = info_fwid;
-                }
-                else // if ((err != ERR_SUCCESS) && (err != ERR_DATA_NOT_FOUND))
-                {
-                    ERROR_PRINTF("%s: Fail to get %s FWID! err=0x%x.\r\n", __func__, (g_system_type == CHROME) ? "chrome" : "windows", err);
-                    goto EXIT2;
-                }
-            }
-        }
-        else // EDID Info. Not Found
-        {
-            // Use Information FWID Instead
-            DEBUG_PRINTF("EDID read failed, use info_fwid (%x) instead.\r\n", info_fwid);
-            fwid = info_fwid;
-        }
-
-        /* Show FWID */
-        err = show_fwid(g_system_type, fwid, g_silent_mode);
-        if (err != ERR_SUCCESS)
-        {
-            ERROR_PRINTF("%s: Fail to show %s FWID! err=0x%x.\r\n", __func__, (g_system_type == CHROME) ? "chrome" : "windows", err);
-            goto EXIT2;
-        }
+        goto EXIT2;
     }
 
     // Success
@@ -1005,11 +1569,17 @@ EXIT2:
     /* Close Device */
     close_device();
 
+    /* Retry Statistics */
+    show_retry_stats();
+
 EXIT1:
     /* Release Resource */
     resource_free();
 
 EXIT:
+    /* Release FWID Mapping Database */
+    free_fwid_mapping_db(&g_system_info.fwid_mapping_db);
+
     /* End of Output Stream */
     printf("\r\n");
 
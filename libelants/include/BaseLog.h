@@ -45,7 +45,7 @@
 #endif //DEFAULT_LOG_DIR
 
 #ifndef DEFAULT_LOG_FILE
-#define DEFAULT_LOG_FILE               "elants_hid_iap_log.txt"
+#define DEFAULT_LOG_FILE               "elants_hid_log.txt"
 #endif // DEFAULT_LOG_FILE
 
 //////////////////////////////////////////////////////////////////////
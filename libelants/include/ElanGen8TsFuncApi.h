@@ -30,10 +30,22 @@
  * Definitions
  ***************************************************/
 
+// Max. Page Count of One Erase Command Built by Merging Sections:
+// Boot code erase timing (101ms per 32 pages, 404ms for 97~132 pages) is only given up to 132 pages, which keeps one
+// command within the 500ms wait. Merging never grows a command beyond this; sections of the eKTL file are not split.
+#ifndef ELAN_GEN8_ERASE_PAGE_COUNT_MAX
+#define ELAN_GEN8_ERASE_PAGE_COUNT_MAX      132
+#endif //ELAN_GEN8_ERASE_PAGE_COUNT_MAX
+
 /***************************************************
  * Macros
  ***************************************************/
 
+// Low Word
+#ifndef LOW_WORD_OF_UINT
+#define LOW_WORD_OF_UINT(uint_value)     ((unsigned short)(uint_value & 0x0000FFFF))
+#endif //LOW_WORD_OF_UINT
+
 // Low Byte of Unsigned Int Value
 #ifndef LOW_BYTE_OF_UINT
 #define LOW_BYTE_OF_UINT(uint_value)     ((unsigned char)(uint_value & 0x000000FF))
@@ -76,14 +88,20 @@ int gen8_get_rom_data(unsigned int addr, unsigned char data_len, unsigned int *p
 // Remark ID
 int gen8_read_remark_id(unsigned char *p_gen8_remark_id_buf, size_t gen8_remark_id_buf_size, bool recovery);
 
+// Information FWID
+int gen8_read_info_fwid(unsigned short *p_info_fwid, bool recovery);
+
 // Memory / Firmware Page Data
 int gen8_read_memory_page(unsigned short mem_page_address, unsigned short mem_page_size, unsigned char *p_mem_page_buf, size_t mem_page_buf_size);
+int gen8_read_memory_block(unsigned short mem_block_address, unsigned int mem_block_size, unsigned char *p_mem_block_buf, size_t mem_block_buf_size);
 int create_ektl_fw_page(unsigned int mem_page_address, unsigned char *p_ektl_fw_page_data_buf, size_t ektl_fw_page_data_buf_size, unsigned char *p_ektl_fw_page_buf, size_t ektl_fw_page_buf_size);
 int write_ektl_fw_page(unsigned char *p_ektl_fw_page_buf, size_t ektl_fw_page_buf_size);
 
 // Information Page
 int gen8_get_info_page(unsigned char *p_info_page_buf, size_t info_page_buf_size);
 int gen8_get_info_page_with_error_retry(unsigned char *p_info_page_buf, size_t info_page_buf_size, int retry_count);
+void gen8_invalidate_info_page_cache(void);
+int gen8_read_update_info(struct update_info *p_update_info, size_t update_info_size);
 
 int gen8_get_update_info(unsigned char *p_info_page_buf, size_t info_page_buf_size, struct update_info *p_update_info, size_t update_info_size);
 int gen8_update_info_page(struct update_info *p_update_info, size_t update_info_size, unsigned char *p_info_page_buf, size_t info_page_buf_size);
@@ -41,6 +41,11 @@
 #define MAX_ERASE_SECTION_COUNT        256    // (2056-6-4-16-4-3)/(4+4)=252.875
 #endif //MAX_ERASE_SECTION_COUNT
 
+// Erase Section Count Max in Header Page (Sections from Offset 30 to "eof")
+#ifndef MAX_HEADER_ERASE_SECTION_COUNT
+#define MAX_HEADER_ERASE_SECTION_COUNT ((ELAN_EKTL_FW_PAGE_SIZE - 30 - 3) / 8)    // 252
+#endif //MAX_HEADER_ERASE_SECTION_COUNT
+
 /***************************************************
  * Macro Function Definitions
  ***************************************************/
@@ -100,6 +105,10 @@ extern int g_firmware_fd;
 
 // Validate eKTL FW
 int validate_ektl_fw(bool *p_result);
+int validate_ektl_fw_image(void);
+
+// eKTL Page Checksum
+unsigned int compute_ektl_page_checksum(const unsigned char *p_data, size_t data_size);
 
 // eKTL FW File I/O
 int compute_ektl_fw_page_number(int firmware_size);
@@ -107,6 +116,7 @@ int compute_ektl_page_number(int firmware_size);
 
 // eKTL Erase Script
 int get_ektl_erase_script(struct erase_script *p_erase_script, size_t erase_script_size);
+int plan_ektl_erase_script(const struct erase_script *p_erase_script, unsigned int page_count_max, struct erase_script *p_erase_plan, size_t erase_plan_size);
 
 // eKTL Page Data
 int get_page_data_from_ektl_firmware(unsigned char page_index, unsigned char *p_ektl_page_buf, size_t ektl_page_buf_size);
@@ -53,4 +53,11 @@ int gen8_check_remark_id(bool recovery);
 // Firmware Update
 int gen8_update_firmware(char *filename, size_t filename_len, bool recovery, int skip_action_code);
 
+// Firmware Verification (Flash against eKTL FW File)
+int gen8_check_firmware_verifiable(void);
+int gen8_verify_firmware(message_mode_t msg_mode);
+
+// Flash Dump
+int gen8_dump_flash(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode);
+
 #endif //__ELAN_GEN8_TS_FW_UPDATE_FLOW_H__
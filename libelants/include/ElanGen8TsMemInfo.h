@@ -27,6 +27,21 @@
 #define ELAN_GEN8_MEMORY_PAGE_SIZE               2048  // 0x800
 #endif //ELAN_GEN8_MEMORY_PAGE_SIZE
 
+// Memory Block Size (Unit of Bulk Read)
+#ifndef ELAN_GEN8_MEMORY_BLOCK_SIZE
+#define ELAN_GEN8_MEMORY_BLOCK_SIZE              (ELAN_GEN8_MEMORY_PAGE_SIZE)
+#endif //ELAN_GEN8_MEMORY_BLOCK_SIZE
+
+// Flash Dump Address (Offset from Information ROM, Same as Bulk Read Address)
+#ifndef ELAN_GEN8_FLASH_DUMP_ADDR
+#define ELAN_GEN8_FLASH_DUMP_ADDR                0x0000
+#endif //ELAN_GEN8_FLASH_DUMP_ADDR
+
+// Flash Dump Size: Whole Address Space of Bulk Read (16-bit Offset), in Byte
+#ifndef ELAN_GEN8_FLASH_DUMP_SIZE
+#define ELAN_GEN8_FLASH_DUMP_SIZE                0x10000
+#endif //ELAN_GEN8_FLASH_DUMP_SIZE
+
 // Information ROM Address
 #ifndef ELAN_GEN8_INFO_ROM_MEMORY_ADDR
 #define ELAN_GEN8_INFO_ROM_MEMORY_ADDR           0x00040000
@@ -72,6 +87,11 @@
 #define ELAN_GEN8_LAST_UPDATE_TIME_MINUTE_ADDR   0x00041C20
 #endif //ELAN_GEN8_LAST_UPDATE_TIME_MINUTE_ADDR
 
+// Update Information Size (Update Counter & Last Update Time: 0x00041C00 ~ 0x00041C23)
+#ifndef ELAN_GEN8_UPDATE_INFO_SIZE
+#define ELAN_GEN8_UPDATE_INFO_SIZE               0x24
+#endif //ELAN_GEN8_UPDATE_INFO_SIZE
+
 
 // Remark ID Length
 #ifndef ELAN_GEN8_REMARK_ID_LEN
@@ -83,4 +103,9 @@
 #define ELAN_GEN8_REMARK_ID_INDEX_ADDR           0x00042200
 #endif //ELAN_GEN8_REMARK_ID_INDEX_ADDR
 
+// Remark ID Region (Remark ID Index & Address Set 1~7: 0x00042200 ~ 0x000423FF)
+#ifndef ELAN_GEN8_REMARK_ID_REGION_SIZE
+#define ELAN_GEN8_REMARK_ID_REGION_SIZE          0x200
+#endif //ELAN_GEN8_REMARK_ID_REGION_SIZE
+
 #endif //__ELAN_GEN8_TS_MEM_INFO_H__
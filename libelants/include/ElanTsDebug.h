@@ -15,6 +15,9 @@
 // Debug
 extern bool g_debug;
 
+// Debug Message to stderr (e.g. stdout Carries Replies to Clients)
+extern bool g_debug_to_stderr;
+
 //////////////////////////////////////////////////////////////////////
 // Macro
 //////////////////////////////////////////////////////////////////////
@@ -23,7 +26,7 @@ extern bool g_debug;
 #ifndef DEBUG_PRINTF
 #define DEBUG_PRINTF(fmt, argv...) \
 do{ \
-    if(g_debug) printf(fmt, ##argv); \
+    if(g_debug) fprintf((g_debug_to_stderr) ? stderr : stdout, fmt, ##argv); \
 }while(0)
 #endif //DEBUG_PRINTF
 
@@ -72,6 +72,23 @@ struct update_info
 };
 typedef struct update_info UPDATE_INFO, *P_UPDATE_INFO;
 
+// Calibration Result
+struct calibration_result
+{
+    unsigned long duration_ms;      // Re-Calibration Command Sent to Completion Report
+    unsigned short rek_counter;     // Calibration Counter Read after Completion
+};
+
+// Touch State Detected Once per Device Session
+struct touch_session
+{
+    unsigned char hello_packet;
+    unsigned short bc_bc_version;   // BC Version from Hello Packet Query (Valid in Recovery Mode)
+    unsigned short fw_bc_version;   // BC Version from Main Code (Valid in Normal Mode, 0 if not Read)
+    bool gen8_touch;
+    bool recovery;
+};
+
 /***************************************************
  * Global Data Structure Declaration
  ***************************************************/
@@ -93,6 +110,7 @@ int get_boot_code_version(unsigned short *p_bc_version);
 int get_firmware_id(unsigned short *p_fw_id);
 int get_fw_version(unsigned short *p_fw_version);
 int get_test_version(unsigned short *p_test_version);
+int get_firmware_info(unsigned short *p_fw_id, unsigned short *p_fw_version, unsigned short *p_test_version, unsigned short *p_bc_version, bool gen8_touch);
 
 // Solution ID
 int get_solution_id(unsigned char *p_solution_id);
@@ -100,6 +118,8 @@ int get_solution_id(unsigned char *p_solution_id);
 // Calibration
 int calibrate_touch(void);
 int calibrate_touch_with_error_retry(int retry_count);
+int calibrate_touch_and_get_counter(struct calibration_result *p_calibration_result);
+int calibrate_touch_and_get_counter_with_error_retry(struct calibration_result *p_calibration_result, int retry_count);
 
 // Calibration Counter
 int get_rek_counter(unsigned short *p_rek_counter);
@@ -109,6 +129,9 @@ int get_hello_packet_bc_version(unsigned char *p_hello_packet, unsigned short *p
 int get_hello_packet_bc_version_with_error_retry(unsigned char *p_hello_packet, unsigned short *p_bc_version, int retry_count);
 int get_hello_packet_with_error_retry(unsigned char *p_hello_packet, int retry_count);
 
+// Touch State (HW Series & Normal / Recovery Mode)
+int detect_touch_state(struct touch_session *p_session);
+
 // IAP
 int switch_to_boot_code(bool recovery);
 int check_slave_address(void);
@@ -118,12 +141,16 @@ int read_remark_id(bool recovery);
 
 // Memory / Firmware Page Data
 int read_memory_page(unsigned short mem_page_address, unsigned short mem_page_size, unsigned char *p_mem_page_buf, size_t mem_page_buf_size);
+int receive_bulk_rom_frames(unsigned int data_size, unsigned char *p_data_buf, size_t data_buf_size);
+int read_memory_block(unsigned short mem_block_address, unsigned int mem_block_size, unsigned char *p_mem_block_buf, size_t mem_block_buf_size);
 int create_firmware_page(unsigned int mem_page_address, unsigned char *p_fw_page_data_buf, size_t fw_page_data_buf_size, unsigned char *p_fw_page_buf, size_t fw_page_buf_size);
 int write_firmware_page(unsigned char *p_fw_page_buf, int fw_page_buf_size);
 
 // Information Page
 int get_info_page(unsigned char *info_page_buf, size_t info_page_buf_size);
 int get_info_page_with_error_retry(unsigned char *info_page_buf, size_t info_page_buf_size, int retry_count);
+void invalidate_info_page_cache(void);
+int read_update_info(struct update_info *p_update_info, size_t update_info_size);
 
 int get_update_info(unsigned char *p_info_page_buf, size_t info_page_buf_size, struct update_info *p_update_info, size_t update_info_size);
 int update_info_page(struct update_info *p_update_info, size_t update_info_size, unsigned char *p_info_page_buf, size_t info_page_buf_size);
@@ -0,0 +1,97 @@
+/** @file
+
+  Header of Firmware Bundle Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsFwBundle.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_FW_BUNDLE_H__
+#define __ELAN_TS_FW_BUNDLE_H__
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ElanTsDebug.h"
+#include "ElanTsFwUpdateFlow.h" // message_mode_t
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/*
+ * Firmware Bundle (.elb):
+ *   Header  | Magic "ELB1" (4) | Entry Count (4) | Index Checksum (4, FNV-1a of Index) | Reserved (4) |   (Little Endian)
+ *   Index   | FWID (2) | Generation (1, 5: Gen5/6/7, 8: Gen8) | Reserved (1) | Offset (4) | Size (4) |
+ *           | Checksum (4, FNV-1a of Image) |                                                          (Entry Count)
+ *   Images  | Firmware Image as Given (Raw or Compressed) | ...
+ */
+
+// Magic
+#ifndef ELAN_FW_BUNDLE_MAGIC
+#define ELAN_FW_BUNDLE_MAGIC                "ELB1"
+#endif //ELAN_FW_BUNDLE_MAGIC
+
+#ifndef ELAN_FW_BUNDLE_MAGIC_SIZE
+#define ELAN_FW_BUNDLE_MAGIC_SIZE           4
+#endif //ELAN_FW_BUNDLE_MAGIC_SIZE
+
+// Header Size
+#ifndef ELAN_FW_BUNDLE_HEADER_SIZE
+#define ELAN_FW_BUNDLE_HEADER_SIZE          16
+#endif //ELAN_FW_BUNDLE_HEADER_SIZE
+
+// Index Entry Size
+#ifndef ELAN_FW_BUNDLE_ENTRY_SIZE
+#define ELAN_FW_BUNDLE_ENTRY_SIZE           16
+#endif //ELAN_FW_BUNDLE_ENTRY_SIZE
+
+// Max. Entry Count
+#ifndef ELAN_FW_BUNDLE_ENTRY_COUNT_MAX
+#define ELAN_FW_BUNDLE_ENTRY_COUNT_MAX      256
+#endif //ELAN_FW_BUNDLE_ENTRY_COUNT_MAX
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Index Entry of Firmware Bundle
+struct fw_bundle_entry
+{
+    unsigned short fwid;        // Information FWID of Touch
+    unsigned char generation;   // ELAN_TS_GEN_5 (Gen5/6/7) or ELAN_TS_GEN_8
+    unsigned int offset;        // Image Offset from Start of Bundle
+    unsigned int size;          // Image Size (Stored Bytes)
+    unsigned int checksum;      // FNV-1a of Stored Bytes
+};
+
+// Source Image of Firmware Bundle
+struct fw_bundle_source
+{
+    unsigned short fwid;
+    int generation;
+    const char *p_filename;
+};
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Bundle
+bool is_firmware_bundle(const char *p_filename);
+
+// Entry Selection (Image of Matched Entry in Anonymous Memory File)
+int extract_firmware_bundle_entry(const char *p_bundle_filename, unsigned short fwid, int generation, int *p_image_fd);
+
+// Bundle Creation
+int create_firmware_bundle(const char *p_bundle_filename, const struct fw_bundle_source *p_source, int source_count, message_mode_t msg_mode);
+
+#endif //__ELAN_TS_FW_BUNDLE_H__
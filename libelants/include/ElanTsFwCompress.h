@@ -0,0 +1,116 @@
+/** @file
+
+  Header of Compressed Firmware Image Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsFwCompress.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_FW_COMPRESS_H__
+#define __ELAN_TS_FW_COMPRESS_H__
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ElanTsDebug.h"
+#include "ElanTsFwUpdateFlow.h" // message_mode_t
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/*
+ * Compressed Firmware Image (.elz):
+ *   Header  | Magic "ELZ1" (4) | Raw Size (4) | Block Size (4) | Raw Checksum (4, FNV-1a) |   (Little Endian)
+ *   Blocks  | Block Length (4, Bit 31 Set if Stored) | LZ Sequences or Stored Bytes |       (Repeated)
+ *
+ *   Each Block Decodes to Block Size Bytes (Last Block: Remainder) without Referring Other Blocks.
+ *   LZ Sequence: | Token (Literal Length << 4 | Match Length - 4) | Literal Length Ext. | Literals |
+ *                | Offset (2) | Match Length Ext. |, Last Sequence of Block has Literals Only.
+ */
+
+// Magic
+#ifndef ELAN_FW_COMPRESS_MAGIC
+#define ELAN_FW_COMPRESS_MAGIC              "ELZ1"
+#endif //ELAN_FW_COMPRESS_MAGIC
+
+#ifndef ELAN_FW_COMPRESS_MAGIC_SIZE
+#define ELAN_FW_COMPRESS_MAGIC_SIZE         4
+#endif //ELAN_FW_COMPRESS_MAGIC_SIZE
+
+// Header Size
+#ifndef ELAN_FW_COMPRESS_HEADER_SIZE
+#define ELAN_FW_COMPRESS_HEADER_SIZE        16
+#endif //ELAN_FW_COMPRESS_HEADER_SIZE
+
+// Block Size (Raw Bytes per Block)
+#ifndef ELAN_FW_COMPRESS_BLOCK_SIZE
+#define ELAN_FW_COMPRESS_BLOCK_SIZE         0x10000
+#endif //ELAN_FW_COMPRESS_BLOCK_SIZE
+
+// Max. Block Size Accepted from Image
+#ifndef ELAN_FW_COMPRESS_BLOCK_SIZE_MAX
+#define ELAN_FW_COMPRESS_BLOCK_SIZE_MAX     0x100000
+#endif //ELAN_FW_COMPRESS_BLOCK_SIZE_MAX
+
+// Max. Raw Size Accepted from Image (Bound of Memory for Decompressed Image)
+#ifndef ELAN_FW_COMPRESS_RAW_SIZE_MAX
+#define ELAN_FW_COMPRESS_RAW_SIZE_MAX       0x4000000  // 64MB
+#endif //ELAN_FW_COMPRESS_RAW_SIZE_MAX
+
+// Stored Block Flag (in Block Length)
+#ifndef ELAN_FW_COMPRESS_STORED_FLAG
+#define ELAN_FW_COMPRESS_STORED_FLAG        0x80000000
+#endif //ELAN_FW_COMPRESS_STORED_FLAG
+
+// LZ Parameters
+#ifndef ELAN_FW_COMPRESS_MIN_MATCH
+#define ELAN_FW_COMPRESS_MIN_MATCH          4
+#endif //ELAN_FW_COMPRESS_MIN_MATCH
+
+#ifndef ELAN_FW_COMPRESS_MAX_OFFSET
+#define ELAN_FW_COMPRESS_MAX_OFFSET         0xFFFF
+#endif //ELAN_FW_COMPRESS_MAX_OFFSET
+
+#ifndef ELAN_FW_COMPRESS_HASH_BITS
+#define ELAN_FW_COMPRESS_HASH_BITS          14
+#endif //ELAN_FW_COMPRESS_HASH_BITS
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Header of Compressed Firmware Image
+struct fw_compress_header
+{
+    unsigned int raw_size;      // Decompressed Image Size (Page Counts are Computed from This)
+    unsigned int block_size;
+    unsigned int raw_checksum;  // FNV-1a of Decompressed Image
+};
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Checksum (FNV-1a)
+unsigned int compute_firmware_checksum(const unsigned char *p_data, size_t data_size);
+
+// Header
+bool is_compressed_firmware(int fd);
+int read_compressed_firmware_header(int fd, struct fw_compress_header *p_header);
+
+// Decompression (Stream Blocks from fd into Anonymous Memory File, No Temp File)
+int decompress_firmware_file(int fd, int *p_raw_fd, int *p_raw_size);
+
+// Compression
+int compress_firmware_file(const char *p_src_filename, const char *p_dst_filename, message_mode_t msg_mode);
+
+#endif //__ELAN_TS_FW_COMPRESS_H__
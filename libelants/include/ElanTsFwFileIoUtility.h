@@ -42,6 +42,16 @@
 #define ELAN_FIRMWARE_PAGE_DATA_SIZE    128  // 0x40 (in word)
 #endif //ELAN_FIRMWARE_PAGE_DATA_SIZE
 
+// Dump File Write Queue Depth (in Chunk)
+#ifndef DUMP_FILE_QUEUE_DEPTH
+#define DUMP_FILE_QUEUE_DEPTH           8
+#endif //DUMP_FILE_QUEUE_DEPTH
+
+// Dump File Write Chunk Size
+#ifndef DUMP_FILE_CHUNK_SIZE
+#define DUMP_FILE_CHUNK_SIZE            0x4000
+#endif //DUMP_FILE_CHUNK_SIZE
+
 /***************************************************
  * Macro Function Definitions
  ***************************************************/
@@ -70,12 +80,22 @@
 
 // Firmware File I/O
 int open_firmware_file(char *filename, size_t filename_len);
+int open_firmware_bundle_file(char *filename, size_t filename_len, unsigned short fwid, int generation);
 int close_firmware_file(void);
 int get_firmware_size(int *firmware_size);
 int compute_firmware_page_number(int firmware_size);
 int retrieve_data_from_firmware(unsigned char *data, int data_size);
 
+// Firmware File Mapping (Read-Only)
+int map_firmware_file(unsigned char **pp_firmware_data, int *p_firmware_size);
+int unmap_firmware_file(unsigned char *p_firmware_data, int firmware_size);
+
 // Remark ID
 int get_remark_id_from_firmware(unsigned short *p_remark_id);
 
+// Dump File (Written Asynchronously by Writer Thread)
+int open_dump_file(char *filename, size_t filename_len);
+int write_dump_file(const unsigned char *p_data, size_t data_size);
+int close_dump_file(void);
+
 #endif //_ELAN_TS_FW_FILE_IO_UTILITY_H_
@@ -42,6 +42,11 @@
 #define ACTION_CODE_INFORMATION_UPDATE	0x02
 #endif // ACTION_CODE_INFORMATION_UPDATE
 
+// Max. Number of Mismatched Pages Reported by Verification
+#ifndef VERIFY_MISMATCH_REPORT_MAX
+#define VERIFY_MISMATCH_REPORT_MAX		16
+#endif // VERIFY_MISMATCH_REPORT_MAX
+
 /*******************************************
  * Data Structure Declaration
  ******************************************/
@@ -77,4 +82,11 @@ int check_remark_id(bool recovery);
 // Firmware Update
 int update_firmware(char *filename, size_t filename_len, bool recovery, int skip_action_code);
 
+// Firmware Verification (Flash against FW File)
+int check_firmware_verifiable(void);
+int verify_firmware(message_mode_t msg_mode);
+
+// Flash Dump
+int dump_flash(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode);
+
 #endif //__ELAN_TS_FW_UPDATE_FLOW_H__
@@ -0,0 +1,43 @@
+/** @file
+
+  Header of Generation-independent Flow Engines for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsGenFlow.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_GEN_FLOW_H__
+#define __ELAN_TS_GEN_FLOW_H__
+#pragma once
+
+#include <stdio.h>
+#include "ElanTsFwUpdateFlow.h" // message_mode_t
+#include "ElanTsGenTraits.h"
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Instantiated for ts_gen5_traits & ts_gen8_traits in ElanTsGenFlow.cpp
+
+// Firmware Verification Check (All Pages to Verify can be Read Back, before Update)
+template <class traits>
+int check_flash_pages_verifiable(void);
+
+// Firmware Verification (Flash against Mapped FW File)
+template <class traits>
+int verify_flash_pages(message_mode_t msg_mode);
+
+// Flash Dump (Address in Bulk Read Address Unit, Size in Byte)
+template <class traits>
+int dump_flash_blocks(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode);
+
+#endif //__ELAN_TS_GEN_FLOW_H__
@@ -0,0 +1,153 @@
+/** @file
+
+  Header of Generation Traits for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsGenTraits.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_GEN_TRAITS_H__
+#define __ELAN_TS_GEN_TRAITS_H__
+#pragma once
+
+#include "ElanTsMemInfo.h"
+#include "ElanGen8TsMemInfo.h"
+#include "ElanTsFuncApi.h"
+#include "ElanTsFwFileIoUtility.h"
+#include "ElanGen8TsFuncApi.h"
+#include "ElanGen8TsFwFileIoUtility.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Touch Generation (Gen5/Gen6/Gen7 Share One Flash Layout)
+#ifndef ELAN_TS_GEN_5
+#define ELAN_TS_GEN_5   5
+#endif //ELAN_TS_GEN_5
+
+#ifndef ELAN_TS_GEN_8
+#define ELAN_TS_GEN_8   8
+#endif //ELAN_TS_GEN_8
+
+// Bulk Read Window (16-bit Address of Show Bulk ROM Data Command)
+#ifndef ELAN_TS_BULK_READ_WINDOW
+#define ELAN_TS_BULK_READ_WINDOW    0x10000
+#endif //ELAN_TS_BULK_READ_WINDOW
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+/*
+ * Generation Traits:
+ *   Page Geometry, Address Width, FW File Page Layout & Bulk Read Command of One Touch Generation.
+ *   Flow Engines (ElanTsGenFlow) are Written once against These Members and Instantiated per Generation,
+ *   so Page Sizes are Compile-time Constants there. A New Generation Adds One Specialization.
+ */
+template <int generation>
+struct ts_gen_traits;
+
+// Gen5/Gen6/Gen7: Word Address, 132-byte FW Page (2-byte Address + 128-byte Data + 2-byte Checksum)
+template <>
+struct ts_gen_traits<ELAN_TS_GEN_5>
+{
+    typedef unsigned short address_t;
+
+    static const unsigned int address_unit       = 2;    // Bytes per Address
+    static const int          address_digits     = 4;    // Hex Digits of Address in Messages
+    static const unsigned int memory_page_size   = ELAN_MEMORY_PAGE_SIZE;
+    static const unsigned int memory_block_size  = ELAN_MEMORY_BLOCK_SIZE;
+    static const unsigned int fw_page_size       = ELAN_FIRMWARE_PAGE_SIZE;
+    static const unsigned int fw_page_data_start = 2;    // Page Address Field
+    static const int          fw_header_pages    = 0;
+
+    static const char *name(void) { return ""; }
+
+    // Page Address in FW File Page
+    static address_t fw_page_address(const unsigned char *p_fw_page)
+    {
+        return TWO_BYTE_ARRAY_TO_WORD(p_fw_page);
+    }
+
+    // Information Page is Written from Device Data (Updated), not from FW File
+    static bool is_verify_page(address_t page_address)
+    {
+        return (page_address != ELAN_INFO_PAGE_WRITE_MEMORY_ADDR);
+    }
+
+    // Whole Flash is in Bulk Read Space
+    static bool is_readable_page(address_t page_address)
+    {
+        return true;
+    }
+
+    // Bulk Read Address of Flash Address
+    static unsigned int bulk_address(address_t page_address)
+    {
+        return page_address;
+    }
+
+    static int read_bulk(unsigned short bulk_address, unsigned int size, unsigned char *p_buf, size_t buf_size)
+    {
+        return read_memory_block(bulk_address, size, p_buf, buf_size);
+    }
+};
+
+// Gen8: Byte Address, 2056-byte eKTL FW Page (4-byte Address + 2048-byte Data + 4-byte Checksum) after Header Page
+template <>
+struct ts_gen_traits<ELAN_TS_GEN_8>
+{
+    typedef unsigned int address_t;
+
+    static const unsigned int address_unit       = 1;
+    static const int          address_digits     = 8;
+    static const unsigned int memory_page_size   = ELAN_GEN8_MEMORY_PAGE_SIZE;
+    static const unsigned int memory_block_size  = ELAN_GEN8_MEMORY_BLOCK_SIZE;
+    static const unsigned int fw_page_size       = ELAN_EKTL_FW_PAGE_SIZE;
+    static const unsigned int fw_page_data_start = 4;
+    static const int          fw_header_pages    = 1;
+
+    static const char *name(void) { return "Gen8 "; }
+
+    static address_t fw_page_address(const unsigned char *p_fw_page)
+    {
+        return FOUR_BYTE_ARRAY_TO_UINT(p_fw_page);
+    }
+
+    // Information Page 3 is Written from Device Data (Updated), not from FW File
+    static bool is_verify_page(address_t page_address)
+    {
+        return (page_address != ELAN_GEN8_INFO_MEMORY_PAGE_3_ADDR);
+    }
+
+    // Bulk Read Addresses are 16-bit Offsets from Information ROM, so Pages out of This Window can not be Read Back
+    static bool is_readable_page(address_t page_address)
+    {
+        return ((page_address >= ELAN_GEN8_INFO_ROM_MEMORY_ADDR) && \
+                ((page_address - ELAN_GEN8_INFO_ROM_MEMORY_ADDR + ELAN_EKTL_FW_PAGE_DATA_SIZE) <= ELAN_TS_BULK_READ_WINDOW));
+    }
+
+    static unsigned int bulk_address(address_t page_address)
+    {
+        return page_address - ELAN_GEN8_INFO_ROM_MEMORY_ADDR;
+    }
+
+    static int read_bulk(unsigned short bulk_address, unsigned int size, unsigned char *p_buf, size_t buf_size)
+    {
+        return gen8_read_memory_block(bulk_address, size, p_buf, buf_size);
+    }
+};
+
+typedef ts_gen_traits<ELAN_TS_GEN_5> ts_gen5_traits;
+typedef ts_gen_traits<ELAN_TS_GEN_8> ts_gen8_traits;
+
+#endif //__ELAN_TS_GEN_TRAITS_H__
@@ -0,0 +1,100 @@
+/** @file
+
+  Header of Prebuilt Command Reports for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsHidCommand.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_HID_COMMAND_H__
+#define __ELAN_TS_HID_COMMAND_H__
+#pragma once
+
+#include <stddef.h>
+#include "HidConfig.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Bridge Command Report: | Report ID | 0x00 | Command Length | Command ... |
+#ifndef HID_BRIDGE_CMD_OFFSET
+#define HID_BRIDGE_CMD_OFFSET   3
+#endif //HID_BRIDGE_CMD_OFFSET
+
+// Vendor Command Report: | Report ID | Vendor Command ... |
+#ifndef HID_VENDOR_CMD_OFFSET
+#define HID_VENDOR_CMD_OFFSET   1
+#endif //HID_VENDOR_CMD_OFFSET
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Command ID (Index of Command Table)
+enum hid_command_id
+{
+    // Gen5 / Gen6 / Gen7
+    HID_CMD_FW_ID = 0,
+    HID_CMD_FW_VERSION,
+    HID_CMD_TEST_VERSION,
+    HID_CMD_BC_VERSION,
+    HID_CMD_REK,
+    HID_CMD_REK_COUNTER,
+    HID_CMD_ENTER_TEST_MODE,
+    HID_CMD_EXIT_TEST_MODE,
+    HID_CMD_READ_ROM_DATA,
+    HID_CMD_SHOW_BULK_ROM_DATA,
+    HID_CMD_SHOW_BULK_ROM_DATA_BC,
+    HID_CMD_WRITE_FLASH_KEY,
+    HID_CMD_ENTER_IAP,
+    HID_CMD_SLAVE_ADDRESS,
+    HID_CMD_FLASH_WRITE,
+    HID_CMD_REQUEST_HELLO_PACKET,
+
+    // Gen8
+    HID_CMD_GEN8_READ_ROM_DATA,
+    HID_CMD_GEN8_WRITE_FLASH_KEY,
+    HID_CMD_GEN8_ERASE_FLASH_SECTION,
+
+    HID_CMD_COUNT
+};
+
+// Prebuilt Output Report
+// Only the Variable Field (field_offset ~ field_offset + field_len - 1) is Patched at Runtime.
+struct hid_command
+{
+    int id;                                             // hid_command_id (Same as Table Index)
+    const char *name;                                   // Name in Messages
+    bool bridge;                                        // Bridge Command (Report ID Follows Device) or Vendor Command
+    int field_offset;                                   // Offset of Variable Field in Report (0 if None)
+    int field_len;                                      // Length of Variable Field
+    unsigned char report[ELAN_HID_OUTPUT_BUFFER_SIZE];  // Whole Output Report
+};
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+// Output Report ID of Bridge Command (Depends on Device)
+extern unsigned char __hidraw_get_output_report_id(void);
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Command Table
+const struct hid_command *get_hid_command(int cmd_id);
+
+// Send Prebuilt Report (p_field: Variable Field, NULL to Send Report as Built)
+int send_hid_command(int cmd_id, const unsigned char *p_field = NULL, int field_len = 0);
+
+#endif //__ELAN_TS_HID_COMMAND_H__
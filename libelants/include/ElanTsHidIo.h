@@ -0,0 +1,59 @@
+/** @file
+
+  Header of hidraw Device I/O for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsHidIo.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_HID_IO_H__
+#define __ELAN_TS_HID_IO_H__
+#pragma once
+
+#include "HIDLinuxGet.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+// InterfaceGet Class (Opened by Tool or C API, Used by write_cmd() / read_data())
+extern CHIDLinuxGet *g_pIntfGet;
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// HID Raw I/O Function
+int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
+int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
+int __hidraw_read_report(unsigned char* buf, int buf_len, int *p_report_len, int timeout_ms);
+int __hidraw_write_command(unsigned char* buf, int len, int timeout_ms);
+int __hidraw_read_data(unsigned char* buf, int len, int timeout_ms);
+unsigned char __hidraw_get_output_report_id(void);
+
+// Abstract Device I/O Function
+int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+int read_data(unsigned char *data_buf, int len, int timeout_ms);
+int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+
+#endif //__ELAN_TS_HID_IO_H__
@@ -38,10 +38,37 @@
 #define ELAN_READ_CALI_RESP_TIMEOUT_MSEC    10000 //30000
 #endif //ELAN_READ_CALI_RESP_TIMEOUT_MSEC
 
+// Header of Query Command & Response (Type in High Nibble of 2nd Byte)
+#ifndef ELAN_QUERY_COMMAND_HEADER
+#define ELAN_QUERY_COMMAND_HEADER           0x53
+#endif //ELAN_QUERY_COMMAND_HEADER
+
+#ifndef ELAN_QUERY_RESPONSE_HEADER
+#define ELAN_QUERY_RESPONSE_HEADER          0x52
+#endif //ELAN_QUERY_RESPONSE_HEADER
+
+// Max. Commands in One Pipelined Transaction
+#ifndef ELAN_PIPELINED_COMMAND_COUNT_MAX
+#define ELAN_PIPELINED_COMMAND_COUNT_MAX    8
+#endif //ELAN_PIPELINED_COMMAND_COUNT_MAX
+
+// Consecutive Pipelined Transactions with Missing Responses before Serial Mode is Used for Rest of Device Session
+#ifndef ELAN_PIPELINED_DROP_COUNT_MAX
+#define ELAN_PIPELINED_DROP_COUNT_MAX       3
+#endif //ELAN_PIPELINED_DROP_COUNT_MAX
+
 /*******************************************
  * Global Data Structure Declaration
  ******************************************/
 
+// Pipelined Query Command
+struct pipelined_command
+{
+    unsigned char cmd[4];       // | 0x53 | Type << 4 | Param. | Param. |
+    unsigned char response[4];  // | 0x52 | Type << 4 | Data   | Data   | (Valid if done)
+    bool done;
+};
+
 /*******************************************
  * Global Variables Declaration
  ******************************************/
@@ -62,6 +89,7 @@ extern int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
 // HID Raw I/O
 extern int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
 extern int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
+extern int __hidraw_read_report(unsigned char* buf, int buf_len, int *p_report_len, int timeout_ms);
 
 /*******************************************
  * Function Prototype
@@ -93,6 +121,7 @@ int get_boot_code_version_data(unsigned short *p_bc_version);
 // Calibration
 int send_rek_command(void);
 int receive_rek_response(void);
+int wait_rek_response(int timeout_ms);
 
 // Calibration Counter
 int send_rek_counter_command(void);
@@ -128,4 +157,8 @@ int receive_flash_write_response(void);
 // Hello Packet
 int send_request_hello_packet_command(void);
 
+// Pipelined Query Commands
+int issue_pipelined_commands(struct pipelined_command *p_cmd_list, int cmd_count, int timeout_ms);
+void reset_command_pipeline(void);
+
 #endif //__ELAN_TS_HID_UTILITY_H__
@@ -27,6 +27,21 @@
 #define ELAN_MEMORY_PAGE_SIZE                     128  // 0x40 (in word)
 #endif //ELAN_MEMORY_PAGE_SIZE
 
+// Memory Block Size (Unit of Bulk Read, 16 Pages)
+#ifndef ELAN_MEMORY_BLOCK_SIZE
+#define ELAN_MEMORY_BLOCK_SIZE                    2048  // 0x400 (in word)
+#endif //ELAN_MEMORY_BLOCK_SIZE
+
+// Flash Dump Address (Start of Main Code)
+#ifndef ELAN_FLASH_DUMP_ADDR
+#define ELAN_FLASH_DUMP_ADDR                      0x0000
+#endif //ELAN_FLASH_DUMP_ADDR
+
+// Flash Dump Size: Main Code (0x0000~0x7FFF) + Information ROM (0x8000~0x80FF), in Byte
+#ifndef ELAN_FLASH_DUMP_SIZE
+#define ELAN_FLASH_DUMP_SIZE                      0x10200
+#endif //ELAN_FLASH_DUMP_SIZE
+
 // Information ROM Address
 #ifndef ELAN_INFO_ROM_MEMORY_ADDR
 #define ELAN_INFO_ROM_MEMORY_ADDR                 0x8000
@@ -62,6 +77,11 @@
 #define ELAN_LAST_UPDATE_TIME_HOUR_MINUTE_ADDR    0x8063
 #endif //ELAN_LAST_UPDATE_TIME_HOUR_MINUTE_ADDR
 
+// Update Information Size (Update Counter & Last Update Time: 0x8060 ~ 0x8063)
+#ifndef ELAN_UPDATE_INFO_SIZE
+#define ELAN_UPDATE_INFO_SIZE                     8  // 4 words (in byte)
+#endif //ELAN_UPDATE_INFO_SIZE
+
 // Information Page ROM FWID Address
 #ifndef ELAN_INFO_ROM_FWID_MEMORY_ADDR
 #define ELAN_INFO_ROM_FWID_MEMORY_ADDR	    0x8080
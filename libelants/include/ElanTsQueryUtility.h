@@ -0,0 +1,86 @@
+/** @file
+
+  Header of Query Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsQueryUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_QUERY_UTILITY_H__
+#define __ELAN_TS_QUERY_UTILITY_H__
+#pragma once
+
+#include <stddef.h>
+#include "ElanTsDebug.h"
+#include "ElanTsFuncApi.h"   // struct touch_session
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Max. Number of Fields in a Query
+#ifndef QUERY_FIELD_COUNT_MAX
+#define QUERY_FIELD_COUNT_MAX       32
+#endif //QUERY_FIELD_COUNT_MAX
+
+// Max. Length of Field Value (String)
+#ifndef QUERY_VALUE_LENGTH_MAX
+#define QUERY_VALUE_LENGTH_MAX      64
+#endif //QUERY_VALUE_LENGTH_MAX
+
+// Field List Keyword for All Fields
+#ifndef QUERY_FIELD_ALL
+#define QUERY_FIELD_ALL             "all"
+#endif //QUERY_FIELD_ALL
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Output Format of Query Record
+enum query_format
+{
+    QUERY_FORMAT_KEY_VALUE  = 0,    // key=value key=value ...
+    QUERY_FORMAT_JSON       = 1     // {"key":"value",...}
+};
+typedef enum query_format query_format_t;
+
+// Field Getter: Format Value to String.
+// Return ERR_FUNC_NOT_SUPPORT if not available in current touch state, then value is emitted as null (not an error).
+typedef int (*query_field_getter)(const struct touch_session *p_session, char *p_value_buf, size_t value_buf_size);
+
+struct query_field
+{
+    const char *name;
+    query_field_getter get_value;
+};
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Field List
+int parse_query_field_list(const char *p_field_list, const struct query_field *p_field_table, size_t field_table_count, \
+                           const struct query_field **pp_query_field, size_t query_field_size, size_t *p_query_field_count);
+void show_query_field_names(const struct query_field *p_field_table, size_t field_table_count);
+
+// Query
+int run_query(const struct touch_session *p_session, const struct query_field **pp_query_field, size_t query_field_count, query_format_t format);
+
+#endif //__ELAN_TS_QUERY_UTILITY_H__
@@ -0,0 +1,126 @@
+/** @file
+
+  Header of Retry Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsRetryUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_RETRY_UTILITY_H__
+#define __ELAN_TS_RETRY_UTILITY_H__
+#pragma once
+
+#include <stddef.h>
+#include "ElanTsDebug.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Error Classes (Bit Mask)
+#ifndef RETRY_ERR_CLASS_TIMEOUT
+#define RETRY_ERR_CLASS_TIMEOUT     0x01    // ERR_IO_TIMEOUT
+#endif //RETRY_ERR_CLASS_TIMEOUT
+
+#ifndef RETRY_ERR_CLASS_IO
+#define RETRY_ERR_CLASS_IO          0x02    // ERR_IO_ERROR, ERR_GET_DATA_FAIL, ERR_CONNECT_NO_HELLO_PACKET
+#endif //RETRY_ERR_CLASS_IO
+
+#ifndef RETRY_ERR_CLASS_DATA
+#define RETRY_ERR_CLASS_DATA        0x04    // ERR_DATA_PATTERN, ERR_DATA_MISMATCHED
+#endif //RETRY_ERR_CLASS_DATA
+
+#ifndef RETRY_ERR_CLASS_OTHER
+#define RETRY_ERR_CLASS_OTHER       0x08    // Others, except ERR_INVALID_PARAM & ERR_FUNC_NOT_SUPPORT (Never Retried)
+#endif //RETRY_ERR_CLASS_OTHER
+
+#ifndef RETRY_ERR_CLASS_ALL
+#define RETRY_ERR_CLASS_ALL         (RETRY_ERR_CLASS_TIMEOUT | RETRY_ERR_CLASS_IO | RETRY_ERR_CLASS_DATA | RETRY_ERR_CLASS_OTHER)
+#endif //RETRY_ERR_CLASS_ALL
+
+// Default Retry Policy: Exponential Backoff 10ms, 20ms, ... (Max. 50ms), 25% Jitter, on All Error Classes (as Former Retry Loops)
+#ifndef RETRY_DEFAULT_DELAY_MS
+#define RETRY_DEFAULT_DELAY_MS      10
+#endif //RETRY_DEFAULT_DELAY_MS
+
+#ifndef RETRY_DEFAULT_DELAY_MAX_MS
+#define RETRY_DEFAULT_DELAY_MAX_MS  50
+#endif //RETRY_DEFAULT_DELAY_MAX_MS
+
+#ifndef RETRY_DEFAULT_JITTER_PERCENT
+#define RETRY_DEFAULT_JITTER_PERCENT 25
+#endif //RETRY_DEFAULT_JITTER_PERCENT
+
+#ifndef RETRY_DEFAULT_ERR_CLASS
+#define RETRY_DEFAULT_ERR_CLASS     RETRY_ERR_CLASS_ALL
+#endif //RETRY_DEFAULT_ERR_CLASS
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Backoff between Attempts
+enum retry_backoff
+{
+    RETRY_BACKOFF_FIXED         = 0,    // delay, delay, delay, ...
+    RETRY_BACKOFF_EXPONENTIAL   = 1     // delay, delay*2, delay*4, ... (Max. delay_max_ms)
+};
+typedef enum retry_backoff retry_backoff_t;
+
+// Retry Policy
+struct retry_policy
+{
+    int attempt_count;              // Max. Attempts (0: Decided by Caller)
+    retry_backoff_t backoff;
+    unsigned int delay_ms;          // Delay before First Retry
+    unsigned int delay_max_ms;      // Max. Delay (Exponential Backoff)
+    unsigned int jitter_percent;    // Random Delay Adjustment, +/- (0~100)%
+    unsigned int deadline_ms;       // Overall Time Limit of One Transaction (0: No Limit)
+    unsigned int err_class;         // Error Classes to be Retried (RETRY_ERR_CLASS_*)
+};
+
+// Retry Statistics
+struct retry_stats
+{
+    unsigned int transaction_count;
+    unsigned int attempt_count;
+    unsigned int retry_count;
+    unsigned int failure_count;
+    unsigned long delay_ms;         // Total Delay between Attempts
+};
+
+// Transaction (Command & Response) to be Retried
+typedef int (*retry_transaction)(void *p_context);
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Retry Policy
+int parse_retry_policy(const char *p_policy_string);
+void show_retry_policy_format(void);
+
+// Retry
+int run_with_retry(const char *p_name, int attempt_count, retry_transaction transaction, void *p_context);
+
+// Retry Statistics
+void get_retry_stats(struct retry_stats *p_retry_stats);
+void show_retry_stats(void);
+
+#endif //__ELAN_TS_RETRY_UTILITY_H__
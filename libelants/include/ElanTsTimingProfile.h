@@ -0,0 +1,122 @@
+/** @file
+
+  Header of Timing Profile for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsTimingProfile.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELAN_TS_TIMING_PROFILE_H__
+#define __ELAN_TS_TIMING_PROFILE_H__
+#pragma once
+
+#include <stddef.h>
+#include "ElanTsDebug.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Default Waits before Response (Conservative, Used for Unknown Devices)
+#ifndef ELAN_FLASH_WRITE_PAGE_WAIT_MS
+#define ELAN_FLASH_WRITE_PAGE_WAIT_MS           15      // Gen5/6/7: 1 Page
+#endif //ELAN_FLASH_WRITE_PAGE_WAIT_MS
+
+#ifndef ELAN_FLASH_WRITE_PAGE_BLOCK_WAIT_MS
+#define ELAN_FLASH_WRITE_PAGE_BLOCK_WAIT_MS     360     // Gen5/6/7: 12ms * 30 Pages
+#endif //ELAN_FLASH_WRITE_PAGE_BLOCK_WAIT_MS
+
+#ifndef ELAN_GEN8_FLASH_WRITE_PAGE_WAIT_MS
+#define ELAN_GEN8_FLASH_WRITE_PAGE_WAIT_MS      15      // Gen8: 7ms per eKTL Page
+#endif //ELAN_GEN8_FLASH_WRITE_PAGE_WAIT_MS
+
+#ifndef ELAN_GEN8_ERASE_FLASH_WAIT_MS
+#define ELAN_GEN8_ERASE_FLASH_WAIT_MS           500     // Gen8: 101ms per 32 Pages, Max. 404ms
+#endif //ELAN_GEN8_ERASE_FLASH_WAIT_MS
+
+// Max. Number of Profile Entries (Device & Item) in Profile File
+#ifndef TIMING_PROFILE_ENTRY_COUNT_MAX
+#define TIMING_PROFILE_ENTRY_COUNT_MAX          128
+#endif //TIMING_PROFILE_ENTRY_COUNT_MAX
+
+// Number of Latest Samples Kept per Entry
+#ifndef TIMING_SAMPLE_COUNT_MAX
+#define TIMING_SAMPLE_COUNT_MAX                 16
+#endif //TIMING_SAMPLE_COUNT_MAX
+
+// Min. Number of Samples before Learned Wait is Used
+#ifndef TIMING_SAMPLE_COUNT_MIN
+#define TIMING_SAMPLE_COUNT_MIN                 3
+#endif //TIMING_SAMPLE_COUNT_MIN
+
+// Learned Wait: Percentile of Samples, less Margin (Response is still Awaited with Full Read Timeout)
+#ifndef TIMING_WAIT_PERCENTILE
+#define TIMING_WAIT_PERCENTILE                  10
+#endif //TIMING_WAIT_PERCENTILE
+
+#ifndef TIMING_WAIT_MARGIN_PERCENT
+#define TIMING_WAIT_MARGIN_PERCENT              20
+#endif //TIMING_WAIT_MARGIN_PERCENT
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Timing Items
+enum timing_item
+{
+    TIMING_ITEM_FLASH_WRITE_PAGE = 0,
+    TIMING_ITEM_FLASH_WRITE_PAGE_BLOCK,
+    TIMING_ITEM_GEN8_FLASH_WRITE_PAGE,
+    TIMING_ITEM_GEN8_ERASE_32_PAGES,        // 1~32 Pages
+    TIMING_ITEM_GEN8_ERASE_64_PAGES,        // 33~64 Pages
+    TIMING_ITEM_GEN8_ERASE_96_PAGES,        // 65~96 Pages
+    TIMING_ITEM_GEN8_ERASE_132_PAGES,       // 97~ Pages
+    TIMING_ITEM_COUNT
+};
+typedef enum timing_item timing_item_t;
+
+// Device Key of Profile
+struct timing_device_key
+{
+    unsigned int vid;
+    unsigned int pid;
+    unsigned int bc_version;
+    unsigned int bus_type;
+};
+
+// Receive Response of Command Already Sent
+typedef int (*timing_response_receiver)(void);
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Extern Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Profile File
+int load_timing_profile(const char *p_profile_path, const struct timing_device_key *p_device_key);
+int save_timing_profile(void);
+
+// Timing Item
+timing_item_t get_gen8_erase_timing_item(unsigned short page_count);
+unsigned int get_timing_wait_ms(timing_item_t item);
+
+// Response
+int wait_for_response(timing_item_t item, timing_response_receiver receive_response);
+
+#endif //__ELAN_TS_TIMING_PROFILE_H__
@@ -51,6 +51,11 @@
 #define ERR_DATA_MISMATCHED                     0x000A
 #endif //ERR_DATA_MISMATCHED
 
+/** Fail to Allocate Memory **/
+#ifndef ERR_NO_MEMORY
+#define ERR_NO_MEMORY                           0x000B
+#endif //ERR_NO_MEMORY
+
 /** Connect Elan Bridge and not get hello packet **/
 #ifndef ERR_CONNECT_NO_HELLO_PACKET
 #define ERR_CONNECT_NO_HELLO_PACKET             0x0102
@@ -76,6 +81,11 @@
 #define ERR_FILE_IO_ERROR                       0x0107
 #endif //ERR_FILE_IO_ERROR
 
+/** Device is Busy (Locked by Other Process) **/
+#ifndef ERR_DEVICE_BUSY
+#define ERR_DEVICE_BUSY                         0x0108
+#endif //ERR_DEVICE_BUSY
+
 /** Unknown Device Type **/
 #ifndef ERR_UNKNOWN_DEVICE_TYPE
 #define ERR_UNKNOWN_DEVICE_TYPE                 0x010f
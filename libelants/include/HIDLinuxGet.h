@@ -30,6 +30,34 @@
 // Definitions
 //////////////////////////////////////////////////////////////////////
 
+// Device Lock Mode (Advisory flock on Lock File of Device, Keyed by Its Physical Location, Honored by All Tool Processes)
+#ifndef HID_DEVICE_LOCK_NONE
+#define HID_DEVICE_LOCK_NONE            0
+#endif //HID_DEVICE_LOCK_NONE
+
+#ifndef HID_DEVICE_LOCK_SHARED
+#define HID_DEVICE_LOCK_SHARED          1   // Shared Holders (No Command Sent)
+#endif //HID_DEVICE_LOCK_SHARED
+
+#ifndef HID_DEVICE_LOCK_EXCLUSIVE
+#define HID_DEVICE_LOCK_EXCLUSIVE       2   // Command Session
+#endif //HID_DEVICE_LOCK_EXCLUSIVE
+
+// Max. Wait for Device Lock Held by Other Process
+#ifndef HID_DEVICE_LOCK_WAIT_MSEC
+#define HID_DEVICE_LOCK_WAIT_MSEC       30000
+#endif //HID_DEVICE_LOCK_WAIT_MSEC
+
+// Polling Interval of Device Lock
+#ifndef HID_DEVICE_LOCK_POLL_MSEC
+#define HID_DEVICE_LOCK_POLL_MSEC       10
+#endif //HID_DEVICE_LOCK_POLL_MSEC
+
+// Directory of Device Lock Files ("elants_hid_<phys>.lock")
+#ifndef HID_DEVICE_LOCK_DIR
+#define HID_DEVICE_LOCK_DIR             "/run/lock"
+#endif //HID_DEVICE_LOCK_DIR
+
 /////////////////////////////////////////////////////////////////////////////
 // CHIDLinuxGet Class
 
@@ -46,9 +74,14 @@ public:
 
     // Basic Functions
     int GetDeviceHandle(int nVID, int nPID);
+    int GetDeviceHandleByPath(const char *pszDevicePath, int nVID, int nPID);
     void Close(void);
     bool IsConnected(void);
 
+    // Cross-process Device Lock
+    int LockDevice(int nLockMode, int nTimeout = HID_DEVICE_LOCK_WAIT_MSEC);
+    void UnlockDevice(void);
+
     // TP Command / Data Access Functions
     int WriteCommand(unsigned char* pszCommandBuf, int nCommandLen, int nTimeout = ELAN_WRITE_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
     int ReadData(unsigned char* pszDataBuf, int nDataLen, int nTimeout = ELAN_READ_DATA_TIMEOUT_MSEC, int nDevIdx = 0, bool bFilter = true);
@@ -56,21 +89,31 @@ public:
     // Raw Data Access Functions
     int WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout = ELAN_WRITE_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
     int ReadRawBytes(unsigned char* pszBuf, int nLen, int nTimeout = ELAN_READ_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
+    int ReadReport(unsigned char* pszBuf, int nBufLen, int* pnReportLen, int nTimeout = ELAN_READ_DATA_TIMEOUT_MSEC);
 
     // Buffer Size Info.
     int GetInBufferSize(void);
     int GetOutBufferSize(void);
 
+    // Output Report ID of Bridge Command
+    unsigned char GetOutputReportId(void);
+
     // PID
     int GetDevVidPid(unsigned int* p_nVid, unsigned int* p_nPid, int nDevIdx = 0);
 
     // Bus Type
     int GetDevBusType(unsigned int* p_uiBusType, int nDevIdx = 0);
 
+    // Device Path
+    int GetDevicePath(char *pszDevicePath, size_t nDevicePathBufLen);
+
 protected:
     // Find HIDRaw Device
     int FindHidrawDevice(int nVID, int nPID, char *pszDevicePath, size_t nDevicePathBufLen);
 
+    // Stable Identity of Device for Lock File (Survives Reconnect)
+    void GetDeviceLockName(char *pszLockName, size_t nLockNameBufLen);
+
     // Bus Info.
     const char* bus_str(int bus);
     unsigned int m_uiBusType;
@@ -85,8 +128,14 @@ protected:
 
     // HIDRaw Device
     int m_nHidrawFd;
+    char m_szHidrawDevPath[MAX_PATH];
     fd_set m_fdsHidraw;
 
+    // Device Lock (Held across Close() & Reconnect, until UnlockDevice())
+    int m_nLockFd;
+    int m_nLockMode;
+    char m_szLockPath[MAX_PATH];
+
     // I/O Mutex
     sem_t m_ioMutex;
 
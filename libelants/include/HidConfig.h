@@ -122,6 +122,11 @@
 #define ELAN_HID_READ_PAGE_FRAME_SIZE    0x3C /* 63 - 1(Packet Header 0x99) - 1(Packet Index) -1(Data Length) = 60 Byte */
 #endif //ELAN_HID_READ_PAGE_FRAME_SIZE
 
+// ELAN HID Max. Frame Count of One Bulk Read
+#ifndef ELAN_HID_READ_FRAME_COUNT_MAX
+#define ELAN_HID_READ_FRAME_COUNT_MAX    256 /* Packet Index is 1 Byte */
+#endif //ELAN_HID_READ_FRAME_COUNT_MAX
+
 /*
  * Bridge Commands
  */
@@ -0,0 +1,111 @@
+/** @file
+
+  C API of libelants for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	elants.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef __ELANTS_H__
+#define __ELANTS_H__
+
+#include "ErrCode.h"    /* Return Codes (ERR_SUCCESS on Success) */
+
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+/*              API Version                                                     *
+ *                                                                              *
+ *    Minor Version Adds Functions Only. Major Version Changes Existing         *
+ *    Functions or Structures, and is the soname of Shared Library              *
+ *    (libelants.so.<major>).                                                   *
+ */
+#ifndef ELANTS_API_VERSION_MAJOR
+#define ELANTS_API_VERSION_MAJOR        1
+#endif //ELANTS_API_VERSION_MAJOR
+
+#ifndef ELANTS_API_VERSION_MINOR
+#define ELANTS_API_VERSION_MINOR        0
+#endif //ELANTS_API_VERSION_MINOR
+
+#ifndef ELANTS_API_VERSION
+#define ELANTS_API_VERSION              (((ELANTS_API_VERSION_MAJOR) << 16) | (ELANTS_API_VERSION_MINOR))
+#endif //ELANTS_API_VERSION
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Device Handle (One Open Device per Process)
+typedef struct elants_device elants_device_t;
+
+// Touch State (Detected at Open, after FW Update & Reconnect)
+struct elants_touch_state
+{
+    unsigned char hello_packet;
+    unsigned short bc_version;      // BC Version (Recovery Mode: from Hello Packet Query; Normal Mode: from Main Code)
+    int gen8_touch;                 // Non-zero if Gen8 Touch
+    int recovery;                   // Non-zero if Recovery Mode
+};
+
+// Firmware Information (Normal Mode)
+struct elants_fw_info
+{
+    unsigned short fw_id;
+    unsigned short fw_version;
+    unsigned short test_version;
+    unsigned short bc_version;
+};
+
+// Calibration Result
+struct elants_calibration_result
+{
+    unsigned long duration_ms;      // Re-Calibration Command Sent to Completion Report
+    unsigned short rek_counter;     // Calibration Counter Read after Completion
+};
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+// Version & Debug
+unsigned int elants_get_api_version(void);
+void elants_set_debug(int enable);
+
+// Device
+int elants_open(unsigned short pid, int lock_wait_ms, elants_device_t **pp_device);
+int elants_close(elants_device_t *p_device);
+int elants_reconnect(elants_device_t *p_device, int timeout_ms);
+int elants_get_touch_state(elants_device_t *p_device, struct elants_touch_state *p_touch_state);
+
+// Information
+int elants_get_fw_info(elants_device_t *p_device, struct elants_fw_info *p_fw_info);
+int elants_read_info_fwid(elants_device_t *p_device, unsigned short *p_info_fwid);
+int elants_get_rek_counter(elants_device_t *p_device, unsigned short *p_rek_counter);
+
+// Calibration
+int elants_calibrate(elants_device_t *p_device, struct elants_calibration_result *p_calibration_result);
+
+// Firmware Update (verify: Non-zero to Read Flash back and Compare with Firmware File;
+// ERR_FUNC_NOT_SUPPORT before Flash is Touched if the Image can not be Read Back, e.g. Gen8 Main Code)
+// (p_firmware_path may be a compressed image, or a bundle whose image is selected by information FWID of the device.)
+int elants_update_firmware(elants_device_t *p_device, const char *p_firmware_path, int skip_action_code, int verify);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //__ELANTS_H__
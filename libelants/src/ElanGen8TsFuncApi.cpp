@@ -17,11 +17,17 @@
 #include "ElanGen8TsHidUtility.h"
 #include "ElanGen8TsFwFileIoUtility.h"
 #include "ElanGen8TsFuncApi.h"
+#include "ElanTsRetryUtility.h"
+#include "ElanTsTimingProfile.h"
 
 /***************************************************
  * Global Variable Declaration
  ***************************************************/
 
+// Information Page Cache (Valid until Switching to Boot Code)
+static unsigned char g_gen8_info_page_cache[ELAN_GEN8_MEMORY_PAGE_SIZE] = {0};
+static bool g_gen8_info_page_cache_valid = false;
+
 /***************************************************
  * Function Implements
  ***************************************************/
@@ -60,6 +66,9 @@ int gen8_switch_to_boot_code(bool recovery)
 {
     int err = ERR_SUCCESS;
 
+    // Flash may be Rewritten from Here
+    gen8_invalidate_info_page_cache();
+
     // Enter IAP Mode
     if(recovery == false) // Normal IAP
     {
@@ -154,10 +163,8 @@ int erase_flash_section(unsigned int address, unsigned short page_count)
      *						  404ms		97~132 Pages.
      * Therefore just wait 500ms to be on the safe side.
      */
-    usleep(500 * 1000); // wait 500ms
-
-    // Receive Response of Erase Flash Section
-    err = receive_erase_flash_section_response();
+    // Wait (500ms, or Learned from Timing Profile) & Receive Response of Erase Flash Section
+    err = wait_for_response(get_gen8_erase_timing_item(page_count), receive_erase_flash_section_response);
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Receive Response of Erase Flash Section! err=%d.\r\n", __func__, err);
@@ -178,7 +185,8 @@ int erase_flash(void)
     unsigned int erase_section_index = 0,
                  erase_section_address = 0;
     unsigned short erase_section_page_count = 0;
-    struct erase_script EraseScript;
+    struct erase_script EraseScript,
+                        ErasePlan;
 
     // Initialize Erase Script
     memset(&EraseScript, 0, sizeof(struct erase_script));
@@ -191,6 +199,15 @@ int erase_flash(void)
         goto ERASE_FLASH_EXIT;
     }
 
+    // Coalesce Erase Sections into Fewest Erase Commands
+    err = plan_ektl_erase_script(&EraseScript, ELAN_GEN8_ERASE_PAGE_COUNT_MAX, &ErasePlan, sizeof(struct erase_script));
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Plan Erase Script! err=0x%x.\r\n", __func__, err);
+        goto ERASE_FLASH_EXIT;
+    }
+    memcpy(&EraseScript, &ErasePlan, sizeof(struct erase_script));
+
     // Erase Flash Sections
     for(erase_section_index = 0; erase_section_index < EraseScript.nEraseSectionCount; erase_section_index++)
     {
@@ -238,8 +255,6 @@ int create_ektl_fw_page(unsigned int mem_page_address, unsigned char *p_ektl_fw_
 {
     int err = ERR_SUCCESS;
     unsigned int  data_index = 0,
-                  page_data = 0,
-                  page_data_index = 0,
                   page_data_checksum = 0;
     unsigned char ektl_fw_page_buf[ELAN_EKTL_FW_PAGE_SIZE] = {0};
 
@@ -282,14 +297,7 @@ int create_ektl_fw_page(unsigned int mem_page_address, unsigned char *p_ektl_fw_
                  ektl_fw_page_buf[8], ektl_fw_page_buf[9], ektl_fw_page_buf[10], ektl_fw_page_buf[11]);
 
     // Calculate Checksum
-    for(page_data_index = 0; page_data_index < (4 /* address */ + ELAN_EKTL_FW_PAGE_DATA_SIZE); page_data_index += 4)
-    {
-        // Get Page Data
-        page_data = FOUR_BYTE_ARRAY_TO_UINT(&ektl_fw_page_buf[page_data_index]);
-
-        // Update Checksum
-        page_data_checksum += page_data;
-    }
+    page_data_checksum = compute_ektl_page_checksum(ektl_fw_page_buf, 4 /* address */ + ELAN_EKTL_FW_PAGE_DATA_SIZE);
     //DEBUG_PRINTF("%s: Checksum=0x%08x.\r\n", __func__, page_data_checksum);
 
     // Checksum
@@ -378,10 +386,8 @@ int write_ektl_fw_page(unsigned char *p_ektl_fw_page_buf, size_t ektl_fw_page_bu
      * With the information from Boot Code Team, it takes 7ms for touch to process after receiving firmware page data.
      * Thus it should work to remain waiting time of 15ms.
      */
-    usleep(15 * 1000); // wait 15ms
-
-    // Receive Response of Flash Write
-    err = receive_flash_write_response();
+    // Wait (15ms, or Learned from Timing Profile) & Receive Response of Flash Write
+    err = wait_for_response(TIMING_ITEM_GEN8_FLASH_WRITE_PAGE, receive_flash_write_response);
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Receive Flash Write! err=0x%x.\r\n", __func__, err);
@@ -437,14 +443,60 @@ GEN8_GET_ROM_DATA_EXIT:
     return err;
 }
 
+// Remark ID Region:
+// Read Remark ID Index & All Address Sets with One Bulk Read (Normal Mode Only)
+static int gen8_read_remark_id_region(unsigned char *p_region_buf, size_t region_buf_size)
+{
+    int err = ERR_SUCCESS;
+
+    // Enter Test Mode
+    err = send_enter_test_mode_command();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Enter Test Mode! err=0x%x.\r\n", __func__, err);
+        goto GEN8_READ_REMARK_ID_REGION_EXIT;
+    }
+
+    // Read Remark ID Region
+    err = gen8_read_memory_block((unsigned short)(ELAN_GEN8_REMARK_ID_INDEX_ADDR - ELAN_GEN8_INFO_ROM_MEMORY_ADDR), ELAN_GEN8_REMARK_ID_REGION_SIZE, \
+                                 p_region_buf, region_buf_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Read Remark ID Region! err=0x%x.\r\n", __func__, err);
+        goto GEN8_READ_REMARK_ID_REGION_EXIT_1;
+    }
+
+    // Leave Test Mode
+    err = send_exit_test_mode_command();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Leave Test Mode! err=0x%x.\r\n", __func__, err);
+        goto GEN8_READ_REMARK_ID_REGION_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+GEN8_READ_REMARK_ID_REGION_EXIT:
+    return err;
+
+GEN8_READ_REMARK_ID_REGION_EXIT_1:
+    // Leave Test Mode
+    send_exit_test_mode_command();
+
+    return err;
+}
+
 // Remark ID
 int gen8_read_remark_id(unsigned char *p_gen8_remark_id_buf, size_t gen8_remark_id_buf_size, bool recovery)
 {
     int err = ERR_SUCCESS;
     unsigned char gen8_remark_id_data[ELAN_GEN8_REMARK_ID_LEN] = {0},
+                  gen8_remark_id_region[ELAN_GEN8_REMARK_ID_REGION_SIZE] = {0},
                   gen8_remark_id_index = 0,
                   gen8_remark_id_address_set_index = 0,
                   data_index = 0;
+    bool region_valid = false;
     unsigned int rom_data = 0,
                  gen8_remark_id_address = 0,
                  gen8_remark_id_data_address = 0,
@@ -464,17 +516,38 @@ int gen8_read_remark_id(unsigned char *p_gen8_remark_id_buf, size_t gen8_remark_
         goto GEN8_READ_REMARK_ID_EXIT;
     }
 
+    /*
+     * Remark ID Region
+     */
+
+    // Normal Mode: One Bulk Read instead of 1 + 16 ROM Data Commands, Fall back to ROM Data Command on Error
+    if(!recovery)
+    {
+        err = gen8_read_remark_id_region(gen8_remark_id_region, sizeof(gen8_remark_id_region));
+        if(err == ERR_SUCCESS)
+            region_valid = true;
+        else
+            DEBUG_PRINTF("%s: Fail to Read Remark ID Region (err=0x%x), Read by Byte.\r\n", __func__, err);
+    }
+
     /*
      * Remark ID Index
      */
 
-    // Read ROM Data from Remark ID Index Address (0x00042200)
-    err = gen8_get_rom_data(ELAN_GEN8_REMARK_ID_INDEX_ADDR, 1, &rom_data); // Byte Data / 8-bit
-    if(err != ERR_SUCCESS)
+    if(region_valid)
     {
-        ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
-                     __func__, ELAN_GEN8_REMARK_ID_INDEX_ADDR, err);
-        goto GEN8_READ_REMARK_ID_EXIT;
+        rom_data = gen8_remark_id_region[0];
+    }
+    else
+    {
+        // Read ROM Data from Remark ID Index Address (0x00042200)
+        err = gen8_get_rom_data(ELAN_GEN8_REMARK_ID_INDEX_ADDR, 1, &rom_data); // Byte Data / 8-bit
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
+                         __func__, ELAN_GEN8_REMARK_ID_INDEX_ADDR, err);
+            goto GEN8_READ_REMARK_ID_EXIT;
+        }
     }
 
     // 2's Complement of ROM Data
@@ -482,6 +555,16 @@ int gen8_read_remark_id(unsigned char *p_gen8_remark_id_buf, size_t gen8_remark_
     gen8_remark_id_address_set_index = 0xFF - LOW_BYTE_OF_UINT(rom_data);
     DEBUG_PRINTF("%s: Gen8 Address Set %d.\r\n", __func__, gen8_remark_id_address_set_index);
 
+    // Address Set Index: 1 ~ 7 (0 if Index Byte is Blank)
+    if((gen8_remark_id_address_set_index == 0) || \
+       (gen8_remark_id_address_set_index > (sizeof(gen8_remark_id_address_set) / sizeof(gen8_remark_id_address_set[0]))))
+    {
+        ERROR_PRINTF("%s: Invalid Gen8 Remark ID Address Set %d (MEM[0x%08x]=0x%02x)!\r\n", \
+                     __func__, gen8_remark_id_address_set_index, ELAN_GEN8_REMARK_ID_INDEX_ADDR, LOW_BYTE_OF_UINT(rom_data));
+        err = ERR_DATA_PATTERN;
+        goto GEN8_READ_REMARK_ID_EXIT;
+    }
+
     /*
      * Remark ID Data
      */
@@ -504,6 +587,12 @@ int gen8_read_remark_id(unsigned char *p_gen8_remark_id_buf, size_t gen8_remark_
         gen8_remark_id_data_address = gen8_remark_id_address + (4 * data_index);
         rom_data = 0;
 
+        if(region_valid)
+        {
+            gen8_remark_id_data[data_index] = gen8_remark_id_region[gen8_remark_id_data_address - ELAN_GEN8_REMARK_ID_INDEX_ADDR];
+            continue;
+        }
+
         err = gen8_get_rom_data(gen8_remark_id_data_address, 1, &rom_data); // Byte Data / 8-bit
         if(err != ERR_SUCCESS)
         {
@@ -533,6 +622,87 @@ GEN8_READ_REMARK_ID_EXIT:
     return err;
 }
 
+// Information FWID
+int gen8_read_info_fwid(unsigned short *p_info_fwid, bool recovery)
+{
+    int err = ERR_SUCCESS;
+    unsigned char info_fwid_low_byte = 0,
+                  info_fwid_high_byte = 0;
+    unsigned short info_fwid = 0;
+    unsigned int rom_data = 0;
+
+    // Check if Parameter Invalid
+    if (p_info_fwid == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_info_fwid=0x%p)\r\n", __func__, p_info_fwid);
+        err = ERR_INVALID_PARAM;
+        goto GEN8_READ_INFO_FWID_EXIT;
+    }
+
+    // Read ROM Data from Information ROM Address (0x40000)
+    if(!recovery) // Normal Mode
+    {
+        /*
+         * Touch firmware supports Read  8-bit RAM/ROM Data Command,
+         *                         Read 16-bit RAM/ROM Data Command, and
+         *                         Read 32-bit RAM/ROM Data Command.
+         */
+
+        err = gen8_get_rom_data(ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, 2, &rom_data); // Word Data / 16-bit
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
+                         __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, err);
+            goto GEN8_READ_INFO_FWID_EXIT;
+        }
+
+        // Get Low Word (16-bit) of ROM Data
+        info_fwid = LOW_WORD_OF_UINT(rom_data);
+        DEBUG_PRINTF("%s: Information FWID: 0x%04x.\r\n", __func__, info_fwid);
+    }
+    else // Recovery Mode
+    {
+        /*
+         * Touch boot code only supports Read 8-bit RAM/ROM Data Command.
+         */
+
+        // Low Byte of Information FWID
+        err = gen8_get_rom_data(ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, 1, &rom_data); // Byte Data / 8-bit
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
+                         __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, err);
+            goto GEN8_READ_INFO_FWID_EXIT;
+        }
+        info_fwid_low_byte = LOW_BYTE_OF_UINT(rom_data);
+        DEBUG_PRINTF("%s: MEM[0x%08x]=0x%02x.\r\n", __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, info_fwid_low_byte);
+
+        // High Byte of Information FWID
+        err = gen8_get_rom_data((ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR + 1), 1, &rom_data); // Byte Data / 8-bit
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
+                         __func__, (ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR + 1), err);
+            goto GEN8_READ_INFO_FWID_EXIT;
+        }
+        info_fwid_high_byte = LOW_BYTE_OF_UINT(rom_data);
+        DEBUG_PRINTF("%s: MEM[0x%08x]=0x%02x.\r\n", __func__, (ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR + 1), info_fwid_high_byte);
+
+        // Get Low Word (16-bit) of ROM Data
+        info_fwid = ((unsigned short)info_fwid_high_byte << 8) | (unsigned short)info_fwid_low_byte;
+        DEBUG_PRINTF("%s: Information FWID: 0x%04x.\r\n", __func__, info_fwid);
+    }
+
+    // Load Information FWID to Input Buffer
+    *p_info_fwid = info_fwid;
+
+    // Success
+    err = ERR_SUCCESS;
+
+GEN8_READ_INFO_FWID_EXIT:
+    return err;
+}
+
 // Page Data
 int gen8_read_memory_page(unsigned short mem_page_address, unsigned short mem_page_size, unsigned char *p_mem_page_buf, size_t mem_page_buf_size)
 {
@@ -633,6 +803,42 @@ GEN8_READ_MEMORY_PAGE_EXIT:
     return err;
 }
 
+int gen8_read_memory_block(unsigned short mem_block_address, unsigned int mem_block_size, unsigned char *p_mem_block_buf, size_t mem_block_buf_size)
+{
+    int err = ERR_SUCCESS;
+
+    // Validate Input Parameter (Length of Bulk Read Command is in Byte for Non-SLOC Gen8 IC)
+    if((p_mem_block_buf == NULL) || (mem_block_size == 0) || (mem_block_size > 0xFFFF) || (mem_block_buf_size < mem_block_size))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_mem_block_buf=0x%p, mem_block_size=%u, mem_block_buf_size=%ld)\r\n", \
+                     __func__, p_mem_block_buf, mem_block_size, mem_block_buf_size);
+        err = ERR_INVALID_PARAM;
+        goto GEN8_READ_MEMORY_BLOCK_EXIT;
+    }
+
+    // Send Show Bulk ROM Data Command
+    err = send_show_bulk_rom_data_command(mem_block_address, (unsigned short)mem_block_size /* unit: byte */);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Send Gen8 Show Bulk ROM Data Command! err=0x%x.\r\n", __func__, err);
+        goto GEN8_READ_MEMORY_BLOCK_EXIT;
+    }
+
+    // Receive Block Data
+    err = receive_bulk_rom_frames(mem_block_size, p_mem_block_buf, mem_block_buf_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Receive Block Data (addr=0x%04x)! err=0x%x.\r\n", __func__, mem_block_address, err);
+        goto GEN8_READ_MEMORY_BLOCK_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+GEN8_READ_MEMORY_BLOCK_EXIT:
+    return err;
+}
+
 // Information Page
 int gen8_get_info_page(unsigned char *p_info_page_buf, size_t info_page_buf_size)
 {
@@ -664,6 +870,14 @@ int gen8_get_info_page(unsigned char *p_info_page_buf, size_t info_page_buf_size
     // Read Information Memory Page
     //
 
+    // Information Page Already Read in This Session
+    if(g_gen8_info_page_cache_valid)
+    {
+        memcpy(p_info_page_buf, g_gen8_info_page_cache, sizeof(g_gen8_info_page_cache));
+        err = ERR_SUCCESS;
+        goto GEN8_GET_INFO_PAGE_EXIT;
+    }
+
     // Enter Test Mode
     err = send_enter_test_mode_command();
     if(err != ERR_SUCCESS)
@@ -672,9 +886,14 @@ int gen8_get_info_page(unsigned char *p_info_page_buf, size_t info_page_buf_size
         goto GEN8_GET_INFO_PAGE_EXIT;
     }
 
-    // Read Information Page
+    // Read Information Page (Bulk Frames without Fixed Delay, Fall back to Page Read on Error)
     gen8_mem_addr_offset = ELAN_GEN8_INFO_MEMORY_PAGE_3_ADDR - ELAN_GEN8_INFO_ROM_MEMORY_ADDR;
-    err = gen8_read_memory_page(gen8_mem_addr_offset, ELAN_GEN8_MEMORY_PAGE_SIZE, gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf));
+    err = gen8_read_memory_block(gen8_mem_addr_offset, ELAN_GEN8_MEMORY_PAGE_SIZE, gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf));
+    if(err != ERR_SUCCESS)
+    {
+        DEBUG_PRINTF("%s: Fail to Read Information Page Block (err=0x%x), Read by Page.\r\n", __func__, err);
+        err = gen8_read_memory_page(gen8_mem_addr_offset, ELAN_GEN8_MEMORY_PAGE_SIZE, gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf));
+    }
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
@@ -692,6 +911,10 @@ int gen8_get_info_page(unsigned char *p_info_page_buf, size_t info_page_buf_size
     // Load Information Page Data to Input Buffer
     memcpy(p_info_page_buf, gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf));
 
+    // Keep Information Page for Later Access in This Session
+    memcpy(g_gen8_info_page_cache, gen8_info_mem_page_buf, sizeof(g_gen8_info_page_cache));
+    g_gen8_info_page_cache_valid = true;
+
     // Success
     err = ERR_SUCCESS;
 
@@ -705,10 +928,83 @@ GEN8_GET_INFO_PAGE_EXIT_1:
     return err;
 }
 
+void gen8_invalidate_info_page_cache(void)
+{
+    g_gen8_info_page_cache_valid = false;
+    return;
+}
+
+// Update Info.:
+// Take Update Counter & Last Update Time from Information Page Cache if Available,
+// Otherwise Read only These Fields (36 Bytes), instead of Whole 2KB Information Page.
+int gen8_read_update_info(struct update_info *p_update_info, size_t update_info_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned char gen8_info_mem_page_buf[ELAN_GEN8_MEMORY_PAGE_SIZE] = {0};
+    const unsigned int data_index = ELAN_GEN8_UPDATE_COUNTER_ADDR - ELAN_GEN8_INFO_MEMORY_PAGE_3_ADDR;
+
+    // Update Info. & Update Info. Size
+    if((p_update_info == NULL) || (update_info_size < sizeof(struct update_info)))
+    {
+        ERROR_PRINTF("%s: Invalid Update Info.! (p_update_info=0x%p, update_info_size=%ld)\r\n", \
+                     __func__, p_update_info, update_info_size);
+        err = ERR_INVALID_PARAM;
+        goto GEN8_READ_UPDATE_INFO_EXIT;
+    }
+
+    if(g_gen8_info_page_cache_valid)
+    {
+        memcpy(gen8_info_mem_page_buf, g_gen8_info_page_cache, sizeof(gen8_info_mem_page_buf));
+    }
+    else
+    {
+        // Enter Test Mode
+        err = send_enter_test_mode_command();
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Enter Test Mode! err=0x%x.\r\n", __func__, err);
+            goto GEN8_READ_UPDATE_INFO_EXIT;
+        }
+
+        // Read Update Info. Fields into Their Place of Information Page
+        err = gen8_read_memory_block((unsigned short)(ELAN_GEN8_UPDATE_COUNTER_ADDR - ELAN_GEN8_INFO_ROM_MEMORY_ADDR), ELAN_GEN8_UPDATE_INFO_SIZE, \
+                                     &gen8_info_mem_page_buf[data_index], sizeof(gen8_info_mem_page_buf) - data_index);
+
+        // Leave Test Mode
+        send_exit_test_mode_command();
+
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Read Update Information! err=0x%x.\r\n", __func__, err);
+            goto GEN8_READ_UPDATE_INFO_EXIT;
+        }
+    }
+
+    // Parse Update Info.
+    err = gen8_get_update_info(gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf), p_update_info, update_info_size);
+
+GEN8_READ_UPDATE_INFO_EXIT:
+    return err;
+}
+
+// Transaction Adapter of Retry Engine
+struct gen8_info_page_context
+{
+    unsigned char *p_info_page_buf;
+    size_t info_page_buf_size;
+};
+
+static int gen8_get_info_page_transaction(void *p_context)
+{
+    struct gen8_info_page_context *p_gen8_info_page_context = (struct gen8_info_page_context *)p_context;
+
+    return gen8_get_info_page(p_gen8_info_page_context->p_info_page_buf, p_gen8_info_page_context->info_page_buf_size);
+}
+
 int gen8_get_info_page_with_error_retry(unsigned char *p_info_page_buf, size_t info_page_buf_size, int retry_count)
 {
-    int err = ERR_SUCCESS,
-        retry_index = 0;
+    int err = ERR_SUCCESS;
+    struct gen8_info_page_context gen8_info_page_context;
 
     //
     // Validate Arguments
@@ -730,38 +1026,12 @@ int gen8_get_info_page_with_error_retry(unsigned char *p_info_page_buf, size_t i
         goto GEN8_GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT;
     }
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
-
     //
     // Read Information Page
     //
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
-    {
-        err = gen8_get_info_page(p_info_page_buf, info_page_buf_size);
-        if(err == ERR_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
-
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Information Page! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
-            goto GEN8_GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
-
-            continue;
-        }
-    }
+    gen8_info_page_context.p_info_page_buf = p_info_page_buf;
+    gen8_info_page_context.info_page_buf_size = info_page_buf_size;
+    err = run_with_retry("Get Information Page", retry_count, gen8_get_info_page_transaction, &gen8_info_page_context);
 
 GEN8_GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT:
     return err;
@@ -1237,13 +1507,15 @@ int gen8_get_and_update_info_page(unsigned char *p_info_page_buf, size_t info_pa
     // Get Update Inforamtion
     //
 
-    // Get Information Memory Page Data
+    // Get Information Memory Page Data (Read from Flash, as It is Written back Later)
+    gen8_invalidate_info_page_cache();
     err = gen8_get_info_page_with_error_retry(gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf), ERROR_RETRY_COUNT);
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
         goto GEN8_GET_AND_UPDATE_INFO_PAGE_EXIT;
     }
+    gen8_invalidate_info_page_cache(); // Page is Updated & Written back, Cached Copy would be Stale
 
     // Initialize eKTL FW Information Page Data Buffer
     memcpy(ektl_fw_info_page_data_buf, gen8_info_mem_page_buf, sizeof(gen8_info_mem_page_buf));
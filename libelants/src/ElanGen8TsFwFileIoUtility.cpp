@@ -18,6 +18,11 @@
 #include <unistd.h>     /* close */
 #include <sys/stat.h>
 #include <sys/types.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_neon.h>
+#endif //__SSE2__
 #include "ErrCode.h"
 #include "ElanTsFwFileIoUtility.h"		// Inherit Variables & Functions from ElanTsFwFileIoUtility.h
 #include "ElanGen8TsFwFileIoUtility.h"
@@ -189,6 +194,175 @@ VALIDATE_EKTL_FW_EXIT:
     return err;
 }
 
+// eKTL Page Checksum:
+// Sum of Little-Endian 32-bit Words. 16 Bytes per Step with SIMD (SSE2 / NEON), Remaining Words in Scalar.
+unsigned int compute_ektl_page_checksum(const unsigned char *p_data, size_t data_size)
+{
+    unsigned int checksum = 0;
+    size_t data_index = 0;
+#if defined(__SSE2__)
+    __m128i lane_sum = _mm_setzero_si128();
+    unsigned int lane_value[4] = {0};
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    uint32x4_t lane_sum = vdupq_n_u32(0);
+#endif //__SSE2__
+
+    if(p_data == NULL)
+        return 0;
+
+#if defined(__SSE2__)
+    // 4 Lanes of 32-bit Sum (x86 is Little-Endian, Same as eKTL Page)
+    for(; (data_index + 16) <= data_size; data_index += 16)
+        lane_sum = _mm_add_epi32(lane_sum, _mm_loadu_si128((const __m128i *)&p_data[data_index]));
+    _mm_storeu_si128((__m128i *)lane_value, lane_sum);
+    checksum = lane_value[0] + lane_value[1] + lane_value[2] + lane_value[3];
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    // 4 Lanes of 32-bit Sum
+    for(; (data_index + 16) <= data_size; data_index += 16)
+        lane_sum = vaddq_u32(lane_sum, vreinterpretq_u32_u8(vld1q_u8(&p_data[data_index])));
+    checksum = vgetq_lane_u32(lane_sum, 0) + vgetq_lane_u32(lane_sum, 1) + vgetq_lane_u32(lane_sum, 2) + vgetq_lane_u32(lane_sum, 3);
+#endif //__SSE2__
+
+    // Remaining Words (or All Words without SIMD)
+    for(; (data_index + 4) <= data_size; data_index += 4)
+        checksum += FOUR_BYTE_ARRAY_TO_UINT(&p_data[data_index]);
+
+    return checksum;
+}
+
+// Validate eKTL FW Image:
+// Check Header Page, Erase Script and Address & Checksum of Every FW Page, before Flash is Erased.
+int validate_ektl_fw_image(void)
+{
+    int err = ERR_SUCCESS,
+        firmware_size = 0,
+        page_count = 0,
+        page_index = 0;
+    unsigned int header_length = 0,
+                 erase_section_count = 0,
+                 erase_section_index = 0,
+                 erase_section_address = 0,
+                 erase_section_page_count = 0,
+                 page_address = 0,
+                 page_checksum = 0;
+    unsigned char *p_firmware_data = NULL,
+                  *p_page = NULL;
+    bool page_erased = false;
+
+    // Map eKTL FW File
+    err = map_firmware_file(&p_firmware_data, &firmware_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Map Firmware File! err=0x%x.\r\n", __func__, err);
+        goto VALIDATE_EKTL_FW_IMAGE_EXIT;
+    }
+
+    // File Size: Header Page & at Least One FW Page, Whole Pages Only
+    page_count = firmware_size / ELAN_EKTL_FW_PAGE_SIZE;
+    if(((firmware_size % ELAN_EKTL_FW_PAGE_SIZE) != 0) || (page_count < 2))
+    {
+        ERROR_PRINTF("%s: Invalid eKTL FW Size (%d)!\r\n", __func__, firmware_size);
+        err = ERR_DATA_PATTERN;
+        goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+    }
+
+    //
+    // Header Page (Format: See validate_ektl_fw())
+    //
+    if((memcmp(&p_firmware_data[0], "header", 6) != 0) || \
+       (memcmp(&p_firmware_data[ELAN_EKTL_FW_PAGE_SIZE - 3], "eof", 3) != 0))
+    {
+        ERROR_PRINTF("%s: Invalid Header Title or End!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+    }
+
+    header_length = FOUR_BYTE_ARRAY_TO_UINT(&p_firmware_data[6]);
+    if(header_length != (ELAN_EKTL_FW_PAGE_SIZE - 6 /* sizeof(charArrayHeaderTitle) */) - 4 /* sizeof(nHeaderLength) */)
+    {
+        ERROR_PRINTF("%s: Invalid Header Length (%d)!\r\n", __func__, header_length);
+        err = ERR_DATA_PATTERN;
+        goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+    }
+
+    //
+    // Erase Script
+    //
+    erase_section_count = FOUR_BYTE_ARRAY_TO_UINT(&p_firmware_data[26]);
+    if((erase_section_count == 0) || (erase_section_count > MAX_HEADER_ERASE_SECTION_COUNT))
+    {
+        ERROR_PRINTF("%s: Invalid Erase Section Count (%u)!\r\n", __func__, erase_section_count);
+        err = ERR_DATA_PATTERN;
+        goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+    }
+
+    for(erase_section_index = 0; erase_section_index < erase_section_count; erase_section_index++)
+    {
+        erase_section_address    = FOUR_BYTE_ARRAY_TO_UINT(&p_firmware_data[30 + (erase_section_index * 8)]);
+        erase_section_page_count = FOUR_BYTE_ARRAY_TO_UINT(&p_firmware_data[34 + (erase_section_index * 8)]);
+
+        // Page Aligned, Page Count Fits Erase Command (16-bit), No Address Wrap-Around
+        if(((erase_section_address % ELAN_EKTL_FW_PAGE_DATA_SIZE) != 0) || \
+           (erase_section_page_count == 0) || (erase_section_page_count > 0xFFFF) || \
+           (erase_section_page_count > ((0xFFFFFFFF - erase_section_address) / ELAN_EKTL_FW_PAGE_DATA_SIZE)))
+        {
+            ERROR_PRINTF("%s: Invalid Erase_Section[%u] (address=0x%08x, page_count=%u)!\r\n", \
+                         __func__, erase_section_index, erase_section_address, erase_section_page_count);
+            err = ERR_DATA_PATTERN;
+            goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+        }
+    }
+
+    //
+    // FW Pages
+    //
+    for(page_index = 1; page_index < page_count; page_index++)
+    {
+        p_page = &p_firmware_data[page_index * ELAN_EKTL_FW_PAGE_SIZE];
+
+        // Address: Page Aligned & inside an Erase Section
+        page_address = FOUR_BYTE_ARRAY_TO_UINT(p_page);
+        page_erased = false;
+        for(erase_section_index = 0; erase_section_index < erase_section_count; erase_section_index++)
+        {
+            erase_section_address    = FOUR_BYTE_ARRAY_TO_UINT(&p_firmware_data[30 + (erase_section_index * 8)]);
+            erase_section_page_count = FOUR_BYTE_ARRAY_TO_UINT(&p_firmware_data[34 + (erase_section_index * 8)]);
+            if((page_address >= erase_section_address) && \
+               (((page_address - erase_section_address) / ELAN_EKTL_FW_PAGE_DATA_SIZE) < erase_section_page_count))
+            {
+                page_erased = true;
+                break;
+            }
+        }
+        if(((page_address % ELAN_EKTL_FW_PAGE_DATA_SIZE) != 0) || (page_erased == false))
+        {
+            ERROR_PRINTF("%s: Invalid Address of FW Page %d (0x%08x)!\r\n", __func__, page_index, page_address);
+            err = ERR_DATA_PATTERN;
+            goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+        }
+
+        // Checksum of Address & Data
+        page_checksum = compute_ektl_page_checksum(p_page, 4 /* address */ + ELAN_EKTL_FW_PAGE_DATA_SIZE);
+        if(page_checksum != FOUR_BYTE_ARRAY_TO_UINT(&p_page[4 + ELAN_EKTL_FW_PAGE_DATA_SIZE]))
+        {
+            ERROR_PRINTF("%s: Checksum Mismatched in FW Page %d (address=0x%08x, checksum=0x%08x, expected=0x%08x)!\r\n", \
+                         __func__, page_index, page_address, FOUR_BYTE_ARRAY_TO_UINT(&p_page[4 + ELAN_EKTL_FW_PAGE_DATA_SIZE]), page_checksum);
+            err = ERR_DATA_PATTERN;
+            goto VALIDATE_EKTL_FW_IMAGE_EXIT_1;
+        }
+    }
+    DEBUG_PRINTF("%s: eKTL FW Image Valid (%d Erase Sections, %d FW Pages).\r\n", __func__, erase_section_count, page_count - 1);
+
+    // Success
+    err = ERR_SUCCESS;
+
+VALIDATE_EKTL_FW_IMAGE_EXIT_1:
+    unmap_firmware_file(p_firmware_data, firmware_size);
+
+VALIDATE_EKTL_FW_IMAGE_EXIT:
+    return err;
+}
+
 // Get eKTL Erase Script
 // Get Header Page from eKTL FW File & Get An Erase Script Prepared
 int get_ektl_erase_script(struct erase_script *p_erase_script, size_t erase_script_size)
@@ -335,6 +509,12 @@ int get_ektl_erase_script(struct erase_script *p_erase_script, size_t erase_scri
     // Erase Section Count
     EraseScript.nEraseSectionCount = FOUR_BYTE_ARRAY_TO_UINT(&header_page[26]);
     DEBUG_PRINTF("%s: Erase Section Count = %d.\r\n", __func__, EraseScript.nEraseSectionCount);
+    if(EraseScript.nEraseSectionCount > MAX_HEADER_ERASE_SECTION_COUNT)
+    {
+        err = ERR_DATA_PATTERN;
+        ERROR_PRINTF("%s: Invalid Erase Section Count (%d)! err=0x%x.\r\n", __func__, EraseScript.nEraseSectionCount, err);
+        goto GET_EKTL_ERASE_SCRIPT_EXIT;
+    }
 
     // Erase Section Setting
     for(erase_section_index = 0; erase_section_index < EraseScript.nEraseSectionCount; erase_section_index++)
@@ -360,6 +540,92 @@ GET_EKTL_ERASE_SCRIPT_EXIT:
     return err;
 }
 
+// Plan eKTL Erase Script:
+// Sort Erase Sections by Address, then Merge Adjacent / Overlapping Ones while the Merged Range Stays within page_count_max.
+// A Section is Never Split: One Larger than page_count_max is Sent as One Erase Command, as Given in the eKTL File.
+// Same Flash Area is Erased with Fewer Erase Commands.
+int plan_ektl_erase_script(const struct erase_script *p_erase_script, unsigned int page_count_max, struct erase_script *p_erase_plan, size_t erase_plan_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned int erase_section_index = 0,
+                 sort_index = 0,
+                 insert_index = 0,
+                 range_address = 0,
+                 range_page_count = 0,      // Page Count of Range, from Range Address
+                 section_end_page = 0;      // Page Index of Section End (Exclusive), from Range Address
+    struct erase_section erase_section,
+                         sorted_section[MAX_ERASE_SECTION_COUNT];
+    struct erase_script EraseScript;
+
+    // Validate Input Parameter
+    if((p_erase_script == NULL) || (p_erase_plan == NULL) || (erase_plan_size < sizeof(struct erase_script)) || (page_count_max == 0) || \
+       (p_erase_script->nEraseSectionCount > MAX_ERASE_SECTION_COUNT))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_erase_script=0x%p, page_count_max=%u, p_erase_plan=0x%p, erase_plan_size=%ld)\r\n", \
+                     __func__, p_erase_script, page_count_max, p_erase_plan, erase_plan_size);
+        err = ERR_INVALID_PARAM;
+        goto PLAN_EKTL_ERASE_SCRIPT_EXIT;
+    }
+
+    // Initialize Erase Plan
+    memset(&EraseScript, 0, sizeof(struct erase_script));
+    memcpy(EraseScript.nArrayVerLibHex2Ektl, p_erase_script->nArrayVerLibHex2Ektl, sizeof(EraseScript.nArrayVerLibHex2Ektl));
+
+    // Sort Erase Sections by Address (Insertion Sort, Few Sections), Skip Empty Ones
+    for(erase_section_index = 0, sort_index = 0; erase_section_index < p_erase_script->nEraseSectionCount; erase_section_index++)
+    {
+        erase_section = p_erase_script->EraseSection[erase_section_index];
+        if(erase_section.page_count == 0)
+            continue;
+        for(insert_index = sort_index; (insert_index > 0) && (sorted_section[insert_index - 1].address > erase_section.address); insert_index--)
+            sorted_section[insert_index] = sorted_section[insert_index - 1];
+        sorted_section[insert_index] = erase_section;
+        sort_index++;
+    }
+
+    // Merge
+    for(erase_section_index = 0; erase_section_index < sort_index; erase_section_index++)
+    {
+        // Section Starts inside or right after Current Range: Merge if Range Stays within page_count_max (or Does not Grow)
+        if((range_page_count > 0) && \
+           ((sorted_section[erase_section_index].address - range_address) <= (range_page_count * ELAN_EKTL_FW_PAGE_DATA_SIZE)))
+        {
+            section_end_page = ((sorted_section[erase_section_index].address - range_address) / ELAN_EKTL_FW_PAGE_DATA_SIZE) + \
+                               sorted_section[erase_section_index].page_count;
+            if(section_end_page <= range_page_count)
+                continue;
+            if(section_end_page <= page_count_max)
+            {
+                range_page_count = section_end_page;
+                EraseScript.EraseSection[EraseScript.nEraseSectionCount - 1].page_count = range_page_count;
+                continue;
+            }
+        }
+
+        // Start New Range (Erase Command) with Section as Given
+        if(EraseScript.nEraseSectionCount >= MAX_ERASE_SECTION_COUNT)
+        {
+            ERROR_PRINTF("%s: Too Many Erase Sections in Plan (Max. %d)!\r\n", __func__, MAX_ERASE_SECTION_COUNT);
+            err = ERR_DATA_PATTERN;
+            goto PLAN_EKTL_ERASE_SCRIPT_EXIT;
+        }
+        range_address = sorted_section[erase_section_index].address;
+        range_page_count = sorted_section[erase_section_index].page_count;
+        EraseScript.EraseSection[EraseScript.nEraseSectionCount] = sorted_section[erase_section_index];
+        EraseScript.nEraseSectionCount++;
+    }
+    DEBUG_PRINTF("%s: %d Erase Sections Planned into %d Erase Commands.\r\n", __func__, p_erase_script->nEraseSectionCount, EraseScript.nEraseSectionCount);
+
+    // Load Erase Plan to Input Buffer
+    memcpy(p_erase_plan, &EraseScript, sizeof(struct erase_script));
+
+    // Success
+    err = ERR_SUCCESS;
+
+PLAN_EKTL_ERASE_SCRIPT_EXIT:
+    return err;
+}
+
 // Get eKTL FW Page Count
 int compute_ektl_fw_page_number(int firmware_size)
 {
@@ -14,10 +14,13 @@
 
 **/
 
+#include <time.h>
 #include "InterfaceGet.h"
+#include "ElanTsHidUtility.h"
 #include "ElanTsFuncApi.h"
 #include "ElanTsFwFileIoUtility.h"
 #include "ElanTsFwUpdateFlow.h"
+#include "ElanTsGenFlow.h"
 #include "ElanGen8TsFuncApi.h"
 #include "ElanGen8TsFwFileIoUtility.h"
 #include "ElanGen8TsFwUpdateFlow.h"
@@ -51,28 +54,14 @@ int gen8_get_firmware_information(message_mode_t msg_mode)
     {
         printf("--------------------------------\r\n");
 
-        // FW ID
-        err = get_firmware_id(&fw_id);
+        // FW ID, Firmware Version, Test Version & Boot Code Version
+        err = get_firmware_info(&fw_id, &fw_version, &test_version, &bc_version, true);
         if(err != ERR_SUCCESS)
             goto GEN8_GET_FW_INFO_EXIT;
-        printf("Firmware ID: %02x.%02x\r\n", HIGH_BYTE(fw_id), LOW_BYTE(fw_id));
 
-        // Firmware Version
-        err = get_fw_version(&fw_version);
-        if(err != ERR_SUCCESS)
-            goto GEN8_GET_FW_INFO_EXIT;
+        printf("Firmware ID: %02x.%02x\r\n", HIGH_BYTE(fw_id), LOW_BYTE(fw_id));
         printf("Firmware Version: %02x.%02x\r\n", HIGH_BYTE(fw_version), LOW_BYTE(fw_version));
-
-        // Test Version
-        err = gen8_get_test_version(&test_version);
-        if(err != ERR_SUCCESS)
-            goto GEN8_GET_FW_INFO_EXIT;
         printf("Test Version: %02x.%02x\r\n", HIGH_BYTE(test_version), LOW_BYTE(test_version));
-
-        // Boot Code Version
-        err = get_boot_code_version(&bc_version);
-        if(err != ERR_SUCCESS)
-            goto GEN8_GET_FW_INFO_EXIT;
         printf("Boot Code Version: %02x.%02x\r\n", HIGH_BYTE(bc_version), LOW_BYTE(bc_version));
     }
 
@@ -197,6 +186,14 @@ int gen8_update_firmware(char *filename, size_t filename_len, bool recovery, int
     printf("--------------------------------\r\n");
     printf("FW Path: \"%s\".\r\n", filename);
 
+    // Validate Whole eKTL FW Image before Anything is Erased
+    err = validate_ektl_fw_image();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Invalid eKTL FW Image \"%s\"! err=0x%x.\r\n", __func__, filename, err);
+        goto GEN8_UPDATE_FIRMWARE_EXIT;
+    }
+
     //
     // Configure Behavior Settings
     //
@@ -372,3 +369,19 @@ GEN8_UPDATE_FIRMWARE_EXIT:
     return err;
 }
 
+// Firmware Verification (Gen8 Instance of Generation Flow Engine)
+int gen8_check_firmware_verifiable(void)
+{
+    return check_flash_pages_verifiable<ts_gen8_traits>();
+}
+
+int gen8_verify_firmware(message_mode_t msg_mode)
+{
+    return verify_flash_pages<ts_gen8_traits>(msg_mode);
+}
+
+// Flash Dump: Address is Offset from Information ROM (Gen8 Instance of Generation Flow Engine)
+int gen8_dump_flash(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode)
+{
+    return dump_flash_blocks<ts_gen8_traits>(filename, filename_len, address, size, msg_mode);
+}
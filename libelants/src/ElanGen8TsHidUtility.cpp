@@ -13,6 +13,7 @@
 
 #include "HIDLinuxGet.h"
 #include "ElanGen8TsHidUtility.h"
+#include "ElanTsHidCommand.h"
 
 /***************************************************
  * TP Functions
@@ -82,7 +83,7 @@ GEN8_GET_TEST_VERSION_DATA_EXIT:
 int gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len)
 {
     int err = ERR_SUCCESS;
-    unsigned char new_read_rom_data_cmd[10] =  {0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00} /* Read 32-bit RAM/ROM Data Command */;
+    unsigned char new_read_rom_data_field[5] = {0}; /* Data Length, ADDR_3 ~ ADDR_0 */
 
     // Check if Parameter Invalid
     if ((data_len != 1) && (data_len != 2) && (data_len != 4))
@@ -95,25 +96,18 @@ int gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len)
     /* Set Address & Length */
 
     // Set Length
-    new_read_rom_data_cmd[1] = data_len;
+    new_read_rom_data_field[0] = data_len;
 
     // Set Address
-    new_read_rom_data_cmd[2] = (unsigned char)((addr & 0xFF000000) >> 24); //ADDR_3, ex: 0x00
-    new_read_rom_data_cmd[3] = (unsigned char)((addr & 0x00FF0000) >> 16); //ADDR_2, ex: 0x04
-    new_read_rom_data_cmd[4] = (unsigned char)((addr & 0x0000FF00) >>  8); //ADDR_1, ex: 0x00
-    new_read_rom_data_cmd[5] = (unsigned char)((addr & 0x000000FF)      ); //ADDR_0, ex: 0x00
+    new_read_rom_data_field[1] = (unsigned char)((addr & 0xFF000000) >> 24); //ADDR_3, ex: 0x00
+    new_read_rom_data_field[2] = (unsigned char)((addr & 0x00FF0000) >> 16); //ADDR_2, ex: 0x04
+    new_read_rom_data_field[3] = (unsigned char)((addr & 0x0000FF00) >>  8); //ADDR_1, ex: 0x00
+    new_read_rom_data_field[4] = (unsigned char)((addr & 0x000000FF)      ); //ADDR_0, ex: 0x00
 
     /* Send Read 32-bit RAM/ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
-                 new_read_rom_data_cmd[0], new_read_rom_data_cmd[1], \
-                 new_read_rom_data_cmd[2], new_read_rom_data_cmd[3], new_read_rom_data_cmd[4], new_read_rom_data_cmd[5], \
-                 new_read_rom_data_cmd[6], new_read_rom_data_cmd[7], new_read_rom_data_cmd[8], new_read_rom_data_cmd[9]);
-    err = write_cmd(new_read_rom_data_cmd, sizeof(new_read_rom_data_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    err = send_hid_command(HID_CMD_GEN8_READ_ROM_DATA, new_read_rom_data_field, sizeof(new_read_rom_data_field));
     if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("%s: Fail to send Read 32-bit RAM/ROM Data Command! err=0x%x.\r\n", __func__, err);
         goto GEN8_SEND_READ_ROM_DATA_COMMAND_EXIT;
-    }
 
     // Success
     err = ERR_SUCCESS;
@@ -173,28 +167,14 @@ GEN8_RECEIVE_ROM_DATA_EXIT:
 // IAP Mode
 int send_gen8_write_flash_key_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char gen8_write_flash_key_cmd[10] = {0x54, 0xc0, 0xcd, 0xab, 0x34, 0x84, 0x01, 0x67, 0x94, 0x81};
-
-    /* Send Gen8 Write Flash Key Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", \
-                 gen8_write_flash_key_cmd[0], gen8_write_flash_key_cmd[1], gen8_write_flash_key_cmd[2], gen8_write_flash_key_cmd[3], \
-                 gen8_write_flash_key_cmd[4], gen8_write_flash_key_cmd[5], gen8_write_flash_key_cmd[6], gen8_write_flash_key_cmd[7], \
-                 gen8_write_flash_key_cmd[8], gen8_write_flash_key_cmd[9]);
-    err = write_cmd(gen8_write_flash_key_cmd, sizeof(gen8_write_flash_key_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("Fail to send Gen8 Write Flash Key command! err=0x%x.\r\n", err);
-    }
-
-    return err;
+    return send_hid_command(HID_CMD_GEN8_WRITE_FLASH_KEY);
 }
 
 // Erase Flash Section
 int send_erase_flash_section_command(unsigned int address, unsigned short page_count)
 {
     int err = ERR_SUCCESS;
-    unsigned char hid_frame_data[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+    unsigned char erase_flash_section_field[6] = {0};
 
     // Valid Page Count to Erase
     if(page_count == 0)
@@ -204,26 +184,18 @@ int send_erase_flash_section_command(unsigned int address, unsigned short page_c
         goto SEND_ERASE_FLASH_SECTION_COMMMAND_EXIT;
     }
 
-    // Clear Frame Data
-    memset(hid_frame_data, 0, sizeof(hid_frame_data));
-
-    // Add header of vendor command to frame data
-    hid_frame_data[0] = ELAN_HID_OUTPUT_REPORT_ID;                        // 0x03
-    hid_frame_data[1] = 0x20;
-    hid_frame_data[2] = (unsigned char) (address & 0x000000FF);           // LSB (Byte 0) of Address       //ex:00
-    hid_frame_data[3] = (unsigned char)((address & 0x0000FF00) >>  8);    //      Byte 1  of Address       //ex:F8
-    hid_frame_data[4] = (unsigned char)((address & 0x00FF0000) >> 16);    //      Byte 2  of Address       //ex:03
-    hid_frame_data[5] = (unsigned char)((address & 0xFF000000) >> 24);    // MSB (Byte 3) of Address       //ex:00
-    hid_frame_data[6] = (unsigned char) (page_count & 0x00FF);            // LSB (Byte 0) of Page_Count    //ex:01
-    hid_frame_data[7] = (unsigned char)((page_count & 0xFF00) >>  8);     // MSB (Byte 1) of Page_Count    //ex:00
-
-    // Write frame data to touch
-    err = __hidraw_write(hid_frame_data, sizeof(hid_frame_data), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    // Address & Page Count of Erase Flash Section Command (0x20)
+    erase_flash_section_field[0] = (unsigned char) (address & 0x000000FF);           // LSB (Byte 0) of Address       //ex:00
+    erase_flash_section_field[1] = (unsigned char)((address & 0x0000FF00) >>  8);    //      Byte 1  of Address       //ex:F8
+    erase_flash_section_field[2] = (unsigned char)((address & 0x00FF0000) >> 16);    //      Byte 2  of Address       //ex:03
+    erase_flash_section_field[3] = (unsigned char)((address & 0xFF000000) >> 24);    // MSB (Byte 3) of Address       //ex:00
+    erase_flash_section_field[4] = (unsigned char) (page_count & 0x00FF);            // LSB (Byte 0) of Page_Count    //ex:01
+    erase_flash_section_field[5] = (unsigned char)((page_count & 0xFF00) >>  8);     // MSB (Byte 1) of Page_Count    //ex:00
+
+    // Send Erase Flash Section Command
+    err = send_hid_command(HID_CMD_GEN8_ERASE_FLASH_SECTION, erase_flash_section_field, sizeof(erase_flash_section_field));
     if(err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("Fail to write frame data, err=0x%x.\r\n", err);
         goto SEND_ERASE_FLASH_SECTION_COMMMAND_EXIT;
-    }
 
     // Success
     err = ERR_SUCCESS;
@@ -13,3 +13,6 @@
 // Debug
 bool g_debug = false;
 
+// Debug Message to stderr
+bool g_debug_to_stderr = false;
+
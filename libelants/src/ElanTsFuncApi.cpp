@@ -16,11 +16,18 @@
 #include "ElanTsHidUtility.h"
 #include "ElanTsFwFileIoUtility.h"
 #include "ElanTsFuncApi.h"
+#include "ElanGen8TsHidHwParameters.h" // Hello Packet & BC Version of Gen8 Touch
+#include "ElanTsRetryUtility.h"
+#include "ElanTsTimingProfile.h"
 
 /***************************************************
  * Global Variable Declaration
  ***************************************************/
 
+// Information Page Cache (Valid until Switching to Boot Code)
+static unsigned char g_info_page_cache[ELAN_MEMORY_PAGE_SIZE] = {0};
+static bool g_info_page_cache_valid = false;
+
 /***************************************************
  * Function Implements
  ***************************************************/
@@ -85,6 +92,60 @@ GET_TEST_VERSION_EXIT:
     return err;
 }
 
+// FW ID, FW Version, Test Version & BC Version (NULL to Skip) in One Pipelined Transaction
+int get_firmware_info(unsigned short *p_fw_id, unsigned short *p_fw_version, unsigned short *p_test_version, unsigned short *p_bc_version, bool gen8_touch)
+{
+    int err = ERR_SUCCESS,
+        cmd_count = 0,
+        cmd_index = 0;
+    unsigned short *p_value_list[4] = {p_fw_id, p_fw_version, p_test_version, p_bc_version};
+    const unsigned char cmd_type_list[4] = {0xf0 /* FW ID */, 0x00 /* FW Version */, 0xe0 /* Test Version */, 0x10 /* BC Version */};
+    unsigned short *p_value_of_cmd[4] = {NULL};
+    struct pipelined_command cmd_list[4];
+    const unsigned char *p_response = NULL;
+
+    memset(cmd_list, 0, sizeof(cmd_list));
+    for(cmd_index = 0; cmd_index < 4; cmd_index++)
+    {
+        if(p_value_list[cmd_index] == NULL)
+            continue;
+
+        cmd_list[cmd_count].cmd[0] = ELAN_QUERY_COMMAND_HEADER;
+        cmd_list[cmd_count].cmd[1] = cmd_type_list[cmd_index];
+        cmd_list[cmd_count].cmd[2] = 0x00;
+        cmd_list[cmd_count].cmd[3] = 0x01;
+        p_value_of_cmd[cmd_count] = p_value_list[cmd_index];
+        cmd_count++;
+    }
+
+    // Nothing to Query
+    if(cmd_count == 0)
+        goto GET_FIRMWARE_INFO_EXIT;
+
+    err = issue_pipelined_commands(cmd_list, cmd_count, ELAN_READ_DATA_TIMEOUT_MSEC);
+    if(err != ERR_SUCCESS)
+        goto GET_FIRMWARE_INFO_EXIT;
+
+    for(cmd_index = 0; cmd_index < cmd_count; cmd_index++)
+    {
+        p_response = cmd_list[cmd_index].response;
+
+        /* Response: | 0x52 | Type << 4 | Major (High Nibble) | Major (Low Nibble), Minor (High Nibble) | Minor (Low Nibble) << 4 |  *
+         * Gen8 Test Version: | 0x52 | 0xe0 | High Byte | Low Byte |                                                                  */
+        if(gen8_touch && (cmd_list[cmd_index].cmd[1] == 0xe0))
+            *p_value_of_cmd[cmd_index] = (p_response[2] << 8) | p_response[3];
+        else
+            *p_value_of_cmd[cmd_index] = ((p_response[1] & 0x0f) << 12) | (p_response[2] << 4) | ((p_response[3] & 0xf0) >> 4);
+        DEBUG_PRINTF("%s: Type 0x%02x: %04x\r\n", __func__, cmd_list[cmd_index].cmd[1], *p_value_of_cmd[cmd_index]);
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+GET_FIRMWARE_INFO_EXIT:
+    return err;
+}
+
 // Solution ID
 int get_solution_id(unsigned char *p_solution_id)
 {
@@ -151,50 +212,113 @@ int calibrate_touch(void)
     if(err != ERR_SUCCESS)
         goto CALIBRATE_TOUCH_EXIT;
 
-    // Receive Data
-    err = receive_rek_response();
+    // Wait for Completion Report (Touch Reports in between are Skipped)
+    err = wait_rek_response(ELAN_READ_CALI_RESP_TIMEOUT_MSEC);
     if(err != ERR_SUCCESS)
         goto CALIBRATE_TOUCH_EXIT;
+    printf("Re-Calibration success.\r\n");
 
 CALIBRATE_TOUCH_EXIT:
     return err;
 }
 
+// Calibrate, Timing Calibration until Its Completion Report
+static int calibrate_touch_timed(struct calibration_result *p_calibration_result)
+{
+    int err = ERR_SUCCESS;
+    struct timespec start_time,
+                    end_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    err = calibrate_touch();
+    if(err != ERR_SUCCESS)
+        goto CALIBRATE_TOUCH_TIMED_EXIT;
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+    p_calibration_result->duration_ms = (unsigned long)((end_time.tv_sec - start_time.tv_sec) * 1000 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000);
+    DEBUG_PRINTF("%s: Re-Calibration Time: %lums.\r\n", __func__, p_calibration_result->duration_ms);
+
+CALIBRATE_TOUCH_TIMED_EXIT:
+    return err;
+}
+
+// Calibrate & Read Calibration Counter
+int calibrate_touch_and_get_counter(struct calibration_result *p_calibration_result)
+{
+    int err = ERR_SUCCESS;
+
+    // Validate Input Parameter
+    if(p_calibration_result == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Calibration Result Buffer!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto CALIBRATE_TOUCH_AND_GET_COUNTER_EXIT;
+    }
+
+    err = calibrate_touch_timed(p_calibration_result);
+    if(err != ERR_SUCCESS)
+        goto CALIBRATE_TOUCH_AND_GET_COUNTER_EXIT;
+
+    err = get_rek_counter(&p_calibration_result->rek_counter);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get Calibration Counter! err=0x%x.\r\n", __func__, err);
+        goto CALIBRATE_TOUCH_AND_GET_COUNTER_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+CALIBRATE_TOUCH_AND_GET_COUNTER_EXIT:
+    return err;
+}
+
+// Transaction Adapters of Retry Engine
+static int calibrate_touch_transaction(void *p_context)
+{
+    return calibrate_touch();
+}
+
 int calibrate_touch_with_error_retry(int retry_count)
 {
-    int err = ERR_SUCCESS,
-        retry_index = 0;
+    return run_with_retry("Calibrate Touch", retry_count, calibrate_touch_transaction, NULL);
+}
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
+static int calibrate_touch_timed_transaction(void *p_context)
+{
+    return calibrate_touch_timed((struct calibration_result *)p_context);
+}
 
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
+static int get_rek_counter_transaction(void *p_context)
+{
+    return get_rek_counter((unsigned short *)p_context);
+}
+
+// Calibration & Counter Read are Retried Separately, so a Failed Counter Read never Re-sends Calibration
+int calibrate_touch_and_get_counter_with_error_retry(struct calibration_result *p_calibration_result, int retry_count)
+{
+    int err = ERR_SUCCESS;
+
+    // Validate Input Parameter
+    if(p_calibration_result == NULL)
     {
-        err = calibrate_touch();
-        if(err == ERR_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
+        ERROR_PRINTF("%s: NULL Calibration Result Buffer!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto CALIBRATE_TOUCH_AND_GET_COUNTER_WITH_ERROR_RETRY_EXIT;
+    }
 
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Calibrate Touch! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Calibrate Touch! err=0x%x.\r\n", __func__, err);
-            goto CALIBRATE_TOUCH_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 10ms
-            usleep(10*1000);
-            continue;
-        }
+    err = run_with_retry("Calibrate Touch", retry_count, calibrate_touch_timed_transaction, p_calibration_result);
+    if(err != ERR_SUCCESS)
+        goto CALIBRATE_TOUCH_AND_GET_COUNTER_WITH_ERROR_RETRY_EXIT;
+
+    err = run_with_retry("Get Calibration Counter", retry_count, get_rek_counter_transaction, &p_calibration_result->rek_counter);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get Calibration Counter! err=0x%x.\r\n", __func__, err);
+        goto CALIBRATE_TOUCH_AND_GET_COUNTER_WITH_ERROR_RETRY_EXIT;
     }
 
-CALIBRATE_TOUCH_WITH_ERROR_RETRY_EXIT:
+CALIBRATE_TOUCH_AND_GET_COUNTER_WITH_ERROR_RETRY_EXIT:
     return err;
 }
 
@@ -290,10 +414,23 @@ GET_HELLO_PACKET_BC_VERSION_EXIT:
     return err;
 }
 
+struct hello_packet_context
+{
+    unsigned char *p_hello_packet;
+    unsigned short *p_bc_version;
+};
+
+static int get_hello_packet_bc_version_transaction(void *p_context)
+{
+    struct hello_packet_context *p_hello_packet_context = (struct hello_packet_context *)p_context;
+
+    return get_hello_packet_bc_version(p_hello_packet_context->p_hello_packet, p_hello_packet_context->p_bc_version);
+}
+
 int get_hello_packet_bc_version_with_error_retry(unsigned char *p_hello_packet, unsigned short *p_bc_version, int retry_count)
 {
-    int err = ERR_SUCCESS,
-        retry_index = 0;
+    int err = ERR_SUCCESS;
+    struct hello_packet_context hello_packet_context;
 
     // Make Sure Page Data Buffer Valid
     if(p_hello_packet == NULL)
@@ -303,35 +440,9 @@ int get_hello_packet_bc_version_with_error_retry(unsigned char *p_hello_packet,
         goto GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT;
     }
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
-
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
-    {
-        err = get_hello_packet_bc_version(p_hello_packet, p_bc_version);
-        if(err == ERR_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
-
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", __func__, err);
-            goto GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
-
-            continue;
-        }
-    }
+    hello_packet_context.p_hello_packet = p_hello_packet;
+    hello_packet_context.p_bc_version = p_bc_version;
+    err = run_with_retry("Get Hello Packet (& BC Version)", retry_count, get_hello_packet_bc_version_transaction, &hello_packet_context);
 
 GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT:
     return err;
@@ -339,9 +450,9 @@ GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT:
 
 int get_hello_packet_with_error_retry(unsigned char *p_hello_packet, int retry_count)
 {
-    int err = ERR_SUCCESS,
-        retry_index = 0;
+    int err = ERR_SUCCESS;
     unsigned short bc_bc_version = 0;
+    struct hello_packet_context hello_packet_context;
 
     // Make Sure Page Data Buffer Valid
     if(p_hello_packet == NULL)
@@ -351,37 +462,95 @@ int get_hello_packet_with_error_retry(unsigned char *p_hello_packet, int retry_c
         goto GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT;
     }
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
+    hello_packet_context.p_hello_packet = p_hello_packet;
+    hello_packet_context.p_bc_version = &bc_bc_version;
+    err = run_with_retry("Get Hello Packet", retry_count, get_hello_packet_bc_version_transaction, &hello_packet_context);
+
+GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT:
+    return err;
+}
+
+int detect_touch_state(struct touch_session *p_session)
+{
+    int err = ERR_SUCCESS;
+    unsigned short fw_bc_version = 0,
+                   bc_bc_version = 0;
+    unsigned char hello_packet = 0;
+    bool gen8_touch = false,	// True if Gen8 Touch
+         recovery = false;		// True if Recovery Mode
+
+    // Make Sure Session Buffer Valid
+    if(p_session == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Session Buffer!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto DETECT_TOUCH_STATE_EXIT;
+    }
 
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
+    // Get Hello Packet
+    err = get_hello_packet_bc_version_with_error_retry(&hello_packet, &bc_bc_version, ERROR_RETRY_COUNT);
+    if(err != ERR_SUCCESS)
     {
-        err = get_hello_packet_bc_version(p_hello_packet, &bc_bc_version);
-        if(err == ERR_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
+        ERROR_PRINTF("Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", err);
+        goto DETECT_TOUCH_STATE_EXIT;
+    }
+    DEBUG_PRINTF("Hello Packet: 0x%02x, Recovery Mode BC Version: 0x%04x.\r\n", hello_packet, bc_bc_version);
+
+    // Identify HW Series & Touch State
+    switch (hello_packet)
+    {
+        case ELAN_HID_NORMAL_MODE_HELLO_PACKET:
+            // BC Version (Normal Mode)
+            err = get_boot_code_version(&fw_bc_version);
+            if(err != ERR_SUCCESS)
+            {
+                ERROR_PRINTF("%s: Fail to Get BC Version (Normal Mode)! err=0x%x.\r\n", __func__, err);
+                goto DETECT_TOUCH_STATE_EXIT;
+            }
+            DEBUG_PRINTF("Normal Mode BC Version: 0x%04x.\r\n", fw_bc_version);
+
+            // Special Case: First BC of EM32F901 / EM32F902
+            if((HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_HID) /* EM32F901 */ ||
+               (HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_HID) /* FM32F902 */)
+                gen8_touch = true;     // Gen8 Touch
+            else
+                gen8_touch = false;    // Gen5/6/7 Touch
+            recovery = false;          // Normal Mode
             break;
-        }
 
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Hello Packet! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Hello Packet! err=0x%x.\r\n", __func__, err);
-            goto GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
+        case ELAN_GEN8_HID_NORMAL_MODE_HELLO_PACKET:
+            gen8_touch = true;         // Gen8 Touch
+            recovery = false;          // Normal Mode
+            break;
 
-            continue;
-        }
+        case ELAN_HID_RECOVERY_MODE_HELLO_PACKET:
+            // Special Case: First BC of EM32F901 / EM32F902
+            if((HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_HID) /* EM32F901 */ ||
+               (HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_HID) /* FM32F902 */)
+                gen8_touch = true;     // Gen8 Touch
+            else
+                gen8_touch = false;    // Gen5/6/7 Touch
+            recovery = true;           // Recovery Mode
+            break;
+
+        case ELAN_GEN8_HID_RECOVERY_MODE_HELLO_PACKET:
+            gen8_touch = true;         // Gen8 Touch
+            recovery = true;           // Recovery Mode
+            break;
+
+        default:
+            ERROR_PRINTF("%s: Unknown Hello Packet! (0x%02x) \r\n", __func__, hello_packet);
+            err = ERR_UNKNOWN_DEVICE_TYPE;
+            goto DETECT_TOUCH_STATE_EXIT;
     }
 
-GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT:
+    p_session->hello_packet = hello_packet;
+    p_session->bc_bc_version = bc_bc_version;
+    p_session->fw_bc_version = fw_bc_version;
+    p_session->gen8_touch = gen8_touch;
+    p_session->recovery = recovery;
+
+DETECT_TOUCH_STATE_EXIT:
     return err;
 }
 
@@ -461,6 +630,123 @@ READ_MEMORY_PAGE_EXIT:
     return err;
 }
 
+// Bulk ROM Frames:
+// Receive $(data_size) Bytes Sent in Frames after Show Bulk ROM Data Command, without Fixed Delay.
+// Each Frame is Placed by Its Packet Index, so Out-of-Order or Repeated Frames are Reassembled,
+// and Interleaved Finger / Pen Reports are Skipped.
+int receive_bulk_rom_frames(unsigned int data_size, unsigned char *p_data_buf, size_t data_buf_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned int frame_count = 0,
+                 frame_index = 0,
+                 frame_data_len = 0,
+                 recv_frame_count = 0,
+                 read_count = 0;
+    unsigned char data_buf[ELAN_HID_DATA_BUFFER_SIZE] = {0},
+                  frame_received[ELAN_HID_READ_FRAME_COUNT_MAX] = {0};
+
+    // Validate Input Parameter
+    frame_count = (data_size / ELAN_HID_READ_PAGE_FRAME_SIZE) + ((data_size % ELAN_HID_READ_PAGE_FRAME_SIZE) != 0);
+    if((p_data_buf == NULL) || (data_size == 0) || (data_buf_size < data_size) || (frame_count > ELAN_HID_READ_FRAME_COUNT_MAX))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_data_buf=0x%p, data_size=%u, data_buf_size=%ld)\r\n", __func__, p_data_buf, data_size, data_buf_size);
+        err = ERR_INVALID_PARAM;
+        goto RECEIVE_BULK_ROM_FRAMES_EXIT;
+    }
+
+    while(recv_frame_count < frame_count)
+    {
+        // Give up if Frames Keep Missing
+        if(read_count++ >= (frame_count * 2))
+        {
+            ERROR_PRINTF("%s: Only %d of %d Frames Received!\r\n", __func__, recv_frame_count, frame_count);
+            err = ERR_DATA_PATTERN;
+            goto RECEIVE_BULK_ROM_FRAMES_EXIT;
+        }
+
+        // Read Next Frame (Blocked until Frame Arrived or Timeout)
+        memset(data_buf, 0, sizeof(data_buf));
+        err = read_data(data_buf, sizeof(data_buf), ELAN_READ_DATA_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS) // Error or Timeout
+        {
+            ERROR_PRINTF("%s: Fail to Read Frame (%d of %d Received)! err=0x%x.\r\n", __func__, recv_frame_count, frame_count, err);
+            goto RECEIVE_BULK_ROM_FRAMES_EXIT;
+        }
+
+        // Skip Non-Bulk-Data Packet
+        if(data_buf[0] != 0x99)
+        {
+            DEBUG_PRINTF("%s: Skip Packet {%02x %02x %02x ...}.\r\n", __func__, data_buf[0], data_buf[1], data_buf[2]);
+            continue;
+        }
+
+        // Validate Packet Index & Data Length
+        frame_index = data_buf[1];
+        if(frame_index == (frame_count - 1)) // Last Frame
+            frame_data_len = data_size - (frame_index * ELAN_HID_READ_PAGE_FRAME_SIZE);
+        else
+            frame_data_len = ELAN_HID_READ_PAGE_FRAME_SIZE;
+        if((frame_index >= frame_count) || (data_buf[2] < frame_data_len))
+        {
+            ERROR_PRINTF("%s: Invalid Received Frame Data = {%02x %02x %02x ...}.\r\n", __func__, data_buf[0], data_buf[1], data_buf[2]);
+            err = ERR_DATA_PATTERN;
+            goto RECEIVE_BULK_ROM_FRAMES_EXIT;
+        }
+
+        // Repeated Frame
+        if(frame_received[frame_index])
+            continue;
+
+        // Copy Frame Data to its Position
+        memcpy(&p_data_buf[frame_index * ELAN_HID_READ_PAGE_FRAME_SIZE], &data_buf[3], frame_data_len);
+        frame_received[frame_index] = 1;
+        recv_frame_count++;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+RECEIVE_BULK_ROM_FRAMES_EXIT:
+    return err;
+}
+
+// Memory Block: Several Pages in One Bulk Read
+int read_memory_block(unsigned short mem_block_address, unsigned int mem_block_size, unsigned char *p_mem_block_buf, size_t mem_block_buf_size)
+{
+    int err = ERR_SUCCESS;
+
+    // Validate Input Parameter (Length of Bulk Read Command is in Word)
+    if((p_mem_block_buf == NULL) || (mem_block_size == 0) || ((mem_block_size % 2) != 0) || (mem_block_buf_size < mem_block_size))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_mem_block_buf=0x%p, mem_block_size=%u, mem_block_buf_size=%ld)\r\n", \
+                     __func__, p_mem_block_buf, mem_block_size, mem_block_buf_size);
+        err = ERR_INVALID_PARAM;
+        goto READ_MEMORY_BLOCK_EXIT;
+    }
+
+    // Send Show Bulk ROM Data Command
+    err = send_show_bulk_rom_data_command(mem_block_address, (unsigned short)(mem_block_size / 2) /* unit: word */);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Send Show Bulk ROM Data Command! err=0x%x.\r\n", __func__, err);
+        goto READ_MEMORY_BLOCK_EXIT;
+    }
+
+    // Receive Block Data
+    err = receive_bulk_rom_frames(mem_block_size, p_mem_block_buf, mem_block_buf_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Receive Block Data (addr=0x%04x)! err=0x%x.\r\n", __func__, mem_block_address, err);
+        goto READ_MEMORY_BLOCK_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+READ_MEMORY_BLOCK_EXIT:
+    return err;
+}
+
 // Info. Page
 int get_info_page(unsigned char *info_page_buf, size_t info_page_buf_size)
 {
@@ -475,13 +761,21 @@ int get_info_page(unsigned char *info_page_buf, size_t info_page_buf_size)
     }
 
     // Make Sure Info. Page Buffer Size Valid
-    if(info_page_buf_size == 0)
+    if(info_page_buf_size < ELAN_MEMORY_PAGE_SIZE)
     {
-        ERROR_PRINTF("%s: Info. Page Buffer Size is Zero!\r\n", __func__);
+        ERROR_PRINTF("%s: Invalid Info. Page Buffer Size (%ld)!\r\n", __func__, info_page_buf_size);
         err = ERR_INVALID_PARAM;
         goto GET_INFO_PAGE_EXIT;
     }
 
+    // Information Page Already Read in This Session
+    if(g_info_page_cache_valid)
+    {
+        memcpy(info_page_buf, g_info_page_cache, sizeof(g_info_page_cache));
+        err = ERR_SUCCESS;
+        goto GET_INFO_PAGE_EXIT;
+    }
+
     // Enter Test Mode
     err = send_enter_test_mode_command();
     if(err != ERR_SUCCESS)
@@ -490,8 +784,13 @@ int get_info_page(unsigned char *info_page_buf, size_t info_page_buf_size)
         goto GET_INFO_PAGE_EXIT;
     }
 
-    // Read Information Page
-    err = read_memory_page(ELAN_INFO_MEMORY_PAGE_1_ADDR, ELAN_MEMORY_PAGE_SIZE, info_page_buf, info_page_buf_size);
+    // Read Information Page (Bulk Frames without Fixed Delay, Fall back to Page Read on Error)
+    err = read_memory_block(ELAN_INFO_MEMORY_PAGE_1_ADDR, ELAN_MEMORY_PAGE_SIZE, info_page_buf, info_page_buf_size);
+    if(err != ERR_SUCCESS)
+    {
+        DEBUG_PRINTF("%s: Fail to Read Information Page Block (err=0x%x), Read by Page.\r\n", __func__, err);
+        err = read_memory_page(ELAN_INFO_MEMORY_PAGE_1_ADDR, ELAN_MEMORY_PAGE_SIZE, info_page_buf, info_page_buf_size);
+    }
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
@@ -506,6 +805,10 @@ int get_info_page(unsigned char *info_page_buf, size_t info_page_buf_size)
         goto GET_INFO_PAGE_EXIT;
     }
 
+    // Keep Information Page for Later Access in This Session
+    memcpy(g_info_page_cache, info_page_buf, sizeof(g_info_page_cache));
+    g_info_page_cache_valid = true;
+
     // Success
     err = ERR_SUCCESS;
 
@@ -519,42 +822,83 @@ GET_INFO_PAGE_EXIT_1:
     return err;
 }
 
+struct info_page_context
+{
+    unsigned char *p_info_page_buf;
+    size_t info_page_buf_size;
+};
+
+static int get_info_page_transaction(void *p_context)
+{
+    struct info_page_context *p_info_page_context = (struct info_page_context *)p_context;
+
+    return get_info_page(p_info_page_context->p_info_page_buf, p_info_page_context->info_page_buf_size);
+}
+
 int get_info_page_with_error_retry(unsigned char *info_page_buf, size_t info_page_buf_size, int retry_count)
 {
-    int err = ERR_SUCCESS,
-        retry_index = 0;
+    struct info_page_context info_page_context;
+
+    info_page_context.p_info_page_buf = info_page_buf;
+    info_page_context.info_page_buf_size = info_page_buf_size;
+    return run_with_retry("Get Information Page", retry_count, get_info_page_transaction, &info_page_context);
+}
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
+void invalidate_info_page_cache(void)
+{
+    g_info_page_cache_valid = false;
+    return;
+}
 
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
+// Update Info.:
+// Take Update Counter & Last Update Time from Information Page Cache if Available,
+// Otherwise Read only These 4 Words, instead of Whole Information Page.
+int read_update_info(struct update_info *p_update_info, size_t update_info_size)
+{
+    int err = ERR_SUCCESS;
+    unsigned char info_page_buf[ELAN_MEMORY_PAGE_SIZE] = {0};
+    const unsigned int data_index = (ELAN_UPDATE_COUNTER_ADDR - ELAN_INFO_MEMORY_PAGE_1_ADDR) * 2 /* unit: byte */;
+
+    // Update Info. & Update Info. Size
+    if((p_update_info == NULL) || (update_info_size < sizeof(struct update_info)))
     {
-        err = get_info_page(info_page_buf, info_page_buf_size);
-        if(err == ERR_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
+        ERROR_PRINTF("%s: Invalid Update Info.! (p_update_info=0x%p, update_info_size=%ld)\r\n", \
+                     __func__, p_update_info, update_info_size);
+        err = ERR_INVALID_PARAM;
+        goto READ_UPDATE_INFO_EXIT;
+    }
 
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Information Page! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
+    if(g_info_page_cache_valid)
+    {
+        memcpy(info_page_buf, g_info_page_cache, sizeof(info_page_buf));
+    }
+    else
+    {
+        // Enter Test Mode
+        err = send_enter_test_mode_command();
+        if(err != ERR_SUCCESS)
         {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
-            goto GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT;
+            ERROR_PRINTF("%s: Fail to Enter Test Mode! err=0x%x.\r\n", __func__, err);
+            goto READ_UPDATE_INFO_EXIT;
         }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
 
-            continue;
+        // Read Update Info. Words into Their Place of Information Page
+        err = read_memory_block(ELAN_UPDATE_COUNTER_ADDR, ELAN_UPDATE_INFO_SIZE, &info_page_buf[data_index], sizeof(info_page_buf) - data_index);
+
+        // Leave Test Mode
+        send_exit_test_mode_command();
+
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Read Update Information! err=0x%x.\r\n", __func__, err);
+            goto READ_UPDATE_INFO_EXIT;
         }
     }
 
-GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT:
+    // Parse Update Info.
+    err = get_update_info(info_page_buf, sizeof(info_page_buf), p_update_info, update_info_size);
+
+READ_UPDATE_INFO_EXIT:
     return err;
 }
 
@@ -1133,13 +1477,15 @@ int get_and_update_info_page(unsigned char solution_id, unsigned char *p_info_pa
     // Get Update Inforamtion
     //
 
-    // Get Information Memory Page Data
+    // Get Information Memory Page Data (Read from Flash, as It is Written back Later)
+    invalidate_info_page_cache();
     err = get_info_page_with_error_retry(info_mem_page_buf, sizeof(info_mem_page_buf), ERROR_RETRY_COUNT);
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
         goto GET_AND_UPDATE_INFO_PAGE_EXIT;
     }
+    invalidate_info_page_cache(); // Page is Updated & Written back, Cached Copy would be Stale
 
     // Initialize eKTL FW Information Page Data Buffer
     memcpy(fw_info_page_data_buf, info_mem_page_buf, sizeof(info_mem_page_buf));
@@ -1278,6 +1624,9 @@ int switch_to_boot_code(bool recovery)
 {
     int err = ERR_SUCCESS;
 
+    // Flash may be Rewritten from Here
+    invalidate_info_page_cache();
+
     // Enter IAP Mode
     if(recovery == false) // Normal IAP
     {
@@ -1461,14 +1810,12 @@ int write_firmware_page(unsigned char *p_fw_page_buf, int fw_page_buf_size)
         goto WRITE_FIRMWARE_PAGE_EXIT;
     }
 
-    // Wait for FW Writing Flash
+    // Wait for FW Writing Flash (12ms * 30 for 30 Page Block, 15ms for 1 Page, or Learned from Timing Profile)
+    // & Receive Response of Flash Write
     if(fw_page_buf_size == (ELAN_FIRMWARE_PAGE_SIZE * 30)) // 30 Page Block
-        usleep(360 * 1000); // wait 12ms * 30
+        err = wait_for_response(TIMING_ITEM_FLASH_WRITE_PAGE_BLOCK, receive_flash_write_response);
     else
-        usleep(15 * 1000); // wait 15ms
-
-    // Receive Response of Flash Write
-    err = receive_flash_write_response();
+        err = wait_for_response(TIMING_ITEM_FLASH_WRITE_PAGE, receive_flash_write_response);
     if(err != ERR_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to Receive Flash Write! err=0x%x.\r\n", __func__, err);
@@ -0,0 +1,390 @@
+/** @file
+
+  Implementation of Firmware Bundle Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsFwBundle.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include "ErrCode.h"
+#include "ElanTsGenTraits.h"    // ELAN_TS_GEN_5, ELAN_TS_GEN_8
+#include "ElanTsFwCompress.h"   // compute_firmware_checksum()
+#include "ElanTsFwBundle.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+/***************************************************
+ * Local Functions
+ ***************************************************/
+
+static unsigned short read_le16(const unsigned char *p_buf)
+{
+    return (unsigned short)(p_buf[0] | (p_buf[1] << 8));
+}
+
+static unsigned int read_le32(const unsigned char *p_buf)
+{
+    return (unsigned int)p_buf[0] | ((unsigned int)p_buf[1] << 8) | ((unsigned int)p_buf[2] << 16) | ((unsigned int)p_buf[3] << 24);
+}
+
+static void write_le16(unsigned char *p_buf, unsigned short value)
+{
+    p_buf[0] = (unsigned char)(value & 0xFF);
+    p_buf[1] = (unsigned char)((value >> 8) & 0xFF);
+}
+
+static void write_le32(unsigned char *p_buf, unsigned int value)
+{
+    p_buf[0] = (unsigned char)(value & 0xFF);
+    p_buf[1] = (unsigned char)((value >> 8) & 0xFF);
+    p_buf[2] = (unsigned char)((value >> 16) & 0xFF);
+    p_buf[3] = (unsigned char)((value >> 24) & 0xFF);
+}
+
+static int write_full(int fd, const unsigned char *p_buf, size_t data_size)
+{
+    ssize_t write_len = 0;
+    size_t total_len = 0;
+
+    while(total_len < data_size)
+    {
+        write_len = write(fd, &p_buf[total_len], data_size - total_len);
+        if(write_len < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return ERR_FILE_IO_ERROR;
+        }
+        total_len += write_len;
+    }
+
+    return ERR_SUCCESS;
+}
+
+static void parse_bundle_entry(const unsigned char *p_buf, struct fw_bundle_entry *p_entry)
+{
+    p_entry->fwid = read_le16(&p_buf[0]);
+    p_entry->generation = p_buf[2];
+    p_entry->offset = read_le32(&p_buf[4]);
+    p_entry->size = read_le32(&p_buf[8]);
+    p_entry->checksum = read_le32(&p_buf[12]);
+}
+
+static bool is_valid_generation(int generation)
+{
+    return ((generation == ELAN_TS_GEN_5) || (generation == ELAN_TS_GEN_8));
+}
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Bundle
+bool is_firmware_bundle(const char *p_filename)
+{
+    int fd = -1;
+    ssize_t read_len = 0;
+    unsigned char magic[ELAN_FW_BUNDLE_MAGIC_SIZE] = {0};
+
+    if(p_filename == NULL)
+        return false;
+
+    fd = open(p_filename, O_RDONLY);
+    if(fd < 0)
+        return false;
+    read_len = pread(fd, magic, sizeof(magic), 0);
+    close(fd);
+
+    return ((read_len == (ssize_t)sizeof(magic)) && (memcmp(magic, ELAN_FW_BUNDLE_MAGIC, ELAN_FW_BUNDLE_MAGIC_SIZE) == 0));
+}
+
+// Entry Selection:
+// Bundle is Mapped, Index is Checked and Searched for (FWID, Generation), and Image of Matched Entry is Written
+// from the Mapping into an Anonymous Memory File in One Call, which then Works as Firmware File.
+int extract_firmware_bundle_entry(const char *p_bundle_filename, unsigned short fwid, int generation, int *p_image_fd)
+{
+    int err = ERR_SUCCESS,
+        fd = -1,
+        image_fd = -1;
+    unsigned int entry_count = 0,
+                 entry_index = 0,
+                 index_size = 0;
+    size_t bundle_size = 0;
+    bool found = false;
+    unsigned char *p_bundle = (unsigned char *)MAP_FAILED;
+    struct stat file_stat;
+    struct fw_bundle_entry entry;
+
+    // Validate Input Parameter
+    if((p_bundle_filename == NULL) || (is_valid_generation(generation) == false) || (p_image_fd == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_bundle_filename=0x%p, generation=%d, p_image_fd=0x%p)\r\n", __func__, p_bundle_filename, generation, p_image_fd);
+        err = ERR_INVALID_PARAM;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT;
+    }
+
+    // Map Bundle
+    fd = open(p_bundle_filename, O_RDONLY);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Open \"%s\"! errno=%d.\r\n", __func__, p_bundle_filename, errno);
+        err = ERR_FILE_NOT_FOUND;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT;
+    }
+    if((fstat(fd, &file_stat) < 0) || (file_stat.st_size < ELAN_FW_BUNDLE_HEADER_SIZE))
+    {
+        ERROR_PRINTF("%s: Invalid Bundle File Size!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_1;
+    }
+    bundle_size = (size_t)file_stat.st_size;
+    p_bundle = (unsigned char *)mmap(NULL, bundle_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p_bundle == (unsigned char *)MAP_FAILED)
+    {
+        ERROR_PRINTF("%s: Fail to Map \"%s\"! errno=%d.\r\n", __func__, p_bundle_filename, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_1;
+    }
+
+    // Header & Index
+    entry_count = read_le32(&p_bundle[4]);
+    if((memcmp(p_bundle, ELAN_FW_BUNDLE_MAGIC, ELAN_FW_BUNDLE_MAGIC_SIZE) != 0) || \
+       (entry_count == 0) || (entry_count > ELAN_FW_BUNDLE_ENTRY_COUNT_MAX) || \
+       ((ELAN_FW_BUNDLE_HEADER_SIZE + entry_count * ELAN_FW_BUNDLE_ENTRY_SIZE) > bundle_size))
+    {
+        ERROR_PRINTF("%s: Invalid Bundle Header! (entry_count=%u, size=%lu)\r\n", __func__, entry_count, (unsigned long)bundle_size);
+        err = ERR_DATA_PATTERN;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+    index_size = entry_count * ELAN_FW_BUNDLE_ENTRY_SIZE;
+    if(compute_firmware_checksum(&p_bundle[ELAN_FW_BUNDLE_HEADER_SIZE], index_size) != read_le32(&p_bundle[8]))
+    {
+        ERROR_PRINTF("%s: Bundle Index Checksum Mismatched!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+
+    // Search Index (First Matched Entry)
+    for(entry_index = 0; entry_index < entry_count; entry_index++)
+    {
+        parse_bundle_entry(&p_bundle[ELAN_FW_BUNDLE_HEADER_SIZE + entry_index * ELAN_FW_BUNDLE_ENTRY_SIZE], &entry);
+        DEBUG_PRINTF("%s: Entry %u: FWID 0x%04x, Gen%u, Offset 0x%x, Size %u.\r\n", __func__, entry_index, entry.fwid, entry.generation, entry.offset, entry.size);
+        if((entry.fwid == fwid) && (entry.generation == generation))
+        {
+            found = true;
+            break;
+        }
+    }
+    if(found == false)
+    {
+        ERROR_PRINTF("%s: No Firmware for FWID 0x%04x (Gen%d) in \"%s\"!\r\n", __func__, fwid, generation, p_bundle_filename);
+        err = ERR_FILE_NOT_FOUND;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+
+    // Check Image of Entry
+    if((entry.offset < (ELAN_FW_BUNDLE_HEADER_SIZE + index_size)) || (entry.offset > bundle_size) || \
+       (entry.size == 0) || (entry.size > (bundle_size - entry.offset)))
+    {
+        ERROR_PRINTF("%s: Invalid Entry of FWID 0x%04x! (offset=0x%x, size=%u)\r\n", __func__, fwid, entry.offset, entry.size);
+        err = ERR_DATA_PATTERN;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+    if(compute_firmware_checksum(&p_bundle[entry.offset], entry.size) != entry.checksum)
+    {
+        ERROR_PRINTF("%s: Image Checksum of FWID 0x%04x Mismatched!\r\n", __func__, fwid);
+        err = ERR_DATA_PATTERN;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+
+    // Image of Entry
+    image_fd = memfd_create("elants_fw_image", MFD_CLOEXEC);
+    if(image_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Memory File! errno=%d.\r\n", __func__, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+    err = write_full(image_fd, &p_bundle[entry.offset], entry.size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Write Memory File! errno=%d.\r\n", __func__, errno);
+        close(image_fd);
+        goto EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2;
+    }
+    lseek(image_fd, 0, SEEK_SET);
+
+    DEBUG_PRINTF("%s: FWID 0x%04x (Gen%d) Selected, %u Bytes.\r\n", __func__, fwid, generation, entry.size);
+    *p_image_fd = image_fd;
+
+    // Success
+    err = ERR_SUCCESS;
+
+EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_2:
+    munmap(p_bundle, bundle_size);
+
+EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT_1:
+    close(fd);
+
+EXTRACT_FIRMWARE_BUNDLE_ENTRY_EXIT:
+    return err;
+}
+
+// Bundle Creation
+int create_firmware_bundle(const char *p_bundle_filename, const struct fw_bundle_source *p_source, int source_count, message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS,
+        source_index = 0,
+        dup_index = 0,
+        src_fd = -1,
+        dst_fd = -1,
+        mapped_count = 0;
+    unsigned int offset = 0,
+                 index_size = 0;
+    unsigned char header_buf[ELAN_FW_BUNDLE_HEADER_SIZE] = {0},
+                  *p_index = NULL,
+                  *p_entry_buf = NULL,
+                  **pp_image = NULL;
+    unsigned int *p_image_size = NULL;
+    struct stat file_stat;
+
+    // Validate Input Parameter
+    if((p_bundle_filename == NULL) || (p_source == NULL) || (source_count <= 0) || (source_count > ELAN_FW_BUNDLE_ENTRY_COUNT_MAX))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_bundle_filename=0x%p, p_source=0x%p, source_count=%d)\r\n", __func__, p_bundle_filename, p_source, source_count);
+        err = ERR_INVALID_PARAM;
+        goto CREATE_FIRMWARE_BUNDLE_EXIT;
+    }
+    for(source_index = 0; source_index < source_count; source_index++)
+    {
+        if((p_source[source_index].p_filename == NULL) || (is_valid_generation(p_source[source_index].generation) == false))
+        {
+            ERROR_PRINTF("%s: Invalid Source %d! (generation=%d)\r\n", __func__, source_index, p_source[source_index].generation);
+            err = ERR_INVALID_PARAM;
+            goto CREATE_FIRMWARE_BUNDLE_EXIT;
+        }
+        for(dup_index = 0; dup_index < source_index; dup_index++)
+        {
+            if((p_source[dup_index].fwid == p_source[source_index].fwid) && (p_source[dup_index].generation == p_source[source_index].generation))
+            {
+                ERROR_PRINTF("%s: FWID 0x%04x (Gen%d) Listed Twice!\r\n", __func__, p_source[source_index].fwid, p_source[source_index].generation);
+                err = ERR_INVALID_PARAM;
+                goto CREATE_FIRMWARE_BUNDLE_EXIT;
+            }
+        }
+    }
+
+    index_size = source_count * ELAN_FW_BUNDLE_ENTRY_SIZE;
+    p_index = (unsigned char *)calloc(1, index_size);
+    pp_image = (unsigned char **)calloc(source_count, sizeof(unsigned char *));
+    p_image_size = (unsigned int *)calloc(source_count, sizeof(unsigned int));
+    if((p_index == NULL) || (pp_image == NULL) || (p_image_size == NULL))
+    {
+        ERROR_PRINTF("%s: Fail to Allocate Buffers!\r\n", __func__);
+        err = ERR_NO_MEMORY;
+        goto CREATE_FIRMWARE_BUNDLE_EXIT_1;
+    }
+
+    // Map Source Images & Build Index
+    offset = ELAN_FW_BUNDLE_HEADER_SIZE + index_size;
+    for(mapped_count = 0; mapped_count < source_count; mapped_count++)
+    {
+        src_fd = open(p_source[mapped_count].p_filename, O_RDONLY);
+        if(src_fd < 0)
+        {
+            ERROR_PRINTF("%s: Fail to Open \"%s\"! errno=%d.\r\n", __func__, p_source[mapped_count].p_filename, errno);
+            err = ERR_FILE_NOT_FOUND;
+            goto CREATE_FIRMWARE_BUNDLE_EXIT_2;
+        }
+        if((fstat(src_fd, &file_stat) < 0) || (file_stat.st_size <= 0) || \
+           ((unsigned long long)offset + file_stat.st_size > 0xFFFFFFFFULL))
+        {
+            ERROR_PRINTF("%s: Invalid Firmware File Size of \"%s\"!\r\n", __func__, p_source[mapped_count].p_filename);
+            close(src_fd);
+            err = ERR_DATA_PATTERN;
+            goto CREATE_FIRMWARE_BUNDLE_EXIT_2;
+        }
+        p_image_size[mapped_count] = (unsigned int)file_stat.st_size;
+        pp_image[mapped_count] = (unsigned char *)mmap(NULL, p_image_size[mapped_count], PROT_READ, MAP_PRIVATE, src_fd, 0);
+        close(src_fd);
+        if(pp_image[mapped_count] == (unsigned char *)MAP_FAILED)
+        {
+            ERROR_PRINTF("%s: Fail to Map \"%s\"! errno=%d.\r\n", __func__, p_source[mapped_count].p_filename, errno);
+            err = ERR_FILE_IO_ERROR;
+            goto CREATE_FIRMWARE_BUNDLE_EXIT_2;
+        }
+
+        p_entry_buf = &p_index[mapped_count * ELAN_FW_BUNDLE_ENTRY_SIZE];
+        write_le16(&p_entry_buf[0], p_source[mapped_count].fwid);
+        p_entry_buf[2] = (unsigned char)p_source[mapped_count].generation;
+        write_le32(&p_entry_buf[4], offset);
+        write_le32(&p_entry_buf[8], p_image_size[mapped_count]);
+        write_le32(&p_entry_buf[12], compute_firmware_checksum(pp_image[mapped_count], p_image_size[mapped_count]));
+        offset += p_image_size[mapped_count];
+    }
+
+    // Header
+    memcpy(header_buf, ELAN_FW_BUNDLE_MAGIC, ELAN_FW_BUNDLE_MAGIC_SIZE);
+    write_le32(&header_buf[4], (unsigned int)source_count);
+    write_le32(&header_buf[8], compute_firmware_checksum(p_index, index_size));
+
+    // Write Bundle
+    dst_fd = open(p_bundle_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(dst_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create \"%s\"! errno=%d.\r\n", __func__, p_bundle_filename, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto CREATE_FIRMWARE_BUNDLE_EXIT_2;
+    }
+    err = write_full(dst_fd, header_buf, sizeof(header_buf));
+    if(err == ERR_SUCCESS)
+        err = write_full(dst_fd, p_index, index_size);
+    for(source_index = 0; (err == ERR_SUCCESS) && (source_index < source_count); source_index++)
+        err = write_full(dst_fd, pp_image[source_index], p_image_size[source_index]);
+    close(dst_fd);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Write \"%s\"! errno=%d.\r\n", __func__, p_bundle_filename, errno);
+        unlink(p_bundle_filename); // Do not Leave Partial Bundle
+        goto CREATE_FIRMWARE_BUNDLE_EXIT_2;
+    }
+
+    if(msg_mode == FULL_MESSAGE)
+    {
+        for(source_index = 0; source_index < source_count; source_index++)
+            printf("FWID %04x (Gen%d): \"%s\" (%u Bytes).\r\n", p_source[source_index].fwid, p_source[source_index].generation, \
+                   p_source[source_index].p_filename, p_image_size[source_index]);
+        printf("Bundle \"%s\" Created, %d Images, %u Bytes.\r\n", p_bundle_filename, source_count, offset);
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+CREATE_FIRMWARE_BUNDLE_EXIT_2:
+    for(source_index = 0; source_index < mapped_count; source_index++)
+        munmap(pp_image[source_index], p_image_size[source_index]);
+
+CREATE_FIRMWARE_BUNDLE_EXIT_1:
+    free(p_image_size);
+    free(pp_image);
+    free(p_index);
+
+CREATE_FIRMWARE_BUNDLE_EXIT:
+    return err;
+}
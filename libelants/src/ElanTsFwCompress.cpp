@@ -0,0 +1,594 @@
+/** @file
+
+  Implementation of Compressed Firmware Image Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsFwCompress.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include "ErrCode.h"
+#include "ElanTsFwCompress.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+/***************************************************
+ * Local Functions
+ ***************************************************/
+
+static unsigned int read_le32(const unsigned char *p_buf)
+{
+    return (unsigned int)p_buf[0] | ((unsigned int)p_buf[1] << 8) | ((unsigned int)p_buf[2] << 16) | ((unsigned int)p_buf[3] << 24);
+}
+
+static void write_le32(unsigned char *p_buf, unsigned int value)
+{
+    p_buf[0] = (unsigned char)(value & 0xFF);
+    p_buf[1] = (unsigned char)((value >> 8) & 0xFF);
+    p_buf[2] = (unsigned char)((value >> 16) & 0xFF);
+    p_buf[3] = (unsigned char)((value >> 24) & 0xFF);
+}
+
+// Read Exactly data_size Bytes (ERR_DATA_PATTERN if Image is Truncated)
+static int read_full(int fd, unsigned char *p_buf, size_t data_size)
+{
+    ssize_t read_len = 0;
+    size_t total_len = 0;
+
+    while(total_len < data_size)
+    {
+        read_len = read(fd, &p_buf[total_len], data_size - total_len);
+        if(read_len < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return ERR_FILE_IO_ERROR;
+        }
+        if(read_len == 0)
+            return ERR_DATA_PATTERN;
+        total_len += read_len;
+    }
+
+    return ERR_SUCCESS;
+}
+
+static int write_full(int fd, const unsigned char *p_buf, size_t data_size)
+{
+    ssize_t write_len = 0;
+    size_t total_len = 0;
+
+    while(total_len < data_size)
+    {
+        write_len = write(fd, &p_buf[total_len], data_size - total_len);
+        if(write_len < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            return ERR_FILE_IO_ERROR;
+        }
+        total_len += write_len;
+    }
+
+    return ERR_SUCCESS;
+}
+
+// Decode One Block (Every Length & Offset is Checked against Buffer Bounds)
+static int decode_block(const unsigned char *p_src, size_t src_len, unsigned char *p_dst, size_t dst_len)
+{
+    size_t src_index = 0,
+           dst_index = 0,
+           literal_len = 0,
+           match_len = 0,
+           offset = 0,
+           copy_index = 0;
+    unsigned char token = 0,
+                  ext = 0;
+
+    while(src_index < src_len)
+    {
+        token = p_src[src_index++];
+
+        // Literals
+        literal_len = token >> 4;
+        if(literal_len == 15)
+        {
+            do
+            {
+                if(src_index >= src_len)
+                    return ERR_DATA_PATTERN;
+                ext = p_src[src_index++];
+                literal_len += ext;
+            } while(ext == 255);
+        }
+        if((literal_len > (src_len - src_index)) || (literal_len > (dst_len - dst_index)))
+            return ERR_DATA_PATTERN;
+        memcpy(&p_dst[dst_index], &p_src[src_index], literal_len);
+        src_index += literal_len;
+        dst_index += literal_len;
+
+        // Last Sequence has Literals Only
+        if(src_index == src_len)
+            break;
+
+        // Match
+        if((src_len - src_index) < 2)
+            return ERR_DATA_PATTERN;
+        offset = (size_t)p_src[src_index] | ((size_t)p_src[src_index + 1] << 8);
+        src_index += 2;
+        if((offset == 0) || (offset > dst_index))
+            return ERR_DATA_PATTERN;
+
+        match_len = token & 0x0F;
+        if(match_len == 15)
+        {
+            do
+            {
+                if(src_index >= src_len)
+                    return ERR_DATA_PATTERN;
+                ext = p_src[src_index++];
+                match_len += ext;
+            } while(ext == 255);
+        }
+        match_len += ELAN_FW_COMPRESS_MIN_MATCH;
+        if(match_len > (dst_len - dst_index))
+            return ERR_DATA_PATTERN;
+
+        // Overlapped Match Repeats the Last offset Bytes
+        if(offset >= match_len)
+            memcpy(&p_dst[dst_index], &p_dst[dst_index - offset], match_len);
+        else
+        {
+            for(copy_index = 0; copy_index < match_len; copy_index++)
+                p_dst[dst_index + copy_index] = p_dst[dst_index - offset + copy_index];
+        }
+        dst_index += match_len;
+    }
+
+    return (dst_index == dst_len) ? ERR_SUCCESS : ERR_DATA_PATTERN;
+}
+
+// Append One Sequence (offset 0: Last Sequence, Literals Only). ERR_DATA_PATTERN if It does not Fit.
+static int encode_sequence(unsigned char *p_dst, size_t dst_size, size_t *p_dst_index, const unsigned char *p_literal, size_t literal_len, size_t offset, size_t match_len)
+{
+    size_t dst_index = *p_dst_index,
+           len = 0;
+    unsigned char token = 0;
+
+    // Worst Case: Token + Literal Length Ext. + Literals + Offset + Match Length Ext.
+    if((dst_index + 1 + (literal_len / 255 + 1) + literal_len + 2 + (match_len / 255 + 1)) > dst_size)
+        return ERR_DATA_PATTERN;
+
+    token = (unsigned char)(((literal_len >= 15) ? 15 : literal_len) << 4);
+    if(offset != 0)
+        token |= (unsigned char)(((match_len - ELAN_FW_COMPRESS_MIN_MATCH) >= 15) ? 15 : (match_len - ELAN_FW_COMPRESS_MIN_MATCH));
+    p_dst[dst_index++] = token;
+
+    if(literal_len >= 15)
+    {
+        for(len = literal_len - 15; len >= 255; len -= 255)
+            p_dst[dst_index++] = 255;
+        p_dst[dst_index++] = (unsigned char)len;
+    }
+    memcpy(&p_dst[dst_index], p_literal, literal_len);
+    dst_index += literal_len;
+
+    if(offset != 0)
+    {
+        p_dst[dst_index++] = (unsigned char)(offset & 0xFF);
+        p_dst[dst_index++] = (unsigned char)((offset >> 8) & 0xFF);
+        if((match_len - ELAN_FW_COMPRESS_MIN_MATCH) >= 15)
+        {
+            for(len = match_len - ELAN_FW_COMPRESS_MIN_MATCH - 15; len >= 255; len -= 255)
+                p_dst[dst_index++] = 255;
+            p_dst[dst_index++] = (unsigned char)len;
+        }
+    }
+
+    *p_dst_index = dst_index;
+    return ERR_SUCCESS;
+}
+
+// Encode One Block with Greedy Hash Matching. ERR_DATA_PATTERN if Output would not be Smaller than dst_size.
+static int encode_block(const unsigned char *p_src, size_t src_len, unsigned char *p_dst, size_t dst_size, size_t *p_dst_len, unsigned int *p_hash_table)
+{
+    int err = ERR_SUCCESS;
+    size_t src_index = 0,
+           anchor = 0,
+           ref = 0,
+           match_len = 0,
+           dst_index = 0;
+    unsigned int sequence = 0,
+                 hash = 0;
+
+    // Hash Table Holds Position + 1 (0: Empty)
+    memset(p_hash_table, 0, sizeof(unsigned int) << ELAN_FW_COMPRESS_HASH_BITS);
+
+    while((src_index + ELAN_FW_COMPRESS_MIN_MATCH) <= src_len)
+    {
+        memcpy(&sequence, &p_src[src_index], sizeof(sequence));
+        hash = (sequence * 2654435761U) >> (32 - ELAN_FW_COMPRESS_HASH_BITS);
+        ref = p_hash_table[hash];
+        p_hash_table[hash] = (unsigned int)(src_index + 1);
+
+        if((ref == 0) || ((src_index - (ref - 1)) > ELAN_FW_COMPRESS_MAX_OFFSET) || \
+           (memcmp(&p_src[ref - 1], &p_src[src_index], ELAN_FW_COMPRESS_MIN_MATCH) != 0))
+        {
+            src_index++;
+            continue;
+        }
+        ref--;
+
+        for(match_len = ELAN_FW_COMPRESS_MIN_MATCH; ((src_index + match_len) < src_len) && (p_src[ref + match_len] == p_src[src_index + match_len]); match_len++);
+
+        err = encode_sequence(p_dst, dst_size, &dst_index, &p_src[anchor], src_index - anchor, src_index - ref, match_len);
+        if(err != ERR_SUCCESS)
+            return err;
+
+        src_index += match_len;
+        anchor = src_index;
+    }
+
+    // Last Literals
+    err = encode_sequence(p_dst, dst_size, &dst_index, &p_src[anchor], src_len - anchor, 0, 0);
+    if(err != ERR_SUCCESS)
+        return err;
+
+    *p_dst_len = dst_index;
+    return ERR_SUCCESS;
+}
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Checksum (FNV-1a, 32-bit)
+unsigned int compute_firmware_checksum(const unsigned char *p_data, size_t data_size)
+{
+    unsigned int hash = 2166136261U;
+    size_t index = 0;
+
+    for(index = 0; index < data_size; index++)
+    {
+        hash ^= p_data[index];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+// Header
+bool is_compressed_firmware(int fd)
+{
+    unsigned char magic[ELAN_FW_COMPRESS_MAGIC_SIZE] = {0};
+
+    if(pread(fd, magic, sizeof(magic), 0) != (ssize_t)sizeof(magic))
+        return false;
+
+    return (memcmp(magic, ELAN_FW_COMPRESS_MAGIC, ELAN_FW_COMPRESS_MAGIC_SIZE) == 0);
+}
+
+int read_compressed_firmware_header(int fd, struct fw_compress_header *p_header)
+{
+    int err = ERR_SUCCESS;
+    unsigned char header_buf[ELAN_FW_COMPRESS_HEADER_SIZE] = {0};
+
+    // Validate Input Parameter
+    if((fd < 0) || (p_header == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (fd=%d, p_header=0x%p)\r\n", __func__, fd, p_header);
+        err = ERR_INVALID_PARAM;
+        goto READ_COMPRESSED_FIRMWARE_HEADER_EXIT;
+    }
+
+    if(pread(fd, header_buf, sizeof(header_buf), 0) != (ssize_t)sizeof(header_buf))
+    {
+        ERROR_PRINTF("%s: Fail to Read Header! errno=%d.\r\n", __func__, errno);
+        err = ERR_DATA_PATTERN;
+        goto READ_COMPRESSED_FIRMWARE_HEADER_EXIT;
+    }
+
+    if(memcmp(header_buf, ELAN_FW_COMPRESS_MAGIC, ELAN_FW_COMPRESS_MAGIC_SIZE) != 0)
+    {
+        ERROR_PRINTF("%s: Not a Compressed Firmware Image!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto READ_COMPRESSED_FIRMWARE_HEADER_EXIT;
+    }
+
+    p_header->raw_size = read_le32(&header_buf[4]);
+    p_header->block_size = read_le32(&header_buf[8]);
+    p_header->raw_checksum = read_le32(&header_buf[12]);
+
+    if((p_header->raw_size == 0) || (p_header->raw_size > ELAN_FW_COMPRESS_RAW_SIZE_MAX) || \
+       (p_header->block_size == 0) || (p_header->block_size > ELAN_FW_COMPRESS_BLOCK_SIZE_MAX))
+    {
+        ERROR_PRINTF("%s: Invalid Header! (raw_size=%u, block_size=%u)\r\n", __func__, p_header->raw_size, p_header->block_size);
+        err = ERR_DATA_PATTERN;
+        goto READ_COMPRESSED_FIRMWARE_HEADER_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+READ_COMPRESSED_FIRMWARE_HEADER_EXIT:
+    return err;
+}
+
+// Decompression:
+// Image is Sized from Header up front, then Blocks are Read one at a Time and Decoded (Stored Blocks Read)
+// Straight into the Mapped Anonymous Memory File, so Page Counts, Mapping & Frame Reads Work as for a Raw File.
+int decompress_firmware_file(int fd, int *p_raw_fd, int *p_raw_size)
+{
+    int err = ERR_SUCCESS,
+        raw_fd = -1;
+    unsigned int raw_offset = 0,
+                 block_raw_len = 0,
+                 block_len = 0,
+                 raw_checksum = 0;
+    bool stored = false;
+    unsigned char block_len_buf[4] = {0},
+                  *p_raw = (unsigned char *)MAP_FAILED,
+                  *p_block = NULL;
+    struct fw_compress_header header;
+
+    // Validate Input Parameter
+    if((fd < 0) || (p_raw_fd == NULL) || (p_raw_size == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (fd=%d, p_raw_fd=0x%p, p_raw_size=0x%p)\r\n", __func__, fd, p_raw_fd, p_raw_size);
+        err = ERR_INVALID_PARAM;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT;
+    }
+
+    err = read_compressed_firmware_header(fd, &header);
+    if(err != ERR_SUCCESS)
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT;
+
+    // Decompressed Image (Anonymous Memory File, Sized from Header)
+    raw_fd = memfd_create("elants_fw_image", MFD_CLOEXEC);
+    if(raw_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Memory File! errno=%d.\r\n", __func__, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT;
+    }
+    if(ftruncate(raw_fd, header.raw_size) < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Size Memory File (%u Bytes)! errno=%d.\r\n", __func__, header.raw_size, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT_1;
+    }
+    p_raw = (unsigned char *)mmap(NULL, header.raw_size, PROT_READ | PROT_WRITE, MAP_SHARED, raw_fd, 0);
+    if(p_raw == (unsigned char *)MAP_FAILED)
+    {
+        ERROR_PRINTF("%s: Fail to Map Memory File! errno=%d.\r\n", __func__, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT_1;
+    }
+
+    // Compressed Blocks are never Larger than Block Size (Larger Ones are Stored)
+    p_block = (unsigned char *)malloc(header.block_size);
+    if(p_block == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Allocate Block Buffer (%u Bytes)!\r\n", __func__, header.block_size);
+        err = ERR_NO_MEMORY;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT_2;
+    }
+
+    // Stream Blocks
+    if(lseek(fd, ELAN_FW_COMPRESS_HEADER_SIZE, SEEK_SET) < 0)
+    {
+        err = ERR_FILE_IO_ERROR;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT_2;
+    }
+    for(raw_offset = 0; raw_offset < header.raw_size; raw_offset += block_raw_len)
+    {
+        block_raw_len = ((header.raw_size - raw_offset) < header.block_size) ? (header.raw_size - raw_offset) : header.block_size;
+
+        err = read_full(fd, block_len_buf, sizeof(block_len_buf));
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Read Block Length (Offset 0x%x)! err=0x%x.\r\n", __func__, raw_offset, err);
+            goto DECOMPRESS_FIRMWARE_FILE_EXIT_2;
+        }
+        block_len = read_le32(block_len_buf);
+        stored = ((block_len & ELAN_FW_COMPRESS_STORED_FLAG) != 0);
+        block_len &= ~ELAN_FW_COMPRESS_STORED_FLAG;
+
+        if((stored == true) ? (block_len != block_raw_len) : ((block_len == 0) || (block_len > header.block_size)))
+        {
+            ERROR_PRINTF("%s: Invalid Block Length %u (Offset 0x%x)!\r\n", __func__, block_len, raw_offset);
+            err = ERR_DATA_PATTERN;
+            goto DECOMPRESS_FIRMWARE_FILE_EXIT_2;
+        }
+
+        if(stored == true)
+            err = read_full(fd, &p_raw[raw_offset], block_len);
+        else
+        {
+            err = read_full(fd, p_block, block_len);
+            if(err == ERR_SUCCESS)
+                err = decode_block(p_block, block_len, &p_raw[raw_offset], block_raw_len);
+        }
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Decompress Block (Offset 0x%x)! err=0x%x.\r\n", __func__, raw_offset, err);
+            goto DECOMPRESS_FIRMWARE_FILE_EXIT_2;
+        }
+    }
+
+    // Checksum of Whole Image
+    raw_checksum = compute_firmware_checksum(p_raw, header.raw_size);
+    if(raw_checksum != header.raw_checksum)
+    {
+        ERROR_PRINTF("%s: Checksum Mismatched! (0x%08x, Expected 0x%08x)\r\n", __func__, raw_checksum, header.raw_checksum);
+        err = ERR_DATA_PATTERN;
+        goto DECOMPRESS_FIRMWARE_FILE_EXIT_2;
+    }
+
+    DEBUG_PRINTF("%s: %u Bytes Decompressed (Block Size %u).\r\n", __func__, header.raw_size, header.block_size);
+    *p_raw_fd = raw_fd;
+    *p_raw_size = (int)header.raw_size;
+    raw_fd = -1;
+
+    // Success
+    err = ERR_SUCCESS;
+
+DECOMPRESS_FIRMWARE_FILE_EXIT_2:
+    free(p_block);
+    munmap(p_raw, header.raw_size);
+
+DECOMPRESS_FIRMWARE_FILE_EXIT_1:
+    if(raw_fd >= 0)
+        close(raw_fd);
+
+DECOMPRESS_FIRMWARE_FILE_EXIT:
+    return err;
+}
+
+// Compression
+int compress_firmware_file(const char *p_src_filename, const char *p_dst_filename, message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS,
+        src_fd = -1,
+        dst_fd = -1;
+    unsigned int raw_size = 0,
+                 raw_offset = 0,
+                 block_raw_len = 0,
+                 compressed_size = ELAN_FW_COMPRESS_HEADER_SIZE;
+    size_t block_len = 0;
+    unsigned char header_buf[ELAN_FW_COMPRESS_HEADER_SIZE] = {0},
+                  block_len_buf[4] = {0},
+                  *p_raw = (unsigned char *)MAP_FAILED,
+                  *p_block = NULL;
+    unsigned int *p_hash_table = NULL;
+    struct stat file_stat;
+
+    // Validate Input Parameter
+    if((p_src_filename == NULL) || (p_dst_filename == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_src_filename=0x%p, p_dst_filename=0x%p)\r\n", __func__, p_src_filename, p_dst_filename);
+        err = ERR_INVALID_PARAM;
+        goto COMPRESS_FIRMWARE_FILE_EXIT;
+    }
+
+    // Map Source Image
+    src_fd = open(p_src_filename, O_RDONLY);
+    if(src_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Open \"%s\"! errno=%d.\r\n", __func__, p_src_filename, errno);
+        err = ERR_FILE_NOT_FOUND;
+        goto COMPRESS_FIRMWARE_FILE_EXIT;
+    }
+    if(is_compressed_firmware(src_fd) == true)
+    {
+        ERROR_PRINTF("%s: \"%s\" is Compressed Already!\r\n", __func__, p_src_filename);
+        err = ERR_INVALID_PARAM;
+        goto COMPRESS_FIRMWARE_FILE_EXIT_1;
+    }
+    if((fstat(src_fd, &file_stat) < 0) || (file_stat.st_size <= 0) || (file_stat.st_size > ELAN_FW_COMPRESS_RAW_SIZE_MAX))
+    {
+        ERROR_PRINTF("%s: Invalid Firmware File Size!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto COMPRESS_FIRMWARE_FILE_EXIT_1;
+    }
+    raw_size = (unsigned int)file_stat.st_size;
+    p_raw = (unsigned char *)mmap(NULL, raw_size, PROT_READ, MAP_PRIVATE, src_fd, 0);
+    if(p_raw == (unsigned char *)MAP_FAILED)
+    {
+        ERROR_PRINTF("%s: Fail to Map \"%s\"! errno=%d.\r\n", __func__, p_src_filename, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto COMPRESS_FIRMWARE_FILE_EXIT_1;
+    }
+
+    p_block = (unsigned char *)malloc(ELAN_FW_COMPRESS_BLOCK_SIZE);
+    p_hash_table = (unsigned int *)malloc(sizeof(unsigned int) << ELAN_FW_COMPRESS_HASH_BITS);
+    if((p_block == NULL) || (p_hash_table == NULL))
+    {
+        ERROR_PRINTF("%s: Fail to Allocate Buffers!\r\n", __func__);
+        err = ERR_NO_MEMORY;
+        goto COMPRESS_FIRMWARE_FILE_EXIT_2;
+    }
+
+    // Create Compressed Image
+    dst_fd = open(p_dst_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(dst_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create \"%s\"! errno=%d.\r\n", __func__, p_dst_filename, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto COMPRESS_FIRMWARE_FILE_EXIT_2;
+    }
+
+    // Header
+    memcpy(header_buf, ELAN_FW_COMPRESS_MAGIC, ELAN_FW_COMPRESS_MAGIC_SIZE);
+    write_le32(&header_buf[4], raw_size);
+    write_le32(&header_buf[8], ELAN_FW_COMPRESS_BLOCK_SIZE);
+    write_le32(&header_buf[12], compute_firmware_checksum(p_raw, raw_size));
+    err = write_full(dst_fd, header_buf, sizeof(header_buf));
+    if(err != ERR_SUCCESS)
+        goto COMPRESS_FIRMWARE_FILE_EXIT_3;
+
+    // Blocks (Stored if Compression does not Help)
+    for(raw_offset = 0; raw_offset < raw_size; raw_offset += block_raw_len)
+    {
+        block_raw_len = ((raw_size - raw_offset) < ELAN_FW_COMPRESS_BLOCK_SIZE) ? (raw_size - raw_offset) : ELAN_FW_COMPRESS_BLOCK_SIZE;
+
+        if(encode_block(&p_raw[raw_offset], block_raw_len, p_block, block_raw_len - 1, &block_len, p_hash_table) == ERR_SUCCESS)
+        {
+            write_le32(block_len_buf, (unsigned int)block_len);
+            err = write_full(dst_fd, block_len_buf, sizeof(block_len_buf));
+            if(err == ERR_SUCCESS)
+                err = write_full(dst_fd, p_block, block_len);
+        }
+        else
+        {
+            block_len = block_raw_len;
+            write_le32(block_len_buf, (unsigned int)block_len | ELAN_FW_COMPRESS_STORED_FLAG);
+            err = write_full(dst_fd, block_len_buf, sizeof(block_len_buf));
+            if(err == ERR_SUCCESS)
+                err = write_full(dst_fd, &p_raw[raw_offset], block_len);
+        }
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Write \"%s\"! errno=%d.\r\n", __func__, p_dst_filename, errno);
+            goto COMPRESS_FIRMWARE_FILE_EXIT_3;
+        }
+        compressed_size += sizeof(block_len_buf) + block_len;
+    }
+
+    if(msg_mode == FULL_MESSAGE)
+        printf("Compressed \"%s\" (%u Bytes) to \"%s\" (%u Bytes, %u%%).\r\n", \
+               p_src_filename, raw_size, p_dst_filename, compressed_size, (unsigned int)(((unsigned long long)compressed_size * 100) / raw_size));
+
+    // Success
+    err = ERR_SUCCESS;
+
+COMPRESS_FIRMWARE_FILE_EXIT_3:
+    close(dst_fd);
+    if(err != ERR_SUCCESS) // Do not Leave Partial Image
+        unlink(p_dst_filename);
+
+COMPRESS_FIRMWARE_FILE_EXIT_2:
+    free(p_hash_table);
+    free(p_block);
+    munmap(p_raw, raw_size);
+
+COMPRESS_FIRMWARE_FILE_EXIT_1:
+    close(src_fd);
+
+COMPRESS_FIRMWARE_FILE_EXIT:
+    return err;
+}
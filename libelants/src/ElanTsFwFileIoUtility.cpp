@@ -0,0 +1,586 @@
+/** @file
+
+  Implementation of Firmware File I/O Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsFwFileIoUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>     /* close */
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include "ErrCode.h"
+#include "ElanTsFwFileIoUtility.h"
+#include "ElanTsFwCompress.h"
+#include "ElanTsFwBundle.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Firmware File Information
+int  g_firmware_fd = -1;
+
+// Dump File Information
+static int g_dump_fd = -1;
+static pthread_t g_dump_writer_thread;
+static pthread_mutex_t g_dump_queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_dump_queue_not_empty = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t g_dump_queue_not_full = PTHREAD_COND_INITIALIZER;
+static unsigned char g_dump_chunk[DUMP_FILE_QUEUE_DEPTH][DUMP_FILE_CHUNK_SIZE];
+static size_t g_dump_chunk_len[DUMP_FILE_QUEUE_DEPTH];
+static int g_dump_queue_head = 0,   // Next Chunk to Write to File
+           g_dump_queue_tail = 0,   // Chunk being Filled
+           g_dump_queue_count = 0;  // Chunks Ready to Write
+static bool g_dump_closing = false;
+static int g_dump_write_err = ERR_SUCCESS;
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Store file handler of opened FW file in global variable.
+// (Compressed image is decompressed into memory file, so rest of flow sees raw image.)
+static int attach_firmware_file(int fd, const char *filename)
+{
+    int err = ERR_SUCCESS,
+        raw_fd = -1,
+        raw_size = 0;
+
+    // Compressed Image
+    if(is_compressed_firmware(fd))
+    {
+        err = decompress_firmware_file(fd, &raw_fd, &raw_size);
+        close(fd);
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Failed to decompress firmware file \'%s\', err=0x%x.\r\n", __func__, filename, err);
+            return err;
+        }
+        DEBUG_PRINTF("File \"%s\" decompressed, %d bytes.\r\n", filename, raw_size);
+        fd = raw_fd;
+    }
+
+    // Reset Read/Write Position of File Handler
+    lseek(fd, 0, SEEK_SET);
+
+    DEBUG_PRINTF("File \"%s\" opened, fd=%d.\r\n", filename, fd);
+    g_firmware_fd = fd;
+
+    return ERR_SUCCESS;
+}
+
+// Make sure filename valid and no FW file opened.
+static int check_firmware_filename(char *filename, size_t filename_len)
+{
+    // Make Sure Filename Valid
+    if(filename == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Filename String Pointer!\r\n", __func__);
+        return ERR_INVALID_PARAM;
+    }
+
+    // Make Sure Filename Length Valid
+    if(filename_len == 0)
+    {
+        ERROR_PRINTF("%s: Filename String Length is Zero!\r\n", __func__);
+        return ERR_INVALID_PARAM;
+    }
+
+    // Make Sure File Not Been Opened
+    if(g_firmware_fd >= 0)
+    {
+        ERROR_PRINTF("%s: File \'%s\' has been opened. fd=%d.\r\n", __func__, filename, g_firmware_fd);
+        return EBUSY;
+    }
+
+    return ERR_SUCCESS;
+}
+
+// Open FW file and store file handler in global variable.
+int open_firmware_file(char *filename, size_t filename_len)
+{
+    int err = ERR_SUCCESS,
+        fd = 0;
+
+    err = check_firmware_filename(filename, filename_len);
+    if(err != ERR_SUCCESS)
+        goto OPEN_FIRMWARE_FILE_EXIT;
+
+    // Open File
+    DEBUG_PRINTF("Open file \"%s\".\r\n", filename);
+    fd = open(filename, O_RDONLY);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Failed to open firmware file \'%s\', errno=%d.\r\n", __func__, filename, errno);
+        err = ERR_FILE_NOT_FOUND;
+        goto OPEN_FIRMWARE_FILE_EXIT;
+    }
+
+    err = attach_firmware_file(fd, filename);
+
+OPEN_FIRMWARE_FILE_EXIT:
+    return err;
+}
+
+// Open FW image of (FWID, generation) in FW bundle and store file handler in global variable.
+int open_firmware_bundle_file(char *filename, size_t filename_len, unsigned short fwid, int generation)
+{
+    int err = ERR_SUCCESS,
+        fd = -1;
+
+    err = check_firmware_filename(filename, filename_len);
+    if(err != ERR_SUCCESS)
+        goto OPEN_FIRMWARE_BUNDLE_FILE_EXIT;
+
+    // Select Image of Bundle
+    DEBUG_PRINTF("Open bundle \"%s\", FWID 0x%04x, Gen%d.\r\n", filename, fwid, generation);
+    err = extract_firmware_bundle_entry(filename, fwid, generation, &fd);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Failed to select firmware of FWID 0x%04x from bundle \'%s\', err=0x%x.\r\n", __func__, fwid, filename, err);
+        goto OPEN_FIRMWARE_BUNDLE_FILE_EXIT;
+    }
+
+    err = attach_firmware_file(fd, filename);
+
+OPEN_FIRMWARE_BUNDLE_FILE_EXIT:
+    return err;
+}
+
+// Close FW file with file handler stored in global variable.
+int close_firmware_file(void)
+{
+    int err = ERR_SUCCESS;
+
+    if(g_firmware_fd >= 0)
+    {
+        // Close File
+        err = close(g_firmware_fd);
+        if(err < 0)
+        {
+            ERROR_PRINTF("Failed to close firmware file(fd=%d), errno=%d.\r\n", g_firmware_fd, errno);
+            err = ERR_IO_ERROR;
+            goto CLOSE_FIRMWARE_FILE_EXIT;
+        }
+
+        // Reset File Descriptor
+        g_firmware_fd = -1;
+    }
+
+CLOSE_FIRMWARE_FILE_EXIT:
+    return err;
+}
+
+int get_firmware_size(int *firmware_size)
+{
+    int err = ERR_SUCCESS;
+    struct stat file_stat;
+
+    // Make Sure File Handler is Valid
+    if(g_firmware_fd < 0)
+    {
+        ERROR_PRINTF("%s: FW file has not been opened. firmware_fd=%d.\r\n", __func__, g_firmware_fd);
+        err = EBADFD;
+        goto GET_FIRMWARE_SIZE_EXIT;
+    }
+
+    // Get File Status
+    err = fstat(g_firmware_fd, &file_stat);
+    if(err < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Get Firmware File Size! errno=%d.\r\n", __func__, errno);
+        err = ERR_FILE_NOT_FOUND;
+    }
+    else
+    {
+        //DEBUG_PRINTF("%s: File Size = %zd.\r\n", __func__, file_stat.st_size);
+        *firmware_size = file_stat.st_size;
+        err = ERR_SUCCESS;
+    }
+
+GET_FIRMWARE_SIZE_EXIT:
+    return err;
+}
+
+int compute_firmware_page_number(int firmware_size)
+{
+    /*******************************
+    * [ELAN Firmware Page]
+    * Address:    1 Word (= 2 Byte)
+    * Page Data: 64 Word
+    * Checksum:   1 Word
+    * ------------------------------
+    * Total: 1 + 64 + 1 = 66 Word
+    *                   = 132 Byte
+    *******************************/
+    return ((firmware_size / ELAN_FIRMWARE_PAGE_SIZE) + ((firmware_size % ELAN_FIRMWARE_PAGE_SIZE) != 0));
+}
+
+int retrieve_data_from_firmware(unsigned char *data, int data_size)
+{
+    int err = ERR_SUCCESS,
+        read_byte = 0;
+
+    // Make Sure Page Data Buffer Valid
+    if(data == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Page Data Buffer!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto RETRIEVE_DATA_FROM_FIRMWARE_EXIT;
+    }
+
+    // Make Sure Page Data Buffer Size Valid
+    if(data_size == 0)
+    {
+        ERROR_PRINTF("%s: Data Buffer Size is Zero!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto RETRIEVE_DATA_FROM_FIRMWARE_EXIT;
+    }
+
+    // Read Data from File
+    read_byte = read(g_firmware_fd, data, data_size);
+    if(read_byte != data_size)
+    {
+        ERROR_PRINTF("%s: Fail to get %d bytes from fd %d! (read_byte=%d, errno=%d)\r\n", __func__, data_size, g_firmware_fd, read_byte, errno);
+        err = ERR_GET_DATA_FAIL;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+RETRIEVE_DATA_FROM_FIRMWARE_EXIT:
+    return err;
+}
+
+// Map Whole FW File (Read-Only), R/W Position of File Handler is not Changed.
+int map_firmware_file(unsigned char **pp_firmware_data, int *p_firmware_size)
+{
+    int err = ERR_SUCCESS,
+        firmware_size = 0;
+    void *p_map = MAP_FAILED;
+
+    // Validate Input Parameter
+    if((pp_firmware_data == NULL) || (p_firmware_size == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (pp_firmware_data=0x%p, p_firmware_size=0x%p)\r\n", __func__, pp_firmware_data, p_firmware_size);
+        err = ERR_INVALID_PARAM;
+        goto MAP_FIRMWARE_FILE_EXIT;
+    }
+
+    // Get FW Size
+    err = get_firmware_size(&firmware_size);
+    if(err != ERR_SUCCESS)
+        goto MAP_FIRMWARE_FILE_EXIT;
+    if(firmware_size <= 0)
+    {
+        ERROR_PRINTF("%s: Empty Firmware File!\r\n", __func__);
+        err = ERR_DATA_PATTERN;
+        goto MAP_FIRMWARE_FILE_EXIT;
+    }
+
+    // Map File
+    p_map = mmap(NULL, firmware_size, PROT_READ, MAP_PRIVATE, g_firmware_fd, 0);
+    if(p_map == MAP_FAILED)
+    {
+        ERROR_PRINTF("%s: Fail to Map Firmware File! errno=%d.\r\n", __func__, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto MAP_FIRMWARE_FILE_EXIT;
+    }
+
+    *pp_firmware_data = (unsigned char *)p_map;
+    *p_firmware_size = firmware_size;
+    err = ERR_SUCCESS;
+
+MAP_FIRMWARE_FILE_EXIT:
+    return err;
+}
+
+int unmap_firmware_file(unsigned char *p_firmware_data, int firmware_size)
+{
+    if((p_firmware_data == NULL) || (firmware_size <= 0))
+        return ERR_SUCCESS;
+
+    if(munmap(p_firmware_data, firmware_size) < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Unmap Firmware File! errno=%d.\r\n", __func__, errno);
+        return ERR_FILE_IO_ERROR;
+    }
+
+    return ERR_SUCCESS;
+}
+
+// Remark ID
+int get_remark_id_from_firmware(unsigned short *p_remark_id)
+{
+    int err = ERR_SUCCESS,
+        read_byte = 0;
+    unsigned char data[2] = {0};
+    unsigned short remark_id = 0;
+    off_t result = 0,
+          file_cur_position = 0;
+
+    //
+    // Validate Input Parameters
+    //
+
+    // Remark ID Buffer
+    if (p_remark_id == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_remark_id=0x%p)\r\n", __func__, p_remark_id);
+        err = ERR_INVALID_PARAM;
+        goto GET_REMARK_ID_FROM_FW_EXIT;
+    }
+
+    //
+    // Save Current R/W Position of File Handler
+    //
+    result = lseek(g_firmware_fd, 0, SEEK_CUR);
+    if(result < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Get Current File R/W Position! (result=%ld, errno=%d)\r\n", __func__, result, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto GET_REMARK_ID_FROM_FW_EXIT;
+    }
+    file_cur_position = result;
+    //DEBUG_PRINTF("%s: Current File R/W Position: %ld.\r\n", __func__, file_cur_position);
+
+    //
+    // Get Remark ID from eKT FW File
+    //
+
+    // Re-locate File R/W Position to '-4' (the Last 4 Byte) from the End of File.
+    lseek(g_firmware_fd, -4L, SEEK_END);
+
+    // Read Data from File
+    read_byte = read(g_firmware_fd, data, 2);  // 15 63 XX XX
+    if(read_byte != 2)
+    {
+        err = ERR_GET_DATA_FAIL;
+        ERROR_PRINTF("%s: Fail to get 2 bytes of remark_id from fd %d! (read_byte=%d, errno=%d)\r\n", __func__, g_firmware_fd, read_byte, errno);
+        goto GET_REMARK_ID_FROM_FW_EXIT_1;
+    }
+
+    // Read FW Remark ID
+    //remark_id = data[0] + (data[1] << 8);
+    remark_id = TWO_BYTE_ARRAY_TO_WORD(data);
+    DEBUG_PRINTF("%s: Remark ID: %04x.\r\n", __func__, remark_id);
+
+    // Load Remark ID to Input Buffer
+    *p_remark_id = remark_id;
+
+    // Success
+    err = ERR_SUCCESS;
+
+GET_REMARK_ID_FROM_FW_EXIT_1:
+
+    //
+    // Restore to Current R/W Position of File Handler
+    //
+    //DEBUG_PRINTF("%s: Restore File R/W Position to %ld.\r\n", __func__, file_cur_position);
+    lseek(g_firmware_fd, file_cur_position, SEEK_SET);
+
+GET_REMARK_ID_FROM_FW_EXIT:
+
+    return err;
+}
+
+// Dump File Writer Thread: Write Queued Chunks to File, while Caller Keeps Reading from Device.
+static void *dump_file_writer(void *p_arg)
+{
+    int chunk_index = 0;
+    size_t chunk_len = 0,
+           write_len = 0;
+    ssize_t result = 0;
+
+    (void)p_arg;
+
+    pthread_mutex_lock(&g_dump_queue_mutex);
+    while(true)
+    {
+        while((g_dump_queue_count == 0) && (g_dump_closing == false))
+            pthread_cond_wait(&g_dump_queue_not_empty, &g_dump_queue_mutex);
+        if(g_dump_queue_count == 0) // Closing & All Chunks Written
+            break;
+
+        chunk_index = g_dump_queue_head;
+        chunk_len = g_dump_chunk_len[chunk_index];
+        pthread_mutex_unlock(&g_dump_queue_mutex);
+
+        // Write Chunk without Holding Lock
+        for(write_len = 0; (write_len < chunk_len) && (g_dump_write_err == ERR_SUCCESS); write_len += result)
+        {
+            result = write(g_dump_fd, &g_dump_chunk[chunk_index][write_len], chunk_len - write_len);
+            if(result < 0)
+            {
+                if(errno == EINTR)
+                {
+                    result = 0;
+                    continue;
+                }
+                ERROR_PRINTF("%s: Fail to Write Dump File! errno=%d.\r\n", __func__, errno);
+                g_dump_write_err = ERR_FILE_IO_ERROR;
+            }
+        }
+
+        pthread_mutex_lock(&g_dump_queue_mutex);
+        g_dump_queue_head = (g_dump_queue_head + 1) % DUMP_FILE_QUEUE_DEPTH;
+        g_dump_queue_count--;
+        pthread_cond_signal(&g_dump_queue_not_full);
+    }
+    pthread_mutex_unlock(&g_dump_queue_mutex);
+
+    return NULL;
+}
+
+// Open Dump File & Start Writer Thread
+int open_dump_file(char *filename, size_t filename_len)
+{
+    int err = ERR_SUCCESS,
+        fd = -1;
+
+    // Validate Input Parameter
+    if((filename == NULL) || (filename_len == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (filename=0x%p, filename_len=%ld)\r\n", __func__, filename, filename_len);
+        err = ERR_INVALID_PARAM;
+        goto OPEN_DUMP_FILE_EXIT;
+    }
+
+    // Make Sure File Not Been Opened
+    if(g_dump_fd >= 0)
+    {
+        ERROR_PRINTF("%s: Dump file has been opened. fd=%d.\r\n", __func__, g_dump_fd);
+        err = EBUSY;
+        goto OPEN_DUMP_FILE_EXIT;
+    }
+
+    // Create File
+    DEBUG_PRINTF("Create dump file \"%s\".\r\n", filename);
+    fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Failed to create dump file \'%s\', errno=%d.\r\n", __func__, filename, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto OPEN_DUMP_FILE_EXIT;
+    }
+
+    // Reset Write Queue
+    g_dump_fd = fd;
+    g_dump_queue_head = 0;
+    g_dump_queue_tail = 0;
+    g_dump_queue_count = 0;
+    g_dump_chunk_len[0] = 0;
+    g_dump_closing = false;
+    g_dump_write_err = ERR_SUCCESS;
+
+    // Start Writer Thread
+    if(pthread_create(&g_dump_writer_thread, NULL, dump_file_writer, NULL) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Dump File Writer Thread!\r\n", __func__);
+        close(fd);
+        g_dump_fd = -1;
+        err = ERR_IO_ERROR;
+        goto OPEN_DUMP_FILE_EXIT;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+OPEN_DUMP_FILE_EXIT:
+    return err;
+}
+
+// Append Data to Dump File (Queued, Blocked only when Writer Falls Behind)
+int write_dump_file(const unsigned char *p_data, size_t data_size)
+{
+    int err = ERR_SUCCESS;
+    size_t copy_len = 0;
+
+    // Validate Input Parameter
+    if((p_data == NULL) || (g_dump_fd < 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_data=0x%p, dump_fd=%d)\r\n", __func__, p_data, g_dump_fd);
+        err = ERR_INVALID_PARAM;
+        goto WRITE_DUMP_FILE_EXIT;
+    }
+
+    pthread_mutex_lock(&g_dump_queue_mutex);
+    while((data_size > 0) && (g_dump_write_err == ERR_SUCCESS))
+    {
+        // Fill Current Chunk
+        copy_len = DUMP_FILE_CHUNK_SIZE - g_dump_chunk_len[g_dump_queue_tail];
+        if(copy_len > data_size)
+            copy_len = data_size;
+        memcpy(&g_dump_chunk[g_dump_queue_tail][g_dump_chunk_len[g_dump_queue_tail]], p_data, copy_len);
+        g_dump_chunk_len[g_dump_queue_tail] += copy_len;
+        p_data += copy_len;
+        data_size -= copy_len;
+
+        // Hand Full Chunk to Writer
+        if(g_dump_chunk_len[g_dump_queue_tail] == DUMP_FILE_CHUNK_SIZE)
+        {
+            // Keep One Chunk Free for Filling (Writer Always Drains Queue, even after Error)
+            while(g_dump_queue_count >= (DUMP_FILE_QUEUE_DEPTH - 1))
+                pthread_cond_wait(&g_dump_queue_not_full, &g_dump_queue_mutex);
+
+            g_dump_queue_count++;
+            g_dump_queue_tail = (g_dump_queue_tail + 1) % DUMP_FILE_QUEUE_DEPTH;
+            g_dump_chunk_len[g_dump_queue_tail] = 0;
+            pthread_cond_signal(&g_dump_queue_not_empty);
+        }
+    }
+    err = g_dump_write_err;
+    pthread_mutex_unlock(&g_dump_queue_mutex);
+
+WRITE_DUMP_FILE_EXIT:
+    return err;
+}
+
+// Flush Queued Data, Stop Writer Thread & Close Dump File
+int close_dump_file(void)
+{
+    int err = ERR_SUCCESS;
+
+    if(g_dump_fd < 0)
+        return ERR_SUCCESS;
+
+    pthread_mutex_lock(&g_dump_queue_mutex);
+    if(g_dump_chunk_len[g_dump_queue_tail] > 0) // Partial Chunk
+    {
+        while(g_dump_queue_count >= (DUMP_FILE_QUEUE_DEPTH - 1))
+            pthread_cond_wait(&g_dump_queue_not_full, &g_dump_queue_mutex);
+        g_dump_queue_count++;
+        g_dump_queue_tail = (g_dump_queue_tail + 1) % DUMP_FILE_QUEUE_DEPTH;
+        g_dump_chunk_len[g_dump_queue_tail] = 0;
+    }
+    g_dump_closing = true;
+    pthread_cond_signal(&g_dump_queue_not_empty);
+    pthread_mutex_unlock(&g_dump_queue_mutex);
+
+    // Wait for Writer Thread
+    pthread_join(g_dump_writer_thread, NULL);
+    err = g_dump_write_err;
+
+    // Close File
+    if(close(g_dump_fd) < 0)
+    {
+        ERROR_PRINTF("%s: Failed to close dump file(fd=%d), errno=%d.\r\n", __func__, g_dump_fd, errno);
+        if(err == ERR_SUCCESS)
+            err = ERR_FILE_IO_ERROR;
+    }
+    g_dump_fd = -1;
+
+    return err;
+}
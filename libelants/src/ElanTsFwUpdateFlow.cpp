@@ -15,10 +15,13 @@
 
 **/
 
+#include <time.h>
 #include "InterfaceGet.h"
+#include "ElanTsHidUtility.h"
 #include "ElanTsFuncApi.h"
 #include "ElanTsFwFileIoUtility.h"
 #include "ElanTsFwUpdateFlow.h"
+#include "ElanTsGenFlow.h"
 #include "ElanGen8TsFwFileIoUtility.h"
 
 /***************************************************
@@ -50,32 +53,18 @@ int get_firmware_information(message_mode_t msg_mode)
     {
         printf("--------------------------------\r\n");
 
-        // FW ID
-        err = get_firmware_id(&fw_id);
+        // FW ID, Firmware Version, Test Version & Boot Code Version
+        err = get_firmware_info(&fw_id, &fw_version, &test_version, &bc_version, false);
         if(err != ERR_SUCCESS)
             goto GET_FW_INFO_EXIT;
-        printf("Firmware ID: %02x.%02x\r\n", HIGH_BYTE(fw_id), LOW_BYTE(fw_id));
 
-        // Firmware Version
-        err = get_fw_version(&fw_version);
-        if(err != ERR_SUCCESS)
-            goto GET_FW_INFO_EXIT;
+        printf("Firmware ID: %02x.%02x\r\n", HIGH_BYTE(fw_id), LOW_BYTE(fw_id));
         printf("Firmware Version: %02x.%02x\r\n", HIGH_BYTE(fw_version), LOW_BYTE(fw_version));
-
-        // Test Version
-        err = get_test_version(&test_version);
-        if(err != ERR_SUCCESS)
-            goto GET_FW_INFO_EXIT;
         /* [Note] 2022/05/03
          * Change Output String of Test Version for FAE's Request.
          */
         //printf("Test Version: %02x.%02x\r\n", HIGH_BYTE(test_version), LOW_BYTE(test_version));
         printf("Test-Solution Version: %02x.%02x\r\n", HIGH_BYTE(test_version), LOW_BYTE(test_version));
-
-        // Boot Code Version
-        err = get_boot_code_version(&bc_version);
-        if(err != ERR_SUCCESS)
-            goto GET_FW_INFO_EXIT;
         printf("Boot Code Version: %02x.%02x\r\n", HIGH_BYTE(bc_version), LOW_BYTE(bc_version));
     }
 
@@ -465,3 +454,19 @@ UPDATE_FIRMWARE_EXIT:
     return err;
 }
 
+// Firmware Verification (Gen5/Gen6/Gen7 Instance of Generation Flow Engine)
+int check_firmware_verifiable(void)
+{
+    return check_flash_pages_verifiable<ts_gen5_traits>();
+}
+
+int verify_firmware(message_mode_t msg_mode)
+{
+    return verify_flash_pages<ts_gen5_traits>(msg_mode);
+}
+
+// Flash Dump: Address in Word (Gen5/Gen6/Gen7 Instance of Generation Flow Engine)
+int dump_flash(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode)
+{
+    return dump_flash_blocks<ts_gen5_traits>(filename, filename_len, address, size, msg_mode);
+}
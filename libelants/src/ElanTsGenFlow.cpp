@@ -0,0 +1,373 @@
+/** @file
+
+  Implementation of Generation-independent Flow Engines for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsGenFlow.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+********************************************************************
+ Revision History
+
+**/
+
+#include <time.h>
+#include <unistd.h>
+#include "InterfaceGet.h"
+#include "ElanTsHidUtility.h"
+#include "ElanTsFuncApi.h"
+#include "ElanTsFwFileIoUtility.h"
+#include "ElanTsFwUpdateFlow.h"
+#include "ElanTsGenTraits.h"
+#include "ElanTsGenFlow.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Firmware Verification Check (before Flash is Written):
+// ERR_FUNC_NOT_SUPPORT if Any Page of Mapped FW File to be Verified (traits::is_verify_page)
+// can not be Read Back (traits::is_readable_page), so Caller can Refuse Verification before Update.
+template <class traits>
+int check_flash_pages_verifiable(void)
+{
+    int err = ERR_SUCCESS,
+        firmware_size = 0,
+        page_count = 0,
+        page_index = 0,
+        unreadable_count = 0;
+    typename traits::address_t page_address = 0;
+    unsigned char *p_firmware_data = NULL;
+
+    // Map FW File
+    err = map_firmware_file(&p_firmware_data, &firmware_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Map Firmware File! err=0x%x.\r\n", __func__, err);
+        goto CHECK_FLASH_PAGES_VERIFIABLE_EXIT;
+    }
+
+    // Whole FW Pages Only, NOT including Header Page
+    page_count = (firmware_size / (int)traits::fw_page_size) - traits::fw_header_pages;
+    for(page_index = traits::fw_header_pages; page_index < (page_count + traits::fw_header_pages); page_index++)
+    {
+        page_address = traits::fw_page_address(&p_firmware_data[page_index * traits::fw_page_size]);
+        if((traits::is_verify_page(page_address) == false) || (traits::is_readable_page(page_address) == true))
+            continue;
+        if(unreadable_count < VERIFY_MISMATCH_REPORT_MAX)
+            ERROR_PRINTF("Page 0x%0*x can not be Read Back!\r\n", traits::address_digits, (unsigned int)page_address);
+        unreadable_count++;
+    }
+    if(unreadable_count > 0)
+    {
+        ERROR_PRINTF("%s: %d of %d %sFW Pages can not be Read Back, Verification not Supported!\r\n", __func__, unreadable_count, page_count, traits::name());
+        err = ERR_FUNC_NOT_SUPPORT;
+    }
+
+    unmap_firmware_file(p_firmware_data, firmware_size);
+
+CHECK_FLASH_PAGES_VERIFIABLE_EXIT:
+    return err;
+}
+
+// Firmware Verification:
+// Read Flash back with Bulk Reads (Consecutive Pages in One Block) and Compare with Mapped FW File.
+// Pages not Written from FW File (traits::is_verify_page) are Skipped. If Any Other Page can not be Read Back
+// (check_flash_pages_verifiable()), Nothing is Verified and ERR_FUNC_NOT_SUPPORT is Returned.
+// Only Mismatched Pages are Read Again, so Transient Transfer Errors are Filtered Out.
+template <class traits>
+int verify_flash_pages(message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS,
+        firmware_size = 0,
+        page_count = 0,
+        page_index = 0,
+        verify_count = 0,
+        list_index = 0,
+        run_page_count = 0,
+        run_index = 0,
+        retry_index = 0,
+        mismatch_count = 0,
+        mismatch_index = 0,
+        remain_count = 0,
+        *p_verify_page = NULL;
+    typename traits::address_t page_address = 0;
+    unsigned char *p_firmware_data = NULL,
+                  *p_page = NULL,
+                  block_buf[traits::memory_block_size] = {0};
+    struct timespec start_time,
+                    end_time;
+    long elapsed_ms = 0;
+
+    // All Pages to Verify can be Read Back
+    err = check_flash_pages_verifiable<traits>();
+    if(err != ERR_SUCCESS)
+        goto VERIFY_FLASH_PAGES_EXIT;
+
+    // Map FW File
+    err = map_firmware_file(&p_firmware_data, &firmware_size);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Map Firmware File! err=0x%x.\r\n", __func__, err);
+        goto VERIFY_FLASH_PAGES_EXIT;
+    }
+
+    // Whole FW Pages Only (Trailing Bytes are not Written to Flash), NOT including Header Page
+    page_count = (firmware_size / (int)traits::fw_page_size) - traits::fw_header_pages;
+    if(page_count <= 0)
+    {
+        ERROR_PRINTF("%s: No FW Page in %sFW File!\r\n", __func__, traits::name());
+        err = ERR_DATA_PATTERN;
+        goto VERIFY_FLASH_PAGES_EXIT_1;
+    }
+    p_verify_page = (int *)malloc(sizeof(int) * page_count);
+    if(p_verify_page == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Allocate Page List (%d Pages)!\r\n", __func__, page_count);
+        err = ERR_NO_MEMORY;
+        goto VERIFY_FLASH_PAGES_EXIT_1;
+    }
+
+    // Pages to Verify (Index of FW File Page)
+    for(page_index = traits::fw_header_pages; page_index < (page_count + traits::fw_header_pages); page_index++)
+    {
+        page_address = traits::fw_page_address(&p_firmware_data[page_index * traits::fw_page_size]);
+        if(traits::is_verify_page(page_address) == false)
+            continue;
+        p_verify_page[verify_count++] = page_index;
+    }
+    if(msg_mode == FULL_MESSAGE)
+        printf("Verify %d of %d %sFW Pages...\r\n", verify_count, page_count, traits::name());
+    if(verify_count == 0)
+        goto VERIFY_FLASH_PAGES_EXIT_2;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    // Enter Test Mode
+    err = send_enter_test_mode_command();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Enter Test Mode! err=0x%x.\r\n", __func__, err);
+        goto VERIFY_FLASH_PAGES_EXIT_1;
+    }
+
+    // Read Blocks of Consecutive Pages & Compare (Mismatched Pages are Packed to Front of List)
+    for(list_index = 0, mismatch_count = 0; list_index < verify_count; list_index += run_page_count)
+    {
+        page_address = traits::fw_page_address(&p_firmware_data[p_verify_page[list_index] * traits::fw_page_size]);
+        for(run_page_count = 1; ((list_index + run_page_count) < verify_count) && (run_page_count < (int)(traits::memory_block_size / traits::memory_page_size)); run_page_count++)
+        {
+            if(traits::fw_page_address(&p_firmware_data[p_verify_page[list_index + run_page_count] * traits::fw_page_size]) != \
+               (typename traits::address_t)(page_address + run_page_count * (traits::memory_page_size / traits::address_unit)))
+                break;
+        }
+
+        // Pages of Failed Read are Retried below
+        err = traits::read_bulk((unsigned short)traits::bulk_address(page_address), run_page_count * traits::memory_page_size, block_buf, sizeof(block_buf));
+        for(run_index = 0; run_index < run_page_count; run_index++)
+        {
+            p_page = &p_firmware_data[p_verify_page[list_index + run_index] * traits::fw_page_size];
+            if((err != ERR_SUCCESS) || \
+               (memcmp(&block_buf[run_index * traits::memory_page_size], &p_page[traits::fw_page_data_start], traits::memory_page_size) != 0))
+                p_verify_page[mismatch_count++] = p_verify_page[list_index + run_index];
+        }
+    }
+
+    // Read Mismatched Pages Again
+    for(retry_index = 0; (retry_index < ERROR_RETRY_COUNT) && (mismatch_count > 0); retry_index++)
+    {
+        DEBUG_PRINTF("%s: [%d] Retry %d Mismatched Pages.\r\n", __func__, retry_index, mismatch_count);
+        for(mismatch_index = 0, remain_count = 0; mismatch_index < mismatch_count; mismatch_index++)
+        {
+            p_page = &p_firmware_data[p_verify_page[mismatch_index] * traits::fw_page_size];
+            page_address = traits::fw_page_address(p_page);
+            err = traits::read_bulk((unsigned short)traits::bulk_address(page_address), traits::memory_page_size, block_buf, sizeof(block_buf));
+            if((err != ERR_SUCCESS) || (memcmp(block_buf, &p_page[traits::fw_page_data_start], traits::memory_page_size) != 0))
+                p_verify_page[remain_count++] = p_verify_page[mismatch_index];
+        }
+        mismatch_count = remain_count;
+    }
+
+    // Leave Test Mode
+    err = send_exit_test_mode_command();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Leave Test Mode! err=0x%x.\r\n", __func__, err);
+        goto VERIFY_FLASH_PAGES_EXIT_1;
+    }
+
+    // Report Mismatched Pages
+    if(mismatch_count > 0)
+    {
+        for(mismatch_index = 0; (mismatch_index < mismatch_count) && (mismatch_index < VERIFY_MISMATCH_REPORT_MAX); mismatch_index++)
+        {
+            page_address = traits::fw_page_address(&p_firmware_data[p_verify_page[mismatch_index] * traits::fw_page_size]);
+            ERROR_PRINTF("Page 0x%0*x Mismatched!\r\n", traits::address_digits, (unsigned int)page_address);
+        }
+        ERROR_PRINTF("%s: %d of %d Pages Mismatched!\r\n", __func__, mismatch_count, verify_count);
+        err = ERR_DATA_MISMATCHED;
+        goto VERIFY_FLASH_PAGES_EXIT_1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000;
+    if(msg_mode == FULL_MESSAGE)
+        printf("%sFW Verified (%d Pages in %ld ms).\r\n", traits::name(), verify_count, elapsed_ms);
+
+VERIFY_FLASH_PAGES_EXIT_2:
+    // Success
+    err = ERR_SUCCESS;
+
+VERIFY_FLASH_PAGES_EXIT_1:
+    free(p_verify_page);
+    unmap_firmware_file(p_firmware_data, firmware_size);
+
+VERIFY_FLASH_PAGES_EXIT:
+    return err;
+}
+
+// Flash Dump:
+// Stream $(size) Bytes from Bulk Read $(address) to File with Back-to-Back Bulk Reads,
+// File is Written by Writer Thread while Next Block is Read.
+template <class traits>
+int dump_flash_blocks(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode)
+{
+    int err = ERR_SUCCESS,
+        close_err = ERR_SUCCESS;
+    unsigned int dump_len = 0,
+                 block_len = 0;
+    unsigned char block_buf[traits::memory_block_size] = {0};
+    struct timespec start_time,
+                    end_time;
+    long elapsed_ms = 0;
+
+    //
+    // Validate Arguments
+    //
+
+    // Make Sure Filename Valid
+    if((filename == NULL) || (filename_len == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Filename! (filename=0x%p, filename_len=%ld)\r\n", __func__, filename, filename_len);
+        err = ERR_INVALID_PARAM;
+        goto DUMP_FLASH_BLOCKS_EXIT;
+    }
+
+    // Make Sure Region Valid (Address in Address Unit, Size in Byte)
+    if((size == 0) || ((size % traits::address_unit) != 0) || ((address + (size / traits::address_unit)) > ELAN_TS_BULK_READ_WINDOW))
+    {
+        ERROR_PRINTF("%s: Invalid Dump Region! (address=0x%x, size=0x%x)\r\n", __func__, address, size);
+        err = ERR_INVALID_PARAM;
+        goto DUMP_FLASH_BLOCKS_EXIT;
+    }
+
+    // Create Dump File
+    err = open_dump_file(filename, filename_len);
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Open Dump File \"%s\"! err=0x%x.\r\n", __func__, filename, err);
+        goto DUMP_FLASH_BLOCKS_EXIT;
+    }
+
+    if(msg_mode == FULL_MESSAGE)
+    {
+        printf("--------------------------------\r\n");
+        printf("Dump %sFlash 0x%x~0x%x to \"%s\"...\r\n", traits::name(), address, address + (size / traits::address_unit) - 1, filename);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    // Enter Test Mode
+    err = send_enter_test_mode_command();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Enter Test Mode! err=0x%x.\r\n", __func__, err);
+        goto DUMP_FLASH_BLOCKS_EXIT_1;
+    }
+
+    // Read Blocks Back to Back
+    for(dump_len = 0; dump_len < size; dump_len += block_len)
+    {
+        block_len = ((size - dump_len) < sizeof(block_buf)) ? (size - dump_len) : sizeof(block_buf);
+
+        err = traits::read_bulk((unsigned short)(address + (dump_len / traits::address_unit)), block_len, block_buf, sizeof(block_buf));
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Read Block 0x%x! err=0x%x.\r\n", __func__, address + (dump_len / traits::address_unit), err);
+            goto DUMP_FLASH_BLOCKS_EXIT_2;
+        }
+
+        err = write_dump_file(block_buf, block_len);
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Write Dump File! err=0x%x.\r\n", __func__, err);
+            goto DUMP_FLASH_BLOCKS_EXIT_2;
+        }
+
+        // Print progress to inform operators
+        if(msg_mode == FULL_MESSAGE)
+        {
+            printf(".");
+            fflush(stdout);
+        }
+    }
+
+    // Leave Test Mode
+    err = send_exit_test_mode_command();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Leave Test Mode! err=0x%x.\r\n", __func__, err);
+        goto DUMP_FLASH_BLOCKS_EXIT_1;
+    }
+
+    // Flush Dump File
+    err = close_dump_file();
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Close Dump File! err=0x%x.\r\n", __func__, err);
+        unlink(filename); // Do not Leave Partial Dump
+        goto DUMP_FLASH_BLOCKS_EXIT;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    elapsed_ms = (end_time.tv_sec - start_time.tv_sec) * 1000 + (end_time.tv_nsec - start_time.tv_nsec) / 1000000;
+    if(msg_mode == FULL_MESSAGE)
+    {
+        printf("\r\n");
+        printf("%u Bytes Dumped in %ld ms.\r\n", size, elapsed_ms);
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+DUMP_FLASH_BLOCKS_EXIT:
+    return err;
+
+DUMP_FLASH_BLOCKS_EXIT_2:
+    // Leave Test Mode
+    send_exit_test_mode_command();
+
+DUMP_FLASH_BLOCKS_EXIT_1:
+    // Discard Dump File
+    close_err = close_dump_file();
+    if(close_err != ERR_SUCCESS)
+        ERROR_PRINTF("%s: Fail to Close Dump File! err=0x%x.\r\n", __func__, close_err);
+    unlink(filename); // Do not Leave Partial Dump
+    if(msg_mode == FULL_MESSAGE)
+        printf("\r\n");
+
+    return err;
+}
+
+// Generations
+template int check_flash_pages_verifiable<ts_gen5_traits>(void);
+template int check_flash_pages_verifiable<ts_gen8_traits>(void);
+template int verify_flash_pages<ts_gen5_traits>(message_mode_t msg_mode);
+template int verify_flash_pages<ts_gen8_traits>(message_mode_t msg_mode);
+template int dump_flash_blocks<ts_gen5_traits>(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode);
+template int dump_flash_blocks<ts_gen8_traits>(char *filename, size_t filename_len, unsigned int address, unsigned int size, message_mode_t msg_mode);
@@ -0,0 +1,131 @@
+/** @file
+
+  Implementation of Prebuilt Command Reports for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsHidCommand.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <string.h>
+#include "ErrCode.h"
+#include "InterfaceGet.h"
+#include "ElanTsDebug.h"
+#include "ElanTsHidUtility.h"
+#include "ElanTsHidCommand.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+/*
+ * Command Table:
+ *   Whole 33-byte Output Report of Every Command, in hid_command_id Order.
+ *   Bridge Commands are Sent with Report ID of Device (See CHIDLinuxGet::GetOutputReportId()).
+ */
+static const struct hid_command g_hid_command_table[HID_CMD_COUNT] =
+{
+    // Gen5 / Gen6 / Gen7
+    //  ID                              Name                            Bridge  Field (Offset, Length)  Report
+    { HID_CMD_FW_ID,                    "FW ID",                        true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x53, 0xf0, 0x00, 0x01 } },
+    { HID_CMD_FW_VERSION,               "FW Version",                   true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x53, 0x00, 0x00, 0x01 } },
+    { HID_CMD_TEST_VERSION,             "Test Version",                 true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x53, 0xe0, 0x00, 0x01 } },
+    { HID_CMD_BC_VERSION,               "Boot Code Version",            true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x53, 0x10, 0x00, 0x01 } },
+    { HID_CMD_REK,                      "Re-Calibration",               true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x54, 0x29, 0x00, 0x01 } },
+    { HID_CMD_REK_COUNTER,              "Disc Program Times Counter",   true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x53, 0xd0, 0x00, 0x01 } },
+    { HID_CMD_ENTER_TEST_MODE,          "Enter Test Mode",              true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x55, 0x55, 0x55, 0x55 } },
+    { HID_CMD_EXIT_TEST_MODE,           "Exit Test Mode",               true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0xa5, 0xa5, 0xa5, 0xa5 } },
+    // | 0x96 | ADDR_H | ADDR_L | 0x00 | 0x00 | Info (0x11: 53XX, 0x21: 63XX / 73XX) |
+    { HID_CMD_READ_ROM_DATA,            "Read ROM Data",                true,   4, 5,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 6, 0x96, 0x00, 0x00, 0x00, 0x00, 0x11 } },
+    // | 0x59 | 0x10 | ADDR_H | ADDR_L | LEN_H | LEN_L |
+    { HID_CMD_SHOW_BULK_ROM_DATA,       "Show Bulk ROM Data",           true,   5, 4,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 6, 0x59, 0x10, 0x00, 0x00, 0x00, 0x00 } },
+    // | 0x59 | 0x00 | ADDR_H | ADDR_L | 0x00 | 0x01 | (in Boot Code)
+    { HID_CMD_SHOW_BULK_ROM_DATA_BC,    "Show Bulk ROM Data",           true,   5, 2,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 6, 0x59, 0x00, 0x00, 0x00, 0x00, 0x01 } },
+    { HID_CMD_WRITE_FLASH_KEY,          "Write Flash Key",              true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x54, 0xc0, 0xe1, 0x5a } },
+    { HID_CMD_ENTER_IAP,                "Enter IAP",                    true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 4, 0x54, 0x00, 0x12, 0x34 } },
+    // 7-Bit I2C Slave Address
+    { HID_CMD_SLAVE_ADDRESS,            "Elan TS I2C Slave Address",    true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 1, (unsigned char)(ELAN_I2C_SLAVE_ADDR >> 1) } },
+    { HID_CMD_FLASH_WRITE,              "Write to Flash",               false,  0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x22 } },
+    // Bridge CMD 0x18: Feedback Hello Packet for Recovery Mode
+    { HID_CMD_REQUEST_HELLO_PACKET,     "Request IAP Hello Packet",     false,  0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x18 } },
+
+    // Gen8
+    // | 0x96 | Data Length (1 / 2 / 4) | ADDR_3 | ADDR_2 | ADDR_1 | ADDR_0 | 0x00 x 4 |
+    { HID_CMD_GEN8_READ_ROM_DATA,       "Read 32-bit RAM/ROM Data",     true,   4, 5,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 10, 0x96 } },
+    { HID_CMD_GEN8_WRITE_FLASH_KEY,     "Gen8 Write Flash Key",         true,   0, 0,   { ELAN_HID_OUTPUT_REPORT_ID, 0x00, 10, 0x54, 0xc0, 0xcd, 0xab, 0x34, 0x84, 0x01, 0x67, 0x94, 0x81 } },
+    // | 0x20 | Address (LSB First, 4 Bytes) | Page Count (LSB First, 2 Bytes) |
+    { HID_CMD_GEN8_ERASE_FLASH_SECTION, "Erase Flash Section",          false,  2, 6,   { ELAN_HID_OUTPUT_REPORT_ID, 0x20 } },
+};
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Command Table
+const struct hid_command *get_hid_command(int cmd_id)
+{
+    if((cmd_id < 0) || (cmd_id >= HID_CMD_COUNT) || (g_hid_command_table[cmd_id].id != cmd_id))
+        return NULL;
+
+    return &g_hid_command_table[cmd_id];
+}
+
+// Send Prebuilt Report:
+// Report is Sent Straight from Table unless Report ID or Variable Field Differs, then One Copy is Patched.
+int send_hid_command(int cmd_id, const unsigned char *p_field, int field_len)
+{
+    int err = ERR_SUCCESS,
+        cmd_start = 0,
+        cmd_end = 0,
+        byte_index = 0;
+    unsigned char report_id = ELAN_HID_OUTPUT_REPORT_ID,
+                  report_buf[ELAN_HID_OUTPUT_BUFFER_SIZE],
+                  *p_report = NULL;
+    const struct hid_command *p_cmd = NULL;
+
+    // Validate Input Parameter
+    p_cmd = get_hid_command(cmd_id);
+    if((p_cmd == NULL) || ((p_field != NULL) && ((field_len <= 0) || (field_len > p_cmd->field_len))))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (cmd_id=%d, p_field=0x%p, field_len=%d)\r\n", __func__, cmd_id, p_field, field_len);
+        err = ERR_INVALID_PARAM;
+        goto SEND_HID_COMMAND_EXIT;
+    }
+
+    if(p_cmd->bridge)
+        report_id = __hidraw_get_output_report_id();
+
+    // Patch Report ID & Variable Field
+    if((p_field == NULL) && (report_id == p_cmd->report[0]))
+        p_report = (unsigned char *)p_cmd->report;
+    else
+    {
+        memcpy(report_buf, p_cmd->report, sizeof(report_buf));
+        report_buf[0] = report_id;
+        if(p_field != NULL)
+            memcpy(&report_buf[p_cmd->field_offset], p_field, field_len);
+        p_report = report_buf;
+    }
+
+    if(g_debug)
+    {
+        cmd_start = (p_cmd->bridge) ? HID_BRIDGE_CMD_OFFSET : HID_VENDOR_CMD_OFFSET;
+        cmd_end = (p_cmd->bridge) ? (HID_BRIDGE_CMD_OFFSET + p_report[2]) : (p_cmd->field_offset + p_cmd->field_len);
+        if(cmd_end <= cmd_start)
+            cmd_end = cmd_start + 1;
+        printf("%s: ", (p_cmd->bridge) ? "cmd" : "vendor_cmd");
+        for(byte_index = cmd_start; byte_index < cmd_end; byte_index++)
+            printf("0x%02x%s", p_report[byte_index], (byte_index < (cmd_end - 1)) ? ", " : ".\r\n");
+    }
+
+    err = __hidraw_write(p_report, ELAN_HID_OUTPUT_BUFFER_SIZE, ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    if(err != ERR_SUCCESS)
+        ERROR_PRINTF("Fail to send %s command! err=0x%x.\r\n", p_cmd->name, err);
+
+SEND_HID_COMMAND_EXIT:
+    return err;
+}
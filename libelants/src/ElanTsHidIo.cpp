@@ -0,0 +1,149 @@
+/** @file
+
+  Implementation of hidraw Device I/O for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsHidIo.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <string.h>
+#include "ErrCode.h"
+#include "HidConfig.h"
+#include "ElanTsHidIo.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// InterfaceGet Class
+CHIDLinuxGet *g_pIntfGet = NULL; // Pointer to HID Inteface Class (CHIDLinuxGet)
+
+/*******************************************
+ * HID Raw I/O Functions
+ ******************************************/
+
+int __hidraw_write(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_WRITE_EXIT;
+    }
+
+    nRet = g_pIntfGet->WriteRawBytes(buf, len, timeout_ms);
+
+__HIDRAW_WRITE_EXIT:
+    return nRet;
+}
+
+int __hidraw_read(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_READ_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadRawBytes(buf, len, timeout_ms);
+
+__HIDRAW_READ_EXIT:
+    return nRet;
+}
+
+int __hidraw_read_report(unsigned char* buf, int buf_len, int *p_report_len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_READ_REPORT_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadReport(buf, buf_len, p_report_len, timeout_ms);
+
+__HIDRAW_READ_REPORT_EXIT:
+    return nRet;
+}
+
+int __hidraw_write_command(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_WRITE_EXIT;
+    }
+
+    nRet = g_pIntfGet->WriteCommand(buf, len, timeout_ms);
+
+__HIDRAW_WRITE_EXIT:
+    return nRet;
+}
+
+int __hidraw_read_data(unsigned char* buf, int len, int timeout_ms)
+{
+    int nRet = ERR_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = ERR_NO_INTERFACE_CREATED;
+        goto __HIDRAW_READ_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadData(buf, len, timeout_ms);
+
+__HIDRAW_READ_EXIT:
+    return nRet;
+}
+
+unsigned char __hidraw_get_output_report_id(void)
+{
+    if(g_pIntfGet == NULL)
+        return ELAN_HID_OUTPUT_REPORT_ID;
+
+    return g_pIntfGet->GetOutputReportId();
+}
+
+/***************************************************
+ * Abstract I/O Functions
+ ***************************************************/
+
+int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+{
+    //write_bytes_from_buffer_to_i2c(cmd_buf); //pseudo function
+
+    /*** example *********************/
+    return __hidraw_write_command(cmd_buf, len, timeout_ms);
+    /*********************************/
+}
+
+int read_data(unsigned char *data_buf, int len, int timeout_ms)
+{
+    //read_bytes_from_i2c_to_buffer(data_buf, len, timeout); //pseudo function
+
+    /*** example *********************/
+    return __hidraw_read_data(data_buf, len, timeout_ms);
+    /*********************************/
+}
+
+int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+{
+    unsigned char vendor_cmd_buf[ELAN_HID_OUTPUT_BUFFER_SIZE] = {0};
+
+    // Add HID Header
+    vendor_cmd_buf[0] = ELAN_HID_OUTPUT_REPORT_ID;
+    memcpy(&vendor_cmd_buf[1], cmd_buf, len);
+
+    return __hidraw_write(vendor_cmd_buf, sizeof(vendor_cmd_buf), timeout_ms);
+}
@@ -11,27 +11,39 @@
   Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
 **/
 
+#include <time.h>
 #include "HIDLinuxGet.h"
 #include "ElanTsHidUtility.h"
+#include "ElanTsHidCommand.h"
 
 /***************************************************
- * TP Functions
+ * Global Variable Declaration
  ***************************************************/
 
-// FW ID
-int send_fw_id_command(void)
+// Consecutive Pipelined Transactions in which Controller Dropped Queued Commands (Device Session),
+// Commands are Issued One at a Time once It Reaches ELAN_PIPELINED_DROP_COUNT_MAX
+static int g_command_pipeline_drop_count = 0;
+
+/***************************************************
+ * Local Functions
+ ***************************************************/
+
+static int get_elapsed_ms(const struct timespec *p_start_time)
 {
-    int err = ERR_SUCCESS;
-    unsigned char fw_id_cmd[4] = {0x53, 0xf0, 0x00, 0x01};
+    struct timespec now_time;
 
+    clock_gettime(CLOCK_MONOTONIC, &now_time);
+    return (int)((now_time.tv_sec - p_start_time->tv_sec) * 1000 + (now_time.tv_nsec - p_start_time->tv_nsec) / 1000000);
+}
 
-    /* Send FW ID Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", fw_id_cmd[0], fw_id_cmd[1], fw_id_cmd[2], fw_id_cmd[3]);
-    err = write_cmd(fw_id_cmd, sizeof(fw_id_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send FW ID command! err=0x%x.\r\n", err);
+/***************************************************
+ * TP Functions
+ ***************************************************/
 
-    return err;
+// FW ID
+int send_fw_id_command(void)
+{
+    return send_hid_command(HID_CMD_FW_ID);
 }
 
 int read_fw_id_data(void)
@@ -102,16 +114,7 @@ GET_FW_ID_DATA_EXIT:
 // FW Version
 int send_fw_version_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char fw_ver_cmd[4] = {0x53, 0x00, 0x00, 0x01};
-
-    /* Send FW ID Command to touch */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", fw_ver_cmd[0], fw_ver_cmd[1], fw_ver_cmd[2], fw_ver_cmd[3]);
-    err = write_cmd(fw_ver_cmd, sizeof(fw_ver_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send FW Version command! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_FW_VERSION);
 }
 
 int read_fw_version_data(bool quiet /* Silent Mode */)
@@ -194,16 +197,7 @@ GET_FW_VERSION_DATA_EXIT:
 
 int send_test_version_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char test_ver_cmd[4] = {0x53, 0xe0, 0x00, 0x01};
-
-    /* Send Test Version Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", test_ver_cmd[0], test_ver_cmd[1], test_ver_cmd[2], test_ver_cmd[3]);
-    err = write_cmd(test_ver_cmd, sizeof(test_ver_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Test Version command! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_TEST_VERSION);
 }
 
 // Test Version
@@ -275,16 +269,7 @@ GET_TEST_VERSION_DATA_EXIT:
 // Boot Code Version
 int send_boot_code_version_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char bc_ver_cmd[4] = {0x53, 0x10, 0x00, 0x01};
-
-    /* Send Boot Code Version Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", bc_ver_cmd[0], bc_ver_cmd[1], bc_ver_cmd[2], bc_ver_cmd[3]);
-    err = write_cmd(bc_ver_cmd, sizeof(bc_ver_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Boot Code Version command! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_BC_VERSION);
 }
 
 int read_boot_code_version_data(void)
@@ -364,26 +349,16 @@ GET_BOOT_CODE_VERSION_DATA_EXIT:
 int send_rek_command(void)
 {
     int err = ERR_SUCCESS;
-    unsigned char write_flash_key_cmd[4]	= {0x54, 0xc0, 0xe1, 0x5a},
-            rek_cmd[4]				= {0x54, 0x29, 0x00, 0x01};
 
     /* Send Write Flash Key Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", write_flash_key_cmd[0], write_flash_key_cmd[1], write_flash_key_cmd[2], write_flash_key_cmd[3]);
-    err = write_cmd(write_flash_key_cmd, sizeof(write_flash_key_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    err = send_hid_command(HID_CMD_WRITE_FLASH_KEY);
     if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("Fail to send Write Flash Key command! err=0x%x.\r\n", err);
         goto SEND_REK_COMMAND_EXIT;
-    }
 
     /* Send Re-Calibration Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", rek_cmd[0], rek_cmd[1], rek_cmd[2], rek_cmd[3]);
-    err = write_cmd(rek_cmd, sizeof(rek_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    err = send_hid_command(HID_CMD_REK);
     if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("Fail to send Re-Calibration command! err=0x%x.\r\n", err);
         goto SEND_REK_COMMAND_EXIT;
-    }
 
     err = ERR_SUCCESS;
 
@@ -416,21 +391,56 @@ RECEIVE_REK_RESPONSE_EXIT:
     return err;
 }
 
-// Calibration Counter
-int send_rek_counter_command(void)
+// Wait for Re-Calibration Completion Report (66 66 66 66) until Deadline, Skipping Interleaved Touch Reports
+int wait_rek_response(int timeout_ms)
 {
-    int err = ERR_SUCCESS;
-    unsigned char rek_counter_cmd[4] = {0x53, 0xd0, 0x00, 0x01};
+    int err = ERR_SUCCESS,
+        elapsed_ms = 0;
+    unsigned char cmd_data[4] = {0};
+    struct timespec start_time;
 
-    /* Send Disc Program Times Counter Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", rek_counter_cmd[0], rek_counter_cmd[1], rek_counter_cmd[2], rek_counter_cmd[3]);
-    err = write_cmd(rek_counter_cmd, sizeof(rek_counter_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Disc Program Times Counter command! err=0x%x.\r\n", err);
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    while(1)
+    {
+        elapsed_ms = get_elapsed_ms(&start_time);
+        if(elapsed_ms >= timeout_ms)
+        {
+            err = ERR_IO_TIMEOUT;
+            ERROR_PRINTF("Re-Calibration failed! No completion report in %dms, err=0x%x.\r\n", timeout_ms, err);
+            goto WAIT_REK_RESPONSE_EXIT;
+        }
+
+        err = read_data(cmd_data, sizeof(cmd_data), timeout_ms - elapsed_ms);
+        if(err == ERR_DATA_PATTERN) // Not Command / Finger / Pen Report
+            continue;
+        else if(err == ERR_IO_TIMEOUT) // Checked with Deadline
+            continue;
+        else if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Re-Calibration failed! err=0x%x.\r\n", err);
+            goto WAIT_REK_RESPONSE_EXIT;
+        }
+        DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+
+        /* Check if Completion Report */
+        if((cmd_data[0] == 0x66) && (cmd_data[1] == 0x66) && (cmd_data[2] == 0x66) && (cmd_data[3] == 0x66)) // Calibrated
+            break;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
 
+WAIT_REK_RESPONSE_EXIT:
     return err;
 }
 
+// Calibration Counter
+int send_rek_counter_command(void)
+{
+    return send_hid_command(HID_CMD_REK_COUNTER);
+}
+
 int receive_rek_counter_data(unsigned short *p_rek_counter)
 {
     int err = ERR_SUCCESS;
@@ -480,39 +490,18 @@ RECV_REK_COUNTER_DATA_EXIT:
 // Test Mode
 int send_enter_test_mode_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char enter_test_mode_cmd[4] = {0x55, 0x55, 0x55, 0x55};
-
-    /* Send Enter Test Mode Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", enter_test_mode_cmd[0], enter_test_mode_cmd[1], \
-                 enter_test_mode_cmd[2], enter_test_mode_cmd[3]);
-    err = write_cmd(enter_test_mode_cmd, 4, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Enter Test Mode command! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_ENTER_TEST_MODE);
 }
 
 int send_exit_test_mode_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char exit_test_mode_cmd[4] = {(unsigned char)0xa5, (unsigned char)0xa5, (unsigned char)0xa5, (unsigned char)0xa5};
-
-    /* Send Exit Test Mode Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", exit_test_mode_cmd[0], exit_test_mode_cmd[1], \
-                 exit_test_mode_cmd[2], exit_test_mode_cmd[3]);
-    err = write_cmd(exit_test_mode_cmd, 4, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Enter Test Mode command! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_EXIT_TEST_MODE);
 }
 
 // ROM Data
 int send_read_rom_data_command(unsigned short addr, bool recovery, unsigned char info)
 {
-    int err = ERR_SUCCESS;
-    unsigned char read_rom_data_cmd[6] =  {0x96, 0x00, 0x00, 0x00, 0x00, 0x11} /* Show Bulk ROM Data Command */,
+    unsigned char read_rom_data_field[5] = {0x00, 0x00, 0x00, 0x00, 0x11}, /* ADDR_H, ADDR_L, 0x00, 0x00, Info */
                   solution_id = 0,
                   bc_version_high_byte = 0;
 
@@ -527,8 +516,8 @@ int send_read_rom_data_command(unsigned short addr, bool recovery, unsigned char
     }
 
     /* Set Address & Length */
-    read_rom_data_cmd[1] = (addr & 0xFF00) >> 8;	//ADDR_H
-    read_rom_data_cmd[2] =  addr & 0x00FF; 		    //ADDR_L
+    read_rom_data_field[0] = (addr & 0xFF00) >> 8;	//ADDR_H
+    read_rom_data_field[1] =  addr & 0x00FF; 		//ADDR_L
 
     // Information Command Parameter
     // [Note] Paul @ 20191106
@@ -545,9 +534,9 @@ int send_read_rom_data_command(unsigned short addr, bool recovery, unsigned char
             (solution_id == SOLUTION_ID_EKTH7315x1) || \
             (solution_id == SOLUTION_ID_EKTH7315x2) || \
             (solution_id == SOLUTION_ID_EKTH7318x1))
-            read_rom_data_cmd[5] = 0x21; // 63XX or 73XX: byte[5]=0x21 => Read Information
+            read_rom_data_field[4] = 0x21; // 63XX or 73XX: byte[5]=0x21 => Read Information
         else
-            read_rom_data_cmd[5] = 0x11; // 53XX: byte[5]=0x11 => Read Information
+            read_rom_data_field[4] = 0x11; // 53XX: byte[5]=0x11 => Read Information
     }
     else // Recovery Mode
     {
@@ -558,20 +547,13 @@ int send_read_rom_data_command(unsigned short addr, bool recovery, unsigned char
             (bc_version_high_byte == BC_VER_H_BYTE_FOR_EKTH6315_TO_3915P_HID) || \
             /* 73XX Solution */ \
             (bc_version_high_byte == BC_VER_H_BYTE_FOR_EKTA7315_HID))
-            read_rom_data_cmd[5] = 0x21; // 63XX: byte[5]=0x21 => Read Information
+            read_rom_data_field[4] = 0x21; // 63XX: byte[5]=0x21 => Read Information
         else
-            read_rom_data_cmd[5] = 0x11; // 53XX: byte[5]=0x11 => Read Information
+            read_rom_data_field[4] = 0x11; // 53XX: byte[5]=0x11 => Read Information
     }
 
-    /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
-                 read_rom_data_cmd[0], read_rom_data_cmd[1], read_rom_data_cmd[2], \
-                 read_rom_data_cmd[3], read_rom_data_cmd[4], read_rom_data_cmd[5]);
-    err = write_cmd(read_rom_data_cmd, 6, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Read ROM Data command! err=0x%x.\r\n", err);
-
-    return err;
+    /* Send Read ROM Data Command */
+    return send_hid_command(HID_CMD_READ_ROM_DATA, read_rom_data_field, sizeof(read_rom_data_field));
 }
 
 int receive_rom_data(unsigned short *p_rom_data)
@@ -610,45 +592,29 @@ RECEIVE_ROM_DATA_EXIT:
 // Bulk ROM Data
 int send_show_bulk_rom_data_command(unsigned short addr, unsigned short len)
 {
-    int err = ERR_SUCCESS;
-    unsigned char show_bulk_rom_data_cmd[6] =  {0x59, 0x10, 0x00, 0x00, 0x00, 0x00}; /* Show Bulk ROM Data Command */
+    unsigned char show_bulk_rom_data_field[4] = {0};
 
     /* Set Address & Length */
-    show_bulk_rom_data_cmd[2] = (addr & 0xFF00) >> 8;	//ADDR_H
-    show_bulk_rom_data_cmd[3] =  addr & 0x00FF; 		//ADDR_L
-    show_bulk_rom_data_cmd[4] = (len  & 0xFF00) >> 8;	//LEN_H
-    show_bulk_rom_data_cmd[5] =  len  & 0x00FF;			//LEN_L
+    show_bulk_rom_data_field[0] = (addr & 0xFF00) >> 8;	//ADDR_H
+    show_bulk_rom_data_field[1] =  addr & 0x00FF; 		//ADDR_L
+    show_bulk_rom_data_field[2] = (len  & 0xFF00) >> 8;	//LEN_H
+    show_bulk_rom_data_field[3] =  len  & 0x00FF;		//LEN_L
 
     /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
-                 show_bulk_rom_data_cmd[0], show_bulk_rom_data_cmd[1], show_bulk_rom_data_cmd[2], \
-                 show_bulk_rom_data_cmd[3], show_bulk_rom_data_cmd[4], show_bulk_rom_data_cmd[5]);
-    err = write_cmd(show_bulk_rom_data_cmd, 6, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Show Bulk ROM Data command! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_SHOW_BULK_ROM_DATA, show_bulk_rom_data_field, sizeof(show_bulk_rom_data_field));
 }
 
 // Bulk ROM Data (in Boot Code)
 int send_show_bulk_rom_data_command(unsigned short addr)
 {
-    int err = ERR_SUCCESS;
-    unsigned char show_bulk_rom_data_cmd[6] =  {0x59, 0x00, 0x00, 0x00, 0x00, 0x01}; /* Show Bulk ROM Data Command (cmd[1]=0x00 in Boot Code) */
+    unsigned char show_bulk_rom_data_field[2] = {0};
 
     /* Set Address */
-    show_bulk_rom_data_cmd[2] = (addr & 0xFF00) >> 8;	//ADDR_H
-    show_bulk_rom_data_cmd[3] =  addr & 0x00FF; 		//ADDR_L
+    show_bulk_rom_data_field[0] = (addr & 0xFF00) >> 8;	//ADDR_H
+    show_bulk_rom_data_field[1] =  addr & 0x00FF; 		//ADDR_L
 
-    /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
-                 show_bulk_rom_data_cmd[0], show_bulk_rom_data_cmd[1], show_bulk_rom_data_cmd[2], \
-                 show_bulk_rom_data_cmd[3], show_bulk_rom_data_cmd[4], show_bulk_rom_data_cmd[5]);
-    err = write_cmd(show_bulk_rom_data_cmd, 6, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Show Bulk ROM Data command! err=0x%x.\r\n", err);
-
-    return err;
+    /* Send Show Bulk ROM Data Command (cmd[1]=0x00 in Boot Code) */
+    return send_hid_command(HID_CMD_SHOW_BULK_ROM_DATA_BC, show_bulk_rom_data_field, sizeof(show_bulk_rom_data_field));
 }
 
 int receive_bulk_rom_data(unsigned short *p_rom_data)
@@ -687,48 +653,17 @@ RECEIVE_BULK_ROM_DATA_EXIT:
 // IAP Mode
 int send_write_flash_key_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char write_flash_key_cmd[4] = {0x54, 0xc0, 0xe1, 0x5a};
-
-    /* Send Write Flash Key Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", write_flash_key_cmd[0], write_flash_key_cmd[1], write_flash_key_cmd[2], write_flash_key_cmd[3]);
-    err = write_cmd(write_flash_key_cmd, sizeof(write_flash_key_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("Fail to send Write Flash Key command! err=0x%x.\r\n", err);
-    }
-
-    return err;
+    return send_hid_command(HID_CMD_WRITE_FLASH_KEY);
 }
 
 int send_enter_iap_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char enter_iap_cmd[4] = {0x54, 0x00, 0x12, 0x34};
-
-    /* Send Enter IAP Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", enter_iap_cmd[0], enter_iap_cmd[1], enter_iap_cmd[2], enter_iap_cmd[3]);
-    err = write_cmd(enter_iap_cmd, sizeof(enter_iap_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-    {
-        ERROR_PRINTF("Fail to send Enter IAP command! err=0x%x.\r\n", err);
-    }
-
-    return err;
+    return send_hid_command(HID_CMD_ENTER_IAP);
 }
 
 int send_slave_address(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char slave_addr =(unsigned char)(ELAN_I2C_SLAVE_ADDR >> 1); // 7-Bit I2C Slave Address
-
-    /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x.\r\n", slave_addr);
-    err = write_cmd(&slave_addr, 1, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if (err != ERR_SUCCESS)
-        ERROR_PRINTF("Fail to send Elan TS I2C Slave Address! err=0x%x.\r\n", err);
-
-    return err;
+    return send_hid_command(HID_CMD_SLAVE_ADDRESS);
 }
 
 // Frame Data
@@ -781,16 +716,7 @@ WRITE_FRAME_DATA_EXIT:
 // Flash Write
 int send_flash_write_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char write_to_flash_cmd = 0x22; // Vendor Command
-
-    /* Send Write to Flash Command (Vendor Command) */
-    DEBUG_PRINTF("vendor_cmd: 0x%02x.\r\n", write_to_flash_cmd);
-    err = write_vendor_cmd(&write_to_flash_cmd, 1, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if(err != ERR_SUCCESS)
-        ERROR_PRINTF("Failed to write vendor command 0x%x, err=0x%x.\r\n", write_to_flash_cmd, err);
-
-    return err;
+    return send_hid_command(HID_CMD_FLASH_WRITE);
 }
 
 int receive_flash_write_response(void)
@@ -826,14 +752,160 @@ READ_FLASH_WRITE_RESPONSE_EXIT:
 // Bridge CMD 0x18: If command <0x18> is issued, feedback Hello packet for Recovery Mode.
 int send_request_hello_packet_command(void)
 {
-    int err = ERR_SUCCESS;
-    unsigned char request_iap_recovery_hello_packet_cmd = 0x18; // Vendor Command
+    return send_hid_command(HID_CMD_REQUEST_HELLO_PACKET);
+}
 
-    /* Send Request IAP Hello Packet Command (Vendor Command) */
-    DEBUG_PRINTF("vendor_cmd: 0x%02x.\r\n", request_iap_recovery_hello_packet_cmd);
-    err = write_vendor_cmd(&request_iap_recovery_hello_packet_cmd, 1, ELAN_WRITE_DATA_TIMEOUT_MSEC);
-    if(err != ERR_SUCCESS)
-        ERROR_PRINTF("Failed to write vendor command 0x%x, err=0x%x.\r\n", request_iap_recovery_hello_packet_cmd, err);
+// Pipelined Query Commands
+// Receive Responses until Command of target_index (All Commands if -1) is Done.
+// Responses are Matched to Commands by Header & Type, so They may Arrive in Any Order. Other Reports are Skipped.
+static int receive_pipelined_responses(struct pipelined_command *p_cmd_list, int cmd_count, int target_index, int timeout_ms)
+{
+    int err = ERR_SUCCESS,
+        cmd_index = 0,
+        pending_count = 0,
+        elapsed_ms = 0;
+    unsigned char cmd_data[4] = {0};
+    struct timespec start_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    while(1)
+    {
+        // Check if Done
+        pending_count = 0;
+        for(cmd_index = 0; cmd_index < cmd_count; cmd_index++)
+        {
+            if(p_cmd_list[cmd_index].done == false)
+                pending_count++;
+        }
+        if((pending_count == 0) || ((target_index >= 0) && (p_cmd_list[target_index].done == true)))
+            break;
+
+        elapsed_ms = get_elapsed_ms(&start_time);
+        if(elapsed_ms >= timeout_ms)
+        {
+            err = ERR_IO_TIMEOUT;
+            goto RECEIVE_PIPELINED_RESPONSES_EXIT;
+        }
+
+        err = read_data(cmd_data, sizeof(cmd_data), timeout_ms - elapsed_ms);
+        if(err == ERR_DATA_PATTERN) // Not Command / Finger / Pen Report
+            continue;
+        else if(err != ERR_SUCCESS)
+            goto RECEIVE_PIPELINED_RESPONSES_EXIT;
+        DEBUG_PRINTF("cmd_data: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+
+        // Finger / Pen Report, or Response of Other Command
+        if(cmd_data[0] != ELAN_QUERY_RESPONSE_HEADER)
+            continue;
+
+        for(cmd_index = 0; cmd_index < cmd_count; cmd_index++)
+        {
+            if((p_cmd_list[cmd_index].done == false) && ((cmd_data[1] & 0xf0) == (p_cmd_list[cmd_index].cmd[1] & 0xf0)))
+            {
+                memcpy(p_cmd_list[cmd_index].response, cmd_data, sizeof(cmd_data));
+                p_cmd_list[cmd_index].done = true;
+                break;
+            }
+        }
+        if(cmd_index == cmd_count)
+            DEBUG_PRINTF("%s: Skip Unexpected Response (%02x %02x).\r\n", __func__, cmd_data[0], cmd_data[1]);
+    }
+
+    // Success
+    err = ERR_SUCCESS;
 
+RECEIVE_PIPELINED_RESPONSES_EXIT:
     return err;
 }
+
+// Send All Query Commands Back to Back & Collect Responses as They Arrive, so the Round Trips Overlap.
+// Missing Responses are Collected in Serial Mode (Send One, Wait for Its Response). After ELAN_PIPELINED_DROP_COUNT_MAX
+// Such Transactions in a Row, Controller is Taken as Unable to Queue Commands, and Serial Mode is Used until reset_command_pipeline().
+int issue_pipelined_commands(struct pipelined_command *p_cmd_list, int cmd_count, int timeout_ms)
+{
+    int err = ERR_SUCCESS,
+        cmd_index = 0;
+
+    // Validate Input Parameter
+    if((p_cmd_list == NULL) || (cmd_count <= 0) || (cmd_count > ELAN_PIPELINED_COMMAND_COUNT_MAX) || (timeout_ms <= 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_cmd_list=0x%p, cmd_count=%d, timeout_ms=%d)\r\n", __func__, p_cmd_list, cmd_count, timeout_ms);
+        err = ERR_INVALID_PARAM;
+        goto ISSUE_PIPELINED_COMMANDS_EXIT;
+    }
+
+    for(cmd_index = 0; cmd_index < cmd_count; cmd_index++)
+    {
+        memset(p_cmd_list[cmd_index].response, 0, sizeof(p_cmd_list[cmd_index].response));
+        p_cmd_list[cmd_index].done = false;
+    }
+
+    if(g_command_pipeline_drop_count < ELAN_PIPELINED_DROP_COUNT_MAX)
+    {
+        // Send All Commands
+        for(cmd_index = 0; cmd_index < cmd_count; cmd_index++)
+        {
+            DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", p_cmd_list[cmd_index].cmd[0], p_cmd_list[cmd_index].cmd[1], \
+                         p_cmd_list[cmd_index].cmd[2], p_cmd_list[cmd_index].cmd[3]);
+            err = write_cmd(p_cmd_list[cmd_index].cmd, sizeof(p_cmd_list[cmd_index].cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+            if(err != ERR_SUCCESS)
+            {
+                ERROR_PRINTF("Fail to send command (%02x %02x)! err=0x%x.\r\n", p_cmd_list[cmd_index].cmd[0], p_cmd_list[cmd_index].cmd[1], err);
+                goto ISSUE_PIPELINED_COMMANDS_EXIT;
+            }
+        }
+
+        // Collect Responses
+        err = receive_pipelined_responses(p_cmd_list, cmd_count, -1, timeout_ms);
+        if(err != ERR_IO_TIMEOUT) // Success or I/O Error
+        {
+            if(err == ERR_SUCCESS)
+                g_command_pipeline_drop_count = 0;
+            else
+                ERROR_PRINTF("Fail to receive responses, err=0x%x.\r\n", err);
+            goto ISSUE_PIPELINED_COMMANDS_EXIT;
+        }
+
+        g_command_pipeline_drop_count++;
+        DEBUG_PRINTF("%s: Response Missing (%d in a Row), Issue Pending Commands in Serial Mode.\r\n", __func__, g_command_pipeline_drop_count);
+        if(g_command_pipeline_drop_count >= ELAN_PIPELINED_DROP_COUNT_MAX)
+            DEBUG_PRINTF("%s: Controller cannot Queue Commands, Serial Mode for Rest of Device Session.\r\n", __func__);
+    }
+
+    // Serial Mode: Issue Pending Commands One at a Time
+    for(cmd_index = 0; cmd_index < cmd_count; cmd_index++)
+    {
+        if(p_cmd_list[cmd_index].done == true)
+            continue;
+
+        DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", p_cmd_list[cmd_index].cmd[0], p_cmd_list[cmd_index].cmd[1], \
+                     p_cmd_list[cmd_index].cmd[2], p_cmd_list[cmd_index].cmd[3]);
+        err = write_cmd(p_cmd_list[cmd_index].cmd, sizeof(p_cmd_list[cmd_index].cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to send command (%02x %02x)! err=0x%x.\r\n", p_cmd_list[cmd_index].cmd[0], p_cmd_list[cmd_index].cmd[1], err);
+            goto ISSUE_PIPELINED_COMMANDS_EXIT;
+        }
+
+        err = receive_pipelined_responses(p_cmd_list, cmd_count, cmd_index, timeout_ms);
+        if(err != ERR_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to receive response of command (%02x %02x), err=0x%x.\r\n", p_cmd_list[cmd_index].cmd[0], p_cmd_list[cmd_index].cmd[1], err);
+            goto ISSUE_PIPELINED_COMMANDS_EXIT;
+        }
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+ISSUE_PIPELINED_COMMANDS_EXIT:
+    return err;
+}
+
+// New Device Session (Open / Reconnect / Close): Try Pipelining Again
+void reset_command_pipeline(void)
+{
+    g_command_pipeline_drop_count = 0;
+    return;
+}
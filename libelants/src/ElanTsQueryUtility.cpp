@@ -0,0 +1,173 @@
+/** @file
+
+  Implementation of Query Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsQueryUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ErrCode.h"
+#include "ElanTsQueryUtility.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Field List
+int parse_query_field_list(const char *p_field_list, const struct query_field *p_field_table, size_t field_table_count, \
+                           const struct query_field **pp_query_field, size_t query_field_size, size_t *p_query_field_count)
+{
+    int err = ERR_SUCCESS;
+    const char *p_name = NULL;
+    size_t name_len = 0,
+           table_index = 0,
+           query_field_count = 0;
+    bool found = false;
+
+    // Validate Input Parameter
+    if ((p_field_list == NULL) || (p_field_table == NULL) || (pp_query_field == NULL) || (query_field_size == 0) || (p_query_field_count == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_field_list=0x%p, p_field_table=0x%p, pp_query_field=0x%p, query_field_size=%ld, p_query_field_count=0x%p)\r\n", \
+                     __func__, p_field_list, p_field_table, pp_query_field, query_field_size, p_query_field_count);
+        err = ERR_INVALID_PARAM;
+        goto PARSE_QUERY_FIELD_LIST_EXIT;
+    }
+
+    // Comma-separated Field Names
+    for (p_name = p_field_list; *p_name != '\0'; p_name += name_len)
+    {
+        if (*p_name == ',')
+        {
+            name_len = 1;
+            continue;
+        }
+        name_len = strcspn(p_name, ",");
+
+        // All Fields
+        if ((name_len == strlen(QUERY_FIELD_ALL)) && (strncmp(p_name, QUERY_FIELD_ALL, name_len) == 0))
+        {
+            for (table_index = 0; (table_index < field_table_count) && (query_field_count < query_field_size); table_index++)
+                pp_query_field[query_field_count++] = &p_field_table[table_index];
+            continue;
+        }
+
+        found = false;
+        for (table_index = 0; table_index < field_table_count; table_index++)
+        {
+            if ((strlen(p_field_table[table_index].name) == name_len) && (strncmp(p_field_table[table_index].name, p_name, name_len) == 0))
+            {
+                found = true;
+                break;
+            }
+        }
+        if (found == false)
+        {
+            ERROR_PRINTF("%s: Unknown Field \"%.*s\"!\r\n", __func__, (int)name_len, p_name);
+            err = ERR_INVALID_PARAM;
+            goto PARSE_QUERY_FIELD_LIST_EXIT;
+        }
+
+        if (query_field_count >= query_field_size)
+        {
+            ERROR_PRINTF("%s: Too Many Fields (Max. %ld)!\r\n", __func__, query_field_size);
+            err = ERR_INVALID_PARAM;
+            goto PARSE_QUERY_FIELD_LIST_EXIT;
+        }
+        pp_query_field[query_field_count++] = &p_field_table[table_index];
+    }
+
+    if (query_field_count == 0)
+    {
+        ERROR_PRINTF("%s: No Field in \"%s\"!\r\n", __func__, p_field_list);
+        err = ERR_INVALID_PARAM;
+        goto PARSE_QUERY_FIELD_LIST_EXIT;
+    }
+
+    *p_query_field_count = query_field_count;
+    err = ERR_SUCCESS;
+
+PARSE_QUERY_FIELD_LIST_EXIT:
+    return err;
+}
+
+void show_query_field_names(const struct query_field *p_field_table, size_t field_table_count)
+{
+    size_t table_index = 0;
+
+    if (p_field_table == NULL)
+        return;
+
+    printf("Fields: %s", QUERY_FIELD_ALL);
+    for (table_index = 0; table_index < field_table_count; table_index++)
+        printf(", %s", p_field_table[table_index].name);
+    printf(".\r\n");
+
+    return;
+}
+
+// Query
+int run_query(const struct touch_session *p_session, const struct query_field **pp_query_field, size_t query_field_count, query_format_t format)
+{
+    int err = ERR_SUCCESS,
+        field_err = ERR_SUCCESS;
+    size_t field_index = 0;
+    char value[QUERY_VALUE_LENGTH_MAX] = {0};
+    bool value_valid = false;
+
+    // Validate Input Parameter
+    if ((p_session == NULL) || (pp_query_field == NULL) || (query_field_count == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_session=0x%p, pp_query_field=0x%p, query_field_count=%ld)\r\n", \
+                     __func__, p_session, pp_query_field, query_field_count);
+        err = ERR_INVALID_PARAM;
+        goto RUN_QUERY_EXIT;
+    }
+
+    if (format == QUERY_FORMAT_JSON)
+        printf("{");
+
+    // Fetch All Fields in the Same Device Session, Emit One Record
+    for (field_index = 0; field_index < query_field_count; field_index++)
+    {
+        memset(value, 0, sizeof(value));
+        field_err = pp_query_field[field_index]->get_value(p_session, value, sizeof(value));
+        value_valid = (field_err == ERR_SUCCESS);
+        if ((field_err != ERR_SUCCESS) && (field_err != ERR_FUNC_NOT_SUPPORT))
+        {
+            ERROR_PRINTF("%s: Fail to Get \"%s\"! err=0x%x.\r\n", __func__, pp_query_field[field_index]->name, field_err);
+            if (err == ERR_SUCCESS) // Keep First Error, Continue with Other Fields
+                err = field_err;
+        }
+
+        if (format == QUERY_FORMAT_JSON)
+        {
+            if (value_valid)
+                printf("%s\"%s\":\"%s\"", (field_index == 0) ? "" : ",", pp_query_field[field_index]->name, value);
+            else
+                printf("%s\"%s\":null", (field_index == 0) ? "" : ",", pp_query_field[field_index]->name);
+        }
+        else // QUERY_FORMAT_KEY_VALUE
+        {
+            printf("%s%s=%s", (field_index == 0) ? "" : " ", pp_query_field[field_index]->name, (value_valid) ? value : "");
+        }
+    }
+
+    if (format == QUERY_FORMAT_JSON)
+        printf("}");
+    printf("\n");
+
+RUN_QUERY_EXIT:
+    return err;
+}
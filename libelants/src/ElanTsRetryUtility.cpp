@@ -0,0 +1,336 @@
+/** @file
+
+  Implementation of Retry Utility for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	ElanTsRetryUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "ErrCode.h"
+#include "ElanTsRetryUtility.h"
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Retry Policy (Set from Command Line)
+static struct retry_policy g_retry_policy =
+{
+    0,                              // attempt_count: Decided by Caller
+    RETRY_BACKOFF_EXPONENTIAL,      // backoff
+    RETRY_DEFAULT_DELAY_MS,         // delay_ms
+    RETRY_DEFAULT_DELAY_MAX_MS,     // delay_max_ms
+    RETRY_DEFAULT_JITTER_PERCENT,   // jitter_percent
+    0,                              // deadline_ms: No Limit
+    RETRY_DEFAULT_ERR_CLASS         // err_class
+};
+
+// Retry Statistics
+static struct retry_stats g_retry_stats = {0, 0, 0, 0, 0};
+
+// Jitter Seed
+static bool g_retry_seeded = false;
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Error Class
+static unsigned int get_retry_err_class(int err)
+{
+    switch(err)
+    {
+        case ERR_INVALID_PARAM:
+        case ERR_FUNC_NOT_SUPPORT:
+            return 0; // Never Retried
+
+        case ERR_IO_TIMEOUT:
+            return RETRY_ERR_CLASS_TIMEOUT;
+
+        case ERR_IO_ERROR:
+        case ERR_GET_DATA_FAIL:
+        case ERR_CONNECT_NO_HELLO_PACKET:
+            return RETRY_ERR_CLASS_IO;
+
+        case ERR_DATA_PATTERN:
+        case ERR_DATA_MISMATCHED:
+            return RETRY_ERR_CLASS_DATA;
+
+        default:
+            return RETRY_ERR_CLASS_OTHER;
+    }
+}
+
+static unsigned long get_elapsed_ms(const struct timespec *p_start_time)
+{
+    struct timespec now_time;
+
+    clock_gettime(CLOCK_MONOTONIC, &now_time);
+    return (unsigned long)((now_time.tv_sec - p_start_time->tv_sec) * 1000 + (now_time.tv_nsec - p_start_time->tv_nsec) / 1000000);
+}
+
+// Delay before Retry (retry_index: 0 for First Retry)
+static unsigned int get_retry_delay_ms(int retry_index)
+{
+    unsigned int delay_ms = g_retry_policy.delay_ms,
+                 jitter_range = 0;
+    int shift_index = 0;
+
+    if(g_retry_policy.backoff == RETRY_BACKOFF_EXPONENTIAL)
+    {
+        for(shift_index = 0; (shift_index < retry_index) && (delay_ms < g_retry_policy.delay_max_ms); shift_index++)
+            delay_ms *= 2;
+        if(delay_ms > g_retry_policy.delay_max_ms)
+            delay_ms = g_retry_policy.delay_max_ms;
+    }
+
+    // Jitter: Spread Delay over (100 +/- jitter_percent)%
+    if((g_retry_policy.jitter_percent > 0) && (delay_ms > 0))
+    {
+        if(g_retry_seeded == false)
+        {
+            srand((unsigned int)(time(NULL) ^ getpid()));
+            g_retry_seeded = true;
+        }
+        jitter_range = delay_ms * g_retry_policy.jitter_percent / 100;
+        delay_ms = delay_ms - jitter_range + (unsigned int)(rand() % (2 * jitter_range + 1));
+    }
+
+    return delay_ms;
+}
+
+// Retry Policy
+// Format: <key>=<value>[,<key>=<value>...]
+//   count=<attempts>, backoff=fixed|exp, delay=<ms>, max=<ms>, jitter=<percent>, deadline=<ms>,
+//   on=<class>[+<class>...] (class: timeout, io, data, other, all)
+int parse_retry_policy(const char *p_policy_string)
+{
+    int err = ERR_SUCCESS;
+    struct retry_policy policy = g_retry_policy;
+    const char *p_item = NULL,
+               *p_value = NULL,
+               *p_class = NULL;
+    char *p_end = NULL;
+    size_t item_len = 0,
+           key_len = 0,
+           value_len = 0,
+           class_len = 0;
+    unsigned long value = 0;
+    unsigned int err_class = 0;
+
+    // Validate Input Parameter
+    if(p_policy_string == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Policy String!\r\n", __func__);
+        err = ERR_INVALID_PARAM;
+        goto PARSE_RETRY_POLICY_EXIT;
+    }
+
+    // Comma-separated Items
+    for(p_item = p_policy_string; *p_item != '\0'; p_item += item_len)
+    {
+        if(*p_item == ',')
+        {
+            item_len = 1;
+            continue;
+        }
+        item_len = strcspn(p_item, ",");
+
+        p_value = (const char *)memchr(p_item, '=', item_len);
+        if((p_value == NULL) || (p_value == p_item) || (p_value == &p_item[item_len - 1]))
+        {
+            ERROR_PRINTF("%s: Invalid Item \"%.*s\"!\r\n", __func__, (int)item_len, p_item);
+            err = ERR_INVALID_PARAM;
+            goto PARSE_RETRY_POLICY_EXIT;
+        }
+        key_len = p_value - p_item;
+        p_value++;
+        value_len = item_len - key_len - 1;
+
+        // Backoff
+        if((key_len == strlen("backoff")) && (strncmp(p_item, "backoff", key_len) == 0))
+        {
+            if((value_len == strlen("fixed")) && (strncmp(p_value, "fixed", value_len) == 0))
+                policy.backoff = RETRY_BACKOFF_FIXED;
+            else if((value_len == strlen("exp")) && (strncmp(p_value, "exp", value_len) == 0))
+                policy.backoff = RETRY_BACKOFF_EXPONENTIAL;
+            else
+            {
+                ERROR_PRINTF("%s: Unknown Backoff \"%.*s\"!\r\n", __func__, (int)value_len, p_value);
+                err = ERR_INVALID_PARAM;
+                goto PARSE_RETRY_POLICY_EXIT;
+            }
+            continue;
+        }
+
+        // Error Classes
+        if((key_len == strlen("on")) && (strncmp(p_item, "on", key_len) == 0))
+        {
+            err_class = 0;
+            for(p_class = p_value; p_class < &p_item[item_len]; p_class += class_len + 1)
+            {
+                class_len = strcspn(p_class, "+,");
+                if((class_len == strlen("timeout")) && (strncmp(p_class, "timeout", class_len) == 0))
+                    err_class |= RETRY_ERR_CLASS_TIMEOUT;
+                else if((class_len == strlen("io")) && (strncmp(p_class, "io", class_len) == 0))
+                    err_class |= RETRY_ERR_CLASS_IO;
+                else if((class_len == strlen("data")) && (strncmp(p_class, "data", class_len) == 0))
+                    err_class |= RETRY_ERR_CLASS_DATA;
+                else if((class_len == strlen("other")) && (strncmp(p_class, "other", class_len) == 0))
+                    err_class |= RETRY_ERR_CLASS_OTHER;
+                else if((class_len == strlen("all")) && (strncmp(p_class, "all", class_len) == 0))
+                    err_class |= RETRY_ERR_CLASS_ALL;
+                else
+                {
+                    ERROR_PRINTF("%s: Unknown Error Class \"%.*s\"!\r\n", __func__, (int)class_len, p_class);
+                    err = ERR_INVALID_PARAM;
+                    goto PARSE_RETRY_POLICY_EXIT;
+                }
+            }
+            policy.err_class = err_class;
+            continue;
+        }
+
+        // Numeric Values
+        value = strtoul(p_value, &p_end, 0);
+        if((p_end == p_value) || (p_end != &p_item[item_len]))
+        {
+            ERROR_PRINTF("%s: Invalid Value in \"%.*s\"!\r\n", __func__, (int)item_len, p_item);
+            err = ERR_INVALID_PARAM;
+            goto PARSE_RETRY_POLICY_EXIT;
+        }
+
+        if((key_len == strlen("count")) && (strncmp(p_item, "count", key_len) == 0) && (value >= 1) && (value <= 100))
+            policy.attempt_count = (int)value;
+        else if((key_len == strlen("delay")) && (strncmp(p_item, "delay", key_len) == 0) && (value <= 10000))
+            policy.delay_ms = (unsigned int)value;
+        else if((key_len == strlen("max")) && (strncmp(p_item, "max", key_len) == 0) && (value <= 10000))
+            policy.delay_max_ms = (unsigned int)value;
+        else if((key_len == strlen("jitter")) && (strncmp(p_item, "jitter", key_len) == 0) && (value <= 100))
+            policy.jitter_percent = (unsigned int)value;
+        else if((key_len == strlen("deadline")) && (strncmp(p_item, "deadline", key_len) == 0) && (value <= 600000))
+            policy.deadline_ms = (unsigned int)value;
+        else
+        {
+            ERROR_PRINTF("%s: Unknown Key or Value out of Range \"%.*s\"!\r\n", __func__, (int)item_len, p_item);
+            err = ERR_INVALID_PARAM;
+            goto PARSE_RETRY_POLICY_EXIT;
+        }
+    }
+
+    // Max. Delay not Less than Initial Delay
+    if(policy.delay_max_ms < policy.delay_ms)
+        policy.delay_max_ms = policy.delay_ms;
+
+    g_retry_policy = policy;
+    DEBUG_PRINTF("%s: Retry Policy: count=%d, backoff=%s, delay=%ums, max=%ums, jitter=%u%%, deadline=%ums, on=0x%x.\r\n", __func__, \
+                 policy.attempt_count, (policy.backoff == RETRY_BACKOFF_FIXED) ? "fixed" : "exp", policy.delay_ms, policy.delay_max_ms, \
+                 policy.jitter_percent, policy.deadline_ms, policy.err_class);
+
+    // Success
+    err = ERR_SUCCESS;
+
+PARSE_RETRY_POLICY_EXIT:
+    return err;
+}
+
+void show_retry_policy_format(void)
+{
+    printf("Keys: count=<attempts>, backoff=fixed|exp, delay=<ms>, max=<ms>, jitter=<percent>, deadline=<ms>, on=<class>[+<class>...].\r\n");
+    printf("Classes: timeout, io, data, other, all. (Default: backoff=exp,delay=%d,max=%d,jitter=%d,on=all)\r\n", \
+           RETRY_DEFAULT_DELAY_MS, RETRY_DEFAULT_DELAY_MAX_MS, RETRY_DEFAULT_JITTER_PERCENT);
+    return;
+}
+
+// Retry
+// Run transaction until success, non-retryable error, attempt count (policy count if set, otherwise attempt_count) or deadline.
+int run_with_retry(const char *p_name, int attempt_count, retry_transaction transaction, void *p_context)
+{
+    int err = ERR_SUCCESS,
+        attempt_index = 0;
+    unsigned int delay_ms = 0;
+    struct timespec start_time;
+
+    // Validate Input Parameter
+    if((p_name == NULL) || (transaction == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_name=0x%p, transaction=0x%p)\r\n", __func__, p_name, transaction);
+        err = ERR_INVALID_PARAM;
+        goto RUN_WITH_RETRY_EXIT;
+    }
+
+    // Attempt Count from Command Line Takes Precedence
+    if(g_retry_policy.attempt_count > 0)
+        attempt_count = g_retry_policy.attempt_count;
+
+    // Make Sure Attempt Count Positive
+    if(attempt_count <= 0)
+        attempt_count = 1;
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    g_retry_stats.transaction_count++;
+
+    for(attempt_index = 0; attempt_index < attempt_count; attempt_index++)
+    {
+        g_retry_stats.attempt_count++;
+        err = transaction(p_context);
+        if(err == ERR_SUCCESS)
+        {
+            // Without any error => Break retry loop and continue.
+            break;
+        }
+        DEBUG_PRINTF("%s: [%d/%d] Fail to %s! err=0x%x.\r\n", __func__, attempt_index + 1, attempt_count, p_name, err);
+
+        // Error not Retryable, or Last Attempt
+        if(((get_retry_err_class(err) & g_retry_policy.err_class) == 0) || (attempt_index == (attempt_count - 1)))
+            break;
+
+        // Stop if Deadline Reached before Next Attempt
+        delay_ms = get_retry_delay_ms(attempt_index);
+        if((g_retry_policy.deadline_ms > 0) && ((get_elapsed_ms(&start_time) + delay_ms) >= g_retry_policy.deadline_ms))
+        {
+            DEBUG_PRINTF("%s: Deadline (%ums) Reached, Stop Retrying %s.\r\n", __func__, g_retry_policy.deadline_ms, p_name);
+            break;
+        }
+
+        if(delay_ms > 0)
+            usleep(delay_ms * 1000);
+        g_retry_stats.delay_ms += delay_ms;
+        g_retry_stats.retry_count++;
+    }
+
+    if(err != ERR_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to %s! err=0x%x.\r\n", __func__, p_name, err);
+        g_retry_stats.failure_count++;
+    }
+
+RUN_WITH_RETRY_EXIT:
+    return err;
+}
+
+// Retry Statistics
+void get_retry_stats(struct retry_stats *p_retry_stats)
+{
+    if(p_retry_stats != NULL)
+        *p_retry_stats = g_retry_stats;
+    return;
+}
+
+void show_retry_stats(void)
+{
+    DEBUG_PRINTF("Retry Stats: transactions=%u, attempts=%u, retries=%u, failures=%u, delay=%lums.\r\n", \
+                 g_retry_stats.transaction_count, g_retry_stats.attempt_count, g_retry_stats.retry_count, \
+                 g_retry_stats.failure_count, g_retry_stats.delay_ms);
+    return;
+}
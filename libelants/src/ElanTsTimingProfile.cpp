@@ -0,0 +1,450 @@
+/** @file
+
+  Implementation of Timing Profile for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Response latencies observed on a device (VID, PID, BC version, bus type) are kept in a profile file,
+  so later runs on the same kind of device wait only as long as it is known to take before reading the response.
+
+  Module Name:
+	ElanTsTimingProfile.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>     /* flock */
+#include <sys/stat.h>
+#include "ErrCode.h"
+#include "ElanTsFwFileIoUtility.h"
+#include "ElanTsTimingProfile.h"
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+struct timing_item_info
+{
+    const char *name;
+    unsigned int default_wait_ms;
+};
+
+struct timing_profile_entry
+{
+    struct timing_device_key device_key;
+    timing_item_t item;
+    unsigned int sample_count;
+    unsigned int sample_ms[TIMING_SAMPLE_COUNT_MAX];   // Oldest First
+    unsigned int new_sample_count;                      // Latest Samples Added in This Run (Not Saved)
+    bool reset;                                         // Samples Dropped in This Run (Not Saved)
+};
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Timing Item Table (Same Order as timing_item_t)
+static const struct timing_item_info g_timing_item_table[TIMING_ITEM_COUNT] =
+{
+    { "flash_write_page",       ELAN_FLASH_WRITE_PAGE_WAIT_MS },
+    { "flash_write_page_block", ELAN_FLASH_WRITE_PAGE_BLOCK_WAIT_MS },
+    { "gen8_flash_write_page",  ELAN_GEN8_FLASH_WRITE_PAGE_WAIT_MS },
+    { "gen8_erase_32_pages",    ELAN_GEN8_ERASE_FLASH_WAIT_MS },
+    { "gen8_erase_64_pages",    ELAN_GEN8_ERASE_FLASH_WAIT_MS },
+    { "gen8_erase_96_pages",    ELAN_GEN8_ERASE_FLASH_WAIT_MS },
+    { "gen8_erase_132_pages",   ELAN_GEN8_ERASE_FLASH_WAIT_MS },
+};
+
+// Profile (All Devices in Profile File, Least Recently Updated First)
+static bool g_timing_profile_enabled = false;
+static char g_timing_profile_path[FILE_NAME_LENGTH_MAX] = {0};
+static struct timing_device_key g_timing_device_key = {0, 0, 0, 0};
+static struct timing_profile_entry g_timing_profile[TIMING_PROFILE_ENTRY_COUNT_MAX];
+static size_t g_timing_profile_count = 0;
+
+// Profile File Content Merged when Saving
+static struct timing_profile_entry g_timing_profile_merged[TIMING_PROFILE_ENTRY_COUNT_MAX];
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Find Entry of Device & Item in Profile Table.
+// With create, Entry is Moved to End of Table (Most Recently Updated) or Created there,
+// and Least Recently Updated Entry is Evicted if Table is Full.
+static struct timing_profile_entry *find_timing_profile_entry_in(struct timing_profile_entry *p_table, size_t *p_count, const struct timing_device_key *p_device_key, timing_item_t item, bool create)
+{
+    size_t entry_index = 0;
+    struct timing_profile_entry entry;
+
+    for(entry_index = 0; entry_index < *p_count; entry_index++)
+    {
+        if((p_table[entry_index].item == item) && (memcmp(&p_table[entry_index].device_key, p_device_key, sizeof(struct timing_device_key)) == 0))
+            break;
+    }
+
+    if(create == false)
+        return (entry_index < *p_count) ? &p_table[entry_index] : NULL;
+
+    if(entry_index < *p_count) // Found
+    {
+        entry = p_table[entry_index];
+    }
+    else
+    {
+        memset(&entry, 0, sizeof(struct timing_profile_entry));
+        entry.device_key = *p_device_key;
+        entry.item = item;
+
+        if(*p_count >= TIMING_PROFILE_ENTRY_COUNT_MAX)
+        {
+            DEBUG_PRINTF("%s: Timing Profile Full (%d Entries), Evict Least Recently Updated Entry (VID=0x%04x, PID=0x%04x, %s).\r\n", __func__, \
+                         TIMING_PROFILE_ENTRY_COUNT_MAX, p_table[0].device_key.vid, p_table[0].device_key.pid, g_timing_item_table[p_table[0].item].name);
+            entry_index = 0;
+        }
+        else
+        {
+            entry_index = (*p_count)++;
+        }
+    }
+
+    // Move to End
+    memmove(&p_table[entry_index], &p_table[entry_index + 1], (*p_count - 1 - entry_index) * sizeof(struct timing_profile_entry));
+    p_table[*p_count - 1] = entry;
+    return &p_table[*p_count - 1];
+}
+
+static struct timing_profile_entry *find_timing_profile_entry(const struct timing_device_key *p_device_key, timing_item_t item, bool create)
+{
+    return find_timing_profile_entry_in(g_timing_profile, &g_timing_profile_count, p_device_key, item, create);
+}
+
+static void add_timing_sample(struct timing_profile_entry *p_entry, unsigned int latency_ms)
+{
+    // Drop Oldest Sample if Full
+    if(p_entry->sample_count >= TIMING_SAMPLE_COUNT_MAX)
+    {
+        memmove(&p_entry->sample_ms[0], &p_entry->sample_ms[1], (TIMING_SAMPLE_COUNT_MAX - 1) * sizeof(unsigned int));
+        p_entry->sample_count = TIMING_SAMPLE_COUNT_MAX - 1;
+    }
+    p_entry->sample_ms[p_entry->sample_count++] = latency_ms;
+    return;
+}
+
+static int compare_sample(const void *p_a, const void *p_b)
+{
+    unsigned int a = *(const unsigned int *)p_a,
+                 b = *(const unsigned int *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+// Profile File
+// Format: One Entry per Line, "<vid> <pid> <bc_version> <bus_type> <item_name> <sample_ms> ..." (IDs in Hex),
+//         Least Recently Updated First, so Entries Evicted from a Full Profile are the Oldest Ones.
+static void read_timing_profile_file(FILE *p_file, struct timing_profile_entry *p_table, size_t *p_count)
+{
+    int name_end = 0,
+        item_index = 0;
+    char line[512] = {0},
+         item_name[32] = {0},
+         *p_sample = NULL,
+         *p_end = NULL;
+    struct timing_device_key device_key;
+    struct timing_profile_entry *p_entry = NULL;
+    unsigned long sample_ms = 0;
+
+    while(fgets(line, sizeof(line), p_file) != NULL)
+    {
+        if(line[0] == '#')
+            continue;
+
+        memset(&device_key, 0, sizeof(device_key));
+        name_end = 0;
+        if((sscanf(line, "%x %x %x %x %31s%n", &device_key.vid, &device_key.pid, &device_key.bc_version, &device_key.bus_type, item_name, &name_end) != 5) || \
+           (name_end == 0))
+            continue; // Skip Broken Line
+
+        for(item_index = 0; item_index < TIMING_ITEM_COUNT; item_index++)
+        {
+            if(strcmp(item_name, g_timing_item_table[item_index].name) == 0)
+                break;
+        }
+        if(item_index == TIMING_ITEM_COUNT)
+            continue; // Item of Other Version
+
+        p_entry = find_timing_profile_entry_in(p_table, p_count, &device_key, (timing_item_t)item_index, true);
+        for(p_sample = &line[name_end]; ; p_sample = p_end)
+        {
+            sample_ms = strtoul(p_sample, &p_end, 10);
+            if(p_end == p_sample)
+                break;
+            add_timing_sample(p_entry, (unsigned int)sample_ms);
+        }
+    }
+
+    return;
+}
+
+int load_timing_profile(const char *p_profile_path, const struct timing_device_key *p_device_key)
+{
+    int err = ERR_SUCCESS;
+    FILE *p_file = NULL;
+
+    // Validate Input Parameter
+    if((p_profile_path == NULL) || (strlen(p_profile_path) == 0) || (strlen(p_profile_path) >= FILE_NAME_LENGTH_MAX) || (p_device_key == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_profile_path=0x%p, p_device_key=0x%p)\r\n", __func__, p_profile_path, p_device_key);
+        err = ERR_INVALID_PARAM;
+        goto LOAD_TIMING_PROFILE_EXIT;
+    }
+
+    strcpy(g_timing_profile_path, p_profile_path);
+    g_timing_device_key = *p_device_key;
+    g_timing_profile_count = 0;
+    g_timing_profile_enabled = true;
+    DEBUG_PRINTF("%s: Timing Profile \"%s\", Device: VID=0x%04x, PID=0x%04x, BC Version=0x%04x, Bus Type=0x%02x.\r\n", __func__, \
+                 g_timing_profile_path, p_device_key->vid, p_device_key->pid, p_device_key->bc_version, p_device_key->bus_type);
+
+    // No Profile Yet => Start with Defaults
+    p_file = fopen(p_profile_path, "r");
+    if(p_file == NULL)
+    {
+        DEBUG_PRINTF("%s: No Timing Profile Yet, Use Default Waits.\r\n", __func__);
+        err = ERR_SUCCESS;
+        goto LOAD_TIMING_PROFILE_EXIT;
+    }
+
+    read_timing_profile_file(p_file, g_timing_profile, &g_timing_profile_count);
+    fclose(p_file);
+    DEBUG_PRINTF("%s: %ld Profile Entries Loaded.\r\n", __func__, g_timing_profile_count);
+
+LOAD_TIMING_PROFILE_EXIT:
+    return err;
+}
+
+// Save:
+// Under Lock of "<profile>.lock", Read Profile File Again (Other Processes may have Saved since Load), Append Only Samples
+// Added in This Run to Its Entries (Samples Saved by Other Processes are Kept), then Write Unique Temp. File in Same Directory
+// & Rename, Never Leave a Half-written or Lost Profile.
+int save_timing_profile(void)
+{
+    int err = ERR_SUCCESS,
+        lock_fd = -1,
+        temp_fd = -1;
+    FILE *p_file = NULL;
+    char lock_path[FILE_NAME_LENGTH_MAX + 8] = {0},
+         temp_path[FILE_NAME_LENGTH_MAX + 8] = {0};
+    size_t entry_index = 0,
+           merged_count = 0;
+    unsigned int sample_index = 0,
+                 new_sample_count = 0;
+    const struct timing_profile_entry *p_entry = NULL;
+    struct timing_profile_entry *p_merged_entry = NULL;
+
+    if(g_timing_profile_enabled == false)
+        goto SAVE_TIMING_PROFILE_EXIT;
+
+    // Lock against Other Processes Saving Same Profile
+    snprintf(lock_path, sizeof(lock_path), "%s.lock", g_timing_profile_path);
+    lock_fd = open(lock_path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if((lock_fd < 0) || (flock(lock_fd, LOCK_EX) != 0))
+    {
+        ERROR_PRINTF("%s: Fail to Lock \"%s\"! errno=%d.\r\n", __func__, lock_path, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto SAVE_TIMING_PROFILE_EXIT_1;
+    }
+
+    // Read Profile File Again & Merge Changes of This Run
+    p_file = fopen(g_timing_profile_path, "r");
+    if(p_file != NULL)
+    {
+        read_timing_profile_file(p_file, g_timing_profile_merged, &merged_count);
+        fclose(p_file);
+    }
+    for(entry_index = 0; entry_index < g_timing_profile_count; entry_index++)
+    {
+        p_entry = &g_timing_profile[entry_index];
+        if((p_entry->reset == false) && (p_entry->new_sample_count == 0))
+            continue;
+        p_merged_entry = find_timing_profile_entry_in(g_timing_profile_merged, &merged_count, &p_entry->device_key, p_entry->item, true);
+
+        // Learned Wait Missed => Drop Saved Samples too
+        if(p_entry->reset)
+            p_merged_entry->sample_count = 0;
+
+        // New Samples are Latest Ones of Entry (Older of Them may have been Dropped if More than Kept)
+        new_sample_count = (p_entry->new_sample_count < p_entry->sample_count) ? p_entry->new_sample_count : p_entry->sample_count;
+        for(sample_index = p_entry->sample_count - new_sample_count; sample_index < p_entry->sample_count; sample_index++)
+            add_timing_sample(p_merged_entry, p_entry->sample_ms[sample_index]);
+    }
+
+    // Write Temp. File & Rename
+    snprintf(temp_path, sizeof(temp_path), "%s.XXXXXX", g_timing_profile_path);
+    temp_fd = mkstemp(temp_path);
+    if(temp_fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Temp. File for \"%s\"! errno=%d.\r\n", __func__, g_timing_profile_path, errno);
+        err = ERR_FILE_IO_ERROR;
+        goto SAVE_TIMING_PROFILE_EXIT_1;
+    }
+    fchmod(temp_fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    p_file = fdopen(temp_fd, "w");
+    if(p_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Open \"%s\"! errno=%d.\r\n", __func__, temp_path, errno);
+        close(temp_fd);
+        unlink(temp_path);
+        err = ERR_FILE_IO_ERROR;
+        goto SAVE_TIMING_PROFILE_EXIT_1;
+    }
+
+    fprintf(p_file, "# vid pid bc_version bus_type item sample_ms...\n");
+    for(entry_index = 0; entry_index < merged_count; entry_index++)
+    {
+        p_entry = &g_timing_profile_merged[entry_index];
+        if(p_entry->sample_count == 0)
+            continue;
+
+        fprintf(p_file, "%04x %04x %04x %02x %s", p_entry->device_key.vid, p_entry->device_key.pid, p_entry->device_key.bc_version, \
+                p_entry->device_key.bus_type, g_timing_item_table[p_entry->item].name);
+        for(sample_index = 0; sample_index < p_entry->sample_count; sample_index++)
+            fprintf(p_file, " %u", p_entry->sample_ms[sample_index]);
+        fprintf(p_file, "\n");
+    }
+
+    if(fclose(p_file) != 0) // Also Close temp_fd
+    {
+        ERROR_PRINTF("%s: Fail to Write \"%s\"!\r\n", __func__, temp_path);
+        unlink(temp_path);
+        err = ERR_FILE_IO_ERROR;
+        goto SAVE_TIMING_PROFILE_EXIT_1;
+    }
+
+    if(rename(temp_path, g_timing_profile_path) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to Rename \"%s\" to \"%s\"!\r\n", __func__, temp_path, g_timing_profile_path);
+        unlink(temp_path);
+        err = ERR_FILE_IO_ERROR;
+        goto SAVE_TIMING_PROFILE_EXIT_1;
+    }
+
+    // Saved
+    for(entry_index = 0; entry_index < g_timing_profile_count; entry_index++)
+    {
+        g_timing_profile[entry_index].new_sample_count = 0;
+        g_timing_profile[entry_index].reset = false;
+    }
+
+    // Success
+    err = ERR_SUCCESS;
+
+SAVE_TIMING_PROFILE_EXIT_1:
+    if(lock_fd >= 0)
+        close(lock_fd); // Also Release Lock
+
+SAVE_TIMING_PROFILE_EXIT:
+    return err;
+}
+
+// Timing Item
+timing_item_t get_gen8_erase_timing_item(unsigned short page_count)
+{
+    // Boot Code Erases 32 Pages per 101ms
+    if(page_count <= 32)
+        return TIMING_ITEM_GEN8_ERASE_32_PAGES;
+    else if(page_count <= 64)
+        return TIMING_ITEM_GEN8_ERASE_64_PAGES;
+    else if(page_count <= 96)
+        return TIMING_ITEM_GEN8_ERASE_96_PAGES;
+    else
+        return TIMING_ITEM_GEN8_ERASE_132_PAGES;
+}
+
+// Wait before Reading Response:
+// Default for Unknown Device / Item, Otherwise Learned Percentile less Margin (Never above Default).
+unsigned int get_timing_wait_ms(timing_item_t item)
+{
+    unsigned int default_wait_ms = g_timing_item_table[item].default_wait_ms,
+                 wait_ms = 0,
+                 sorted_sample_ms[TIMING_SAMPLE_COUNT_MAX] = {0};
+    const struct timing_profile_entry *p_entry = NULL;
+
+    if(g_timing_profile_enabled == false)
+        return default_wait_ms;
+
+    p_entry = find_timing_profile_entry(&g_timing_device_key, item, false);
+    if((p_entry == NULL) || (p_entry->sample_count < TIMING_SAMPLE_COUNT_MIN))
+        return default_wait_ms;
+
+    memcpy(sorted_sample_ms, p_entry->sample_ms, p_entry->sample_count * sizeof(unsigned int));
+    qsort(sorted_sample_ms, p_entry->sample_count, sizeof(unsigned int), compare_sample);
+    wait_ms = sorted_sample_ms[(p_entry->sample_count - 1) * TIMING_WAIT_PERCENTILE / 100];
+    wait_ms = wait_ms * (100 - TIMING_WAIT_MARGIN_PERCENT) / 100;
+
+    return (wait_ms < default_wait_ms) ? wait_ms : default_wait_ms;
+}
+
+// Response
+// Wait, then Receive Response (Blocking up to Read Timeout).
+// A Timeout after a Learned Wait is a Miss: Samples are Dropped (Defaults Used from Next Run) and Response is Awaited Once More.
+int wait_for_response(timing_item_t item, timing_response_receiver receive_response)
+{
+    int err = ERR_SUCCESS;
+    unsigned int wait_ms = 0;
+    unsigned long latency_ms = 0;
+    struct timespec start_time,
+                    end_time;
+    struct timing_profile_entry *p_entry = NULL;
+
+    // Validate Input Parameter
+    if((item >= TIMING_ITEM_COUNT) || (receive_response == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (item=%d, receive_response=0x%p)\r\n", __func__, item, receive_response);
+        err = ERR_INVALID_PARAM;
+        goto WAIT_FOR_RESPONSE_EXIT;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+
+    wait_ms = get_timing_wait_ms(item);
+    if(wait_ms > 0)
+        usleep(wait_ms * 1000);
+
+    err = receive_response();
+    if((err == ERR_IO_TIMEOUT) && (wait_ms < g_timing_item_table[item].default_wait_ms))
+    {
+        DEBUG_PRINTF("%s: Miss of Learned Wait (%s: %ums), Fall back to Default.\r\n", __func__, g_timing_item_table[item].name, wait_ms);
+        p_entry = find_timing_profile_entry(&g_timing_device_key, item, false);
+        if(p_entry != NULL)
+        {
+            p_entry->sample_count = 0;
+            p_entry->new_sample_count = 0;
+            p_entry->reset = true;
+        }
+        err = receive_response();
+    }
+    if(err != ERR_SUCCESS)
+        goto WAIT_FOR_RESPONSE_EXIT;
+
+    // Record Latency (Rounded up to ms)
+    if(g_timing_profile_enabled)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &end_time);
+        latency_ms = (unsigned long)((end_time.tv_sec - start_time.tv_sec) * 1000 + (end_time.tv_nsec - start_time.tv_nsec + 999999) / 1000000);
+        p_entry = find_timing_profile_entry(&g_timing_device_key, item, true);
+        add_timing_sample(p_entry, (unsigned int)latency_ms);
+        p_entry->new_sample_count++;
+    }
+
+WAIT_FOR_RESPONSE_EXIT:
+    return err;
+}
@@ -7,7 +7,9 @@
 #include <fcntl.h>        /* open */
 #include <unistd.h>       /* close */
 #include <sys/ioctl.h>    /* ioctl */
+#include <sys/file.h>     /* flock */
 #include <dirent.h>       // opendir, readdir, closedir
+#include <limits.h>       // PATH_MAX
 #include <linux/hidraw.h> // hidraw
 #include <linux/input.h>  // BUS_TYPE
 #include <errno.h>        // errno
@@ -26,6 +28,12 @@ CHIDLinuxGet::CHIDLinuxGet(char *pszLogDirPath, char *pszLogFileName) : CBaseLog
 
     // Initialize hidraw device handler
     m_nHidrawFd = -1;
+    memset(m_szHidrawDevPath, 0, sizeof(m_szHidrawDevPath));
+
+    // Initialize device lock
+    m_nLockFd = -1;
+    m_nLockMode = HID_DEVICE_LOCK_NONE;
+    memset(m_szLockPath, 0, sizeof(m_szLockPath));
 
     // Initialize file descriptor monitor
     memset(&m_tvRead, 0, sizeof(struct timeval));
@@ -70,6 +78,9 @@ CHIDLinuxGet::CHIDLinuxGet(char *pszLogDirPath, char *pszLogFileName) : CBaseLog
 
 CHIDLinuxGet::~CHIDLinuxGet(void)
 {
+    // Release device lock
+    UnlockDevice();
+
     // Deinitialize mutex (semaphore)
     sem_destroy(&m_ioMutex);
 
@@ -110,6 +121,7 @@ CHIDLinuxGet::~CHIDLinuxGet(void)
 
 void CHIDLinuxGet::Close(void)
 {
+    // (Device lock is kept, so a reconnect does not let other processes in)
     if (m_nHidrawFd >= 0)
     {
         // Release acquired hidraw device handler
@@ -117,6 +129,7 @@ void CHIDLinuxGet::Close(void)
         close(m_nHidrawFd);
         m_nHidrawFd = -1;
     }
+    memset(m_szHidrawDevPath, 0, sizeof(m_szHidrawDevPath));
 
     // Clear Chip Data
     m_usVID     = 0;
@@ -172,12 +185,238 @@ int CHIDLinuxGet::GetDeviceHandle(int nVID, int nPID)
 
     // Success
     m_nHidrawFd = nError;
+    strcpy(m_szHidrawDevPath, szHidrawDevPath);
     DBG("%s: Open hidraw device \'%s\' (non-blocking), fd=%d.", __func__, szHidrawDevPath, m_nHidrawFd);
 
 GET_DEVICE_HANDLE_EXIT:
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::GetDeviceHandleByPath()
+// Open known hidraw device (such as /dev/hidraw0) without scanning /dev,
+// only if it is still the device with input VID & PID (HIDIOCGRAWINFO)
+
+int CHIDLinuxGet::GetDeviceHandleByPath(const char *pszDevicePath, int nVID, int nPID)
+{
+    int nRet = ERR_SUCCESS,
+        nError = 0,
+        nFd = -1;
+    struct hidraw_devinfo info;
+
+    // Check if path is valid
+    if ((pszDevicePath == NULL) || (strlen(pszDevicePath) == 0) || (strlen(pszDevicePath) >= MAX_PATH))
+    {
+        ERR("%s: Invalid Parameter! (pszDevicePath=%p)", __func__, pszDevicePath);
+        nRet = ERR_INVALID_PARAM;
+        goto GET_DEVICE_HANDLE_BY_PATH_EXIT;
+    }
+
+    // Acquire hidraw device handler for I/O
+    nFd = open(pszDevicePath, O_RDWR | O_NONBLOCK);
+    if (nFd < 0)
+    {
+        DBG("%s: Fail to Open Device %s! errno=%d.", __func__, pszDevicePath, errno);
+        nRet = ERR_DEVICE_NOT_FOUND;
+        goto GET_DEVICE_HANDLE_BY_PATH_EXIT;
+    }
+
+    // Make sure it is still the same device
+    nError = ioctl(nFd, HIDIOCGRAWINFO, &info);
+    if ((nError < 0) || (info.vendor != nVID) ||
+        ((info.product != nPID) &&
+         ((nPID != ELAN_HID_FORCE_CONNECT_PID) || ((info.bustype != BUS_I2C) && (info.bustype != BUS_SPI) && (info.bustype != BUS_PCI) /* THC IC */))))
+    {
+        DBG("%s: %s is not hidraw device (VID 0x%x, PID 0x%x)!", __func__, pszDevicePath, nVID, nPID);
+        close(nFd);
+        nRet = ERR_DEVICE_NOT_FOUND;
+        goto GET_DEVICE_HANDLE_BY_PATH_EXIT;
+    }
+
+    // Success
+    m_usVID = (unsigned short) info.vendor;
+    m_usPID = (unsigned short) info.product;
+    m_uiBusType = info.bustype;
+    m_nHidrawFd = nFd;
+    strcpy(m_szHidrawDevPath, pszDevicePath);
+    DBG("%s: Open hidraw device \'%s\' (non-blocking), fd=%d.", __func__, m_szHidrawDevPath, m_nHidrawFd);
+
+GET_DEVICE_HANDLE_BY_PATH_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::GetDeviceLockName()
+// Name of current device for its lock file: physical location of HID device (HIDIOCGRAWPHYS, e.g. "i2c-ELAN2513:00"),
+// or sysfs path of parent device if phys is empty. Both stay the same when device re-enumerates (mode switch),
+// and differ between panels of the same model. VID:PID is used only if neither is available.
+
+void CHIDLinuxGet::GetDeviceLockName(char *pszLockName, size_t nLockNameBufLen)
+{
+    char szName[MAX_PATH] = {0},
+         szSysfsPath[MAX_PATH] = {0},
+         szRealPath[PATH_MAX] = {0};
+    const char *pszHidrawName = strrchr(m_szHidrawDevPath, '/'),
+               *pszParent = NULL;
+    size_t nIndex = 0;
+
+    // Physical Location
+    if ((ioctl(m_nHidrawFd, HIDIOCGRAWPHYS(sizeof(szName) - 1), szName) < 0) || (strlen(szName) == 0))
+    {
+        // Parent of HID Device ("/sys/devices/.../i2c-ELAN2513:00/0018:04F3:2A03.0001")
+        memset(szName, 0, sizeof(szName));
+        snprintf(szSysfsPath, sizeof(szSysfsPath), "/sys/class/hidraw/%s/device", (pszHidrawName != NULL) ? (pszHidrawName + 1) : m_szHidrawDevPath);
+        if (realpath(szSysfsPath, szRealPath) != NULL)
+        {
+            *strrchr(szRealPath, '/') = '\0';
+            pszParent = (strncmp(szRealPath, "/sys/devices/", 13) == 0) ? &szRealPath[13] : szRealPath;
+            snprintf(szName, sizeof(szName), "%s", pszParent);
+        }
+    }
+    if (strlen(szName) == 0)
+        snprintf(szName, sizeof(szName), "%04x_%04x", m_usVID, m_usPID);
+
+    // Keep Filename Safe
+    for (nIndex = 0; szName[nIndex] != '\0'; nIndex++)
+    {
+        if (!(((szName[nIndex] >= 'a') && (szName[nIndex] <= 'z')) || ((szName[nIndex] >= 'A') && (szName[nIndex] <= 'Z')) ||
+              ((szName[nIndex] >= '0') && (szName[nIndex] <= '9')) || (szName[nIndex] == '.') || (szName[nIndex] == '-')))
+            szName[nIndex] = '_';
+    }
+    snprintf(pszLockName, nLockNameBufLen, "%s", szName);
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::LockDevice()
+// Acquire advisory lock (flock) on lock file of current device (see GetDeviceLockName()), so that other processes
+// talking to the same device wait for it. Wait up to nTimeout ms if lock is held.
+// Lock is not on hidraw node, so it is kept while device is closed & opened again (e.g. reconnect
+// after mode switch or SPI re-enumeration) until UnlockDevice(). Locking the same device again is a no-op.
+// If lock file can not be created (e.g. no write access to HID_DEVICE_LOCK_DIR), existing lock file is opened
+// read-only, or else hidraw node itself is locked.
+
+int CHIDLinuxGet::LockDevice(int nLockMode, int nTimeout)
+{
+    int nRet = ERR_SUCCESS,
+        nOperation = 0,
+        nError = 0,
+        nLockFd = -1;
+    char szLockName[MAX_PATH] = {0},
+         szLockPath[MAX_PATH] = {0};
+    struct timeval tvStart, tvNow;
+    long lElapsedMs = 0;
+    bool bWaiting = false;
+
+    // Make Sure Input Parameters Valid
+    if (((nLockMode != HID_DEVICE_LOCK_SHARED) && (nLockMode != HID_DEVICE_LOCK_EXCLUSIVE)) || (nTimeout < 0))
+    {
+        ERR("%s: Input Parameters Invalid! (nLockMode=%d, nTimeout=%d)", __func__, nLockMode, nTimeout);
+        nRet = ERR_INVALID_PARAM;
+        goto LOCK_DEVICE_EXIT;
+    }
+
+    // Make Sure Device Opened
+    if (m_nHidrawFd < 0)
+    {
+        ERR("%s: HID Device Not Opened!", __func__);
+        nRet = ERR_DEVICE_NOT_FOUND;
+        goto LOCK_DEVICE_EXIT;
+    }
+
+    // Lock File of Device
+    GetDeviceLockName(szLockName, sizeof(szLockName));
+    snprintf(szLockPath, sizeof(szLockPath), "%s/elants_hid_%s.lock", HID_DEVICE_LOCK_DIR, szLockName);
+
+    // Already Held (Reconnect)
+    if ((m_nLockFd >= 0) && (m_nLockMode == nLockMode) &&
+        ((strcmp(m_szLockPath, szLockPath) == 0) || (strcmp(m_szLockPath, m_szHidrawDevPath) == 0) /* hidraw Node Locked */))
+    {
+        DBG("%s: '%s' already locked.", __func__, m_szLockPath);
+        goto LOCK_DEVICE_EXIT;
+    }
+    UnlockDevice();
+
+    nLockFd = open(szLockPath, O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+    if (nLockFd < 0)
+        nLockFd = open(szLockPath, O_RDONLY | O_CLOEXEC); // Created by Other User
+    if (nLockFd < 0)
+    {
+        DBG("%s: Fail to open lock file '%s' (errno=%d), lock '%s' instead.", __func__, szLockPath, errno, m_szHidrawDevPath);
+        strcpy(szLockPath, m_szHidrawDevPath);
+        nLockFd = open(szLockPath, O_RDONLY | O_CLOEXEC);
+    }
+    if (nLockFd < 0)
+    {
+        ERR("%s: Fail to open lock file '%s'! errno=%d.", __func__, szLockPath, errno);
+        nRet = ERR_IO_ERROR;
+        goto LOCK_DEVICE_EXIT;
+    }
+
+    nOperation = (nLockMode == HID_DEVICE_LOCK_SHARED) ? LOCK_SH : LOCK_EX;
+    gettimeofday(&tvStart, NULL);
+    while (flock(nLockFd, nOperation | LOCK_NB) != 0)
+    {
+        nError = errno;
+        if (nError == EINTR)
+            continue;
+        if (nError != EWOULDBLOCK)
+        {
+            ERR("%s: Fail to lock '%s'! errno=%d.", __func__, szLockPath, nError);
+            nRet = ERR_IO_ERROR;
+            goto LOCK_DEVICE_EXIT_1;
+        }
+
+        // Bounded Wait
+        gettimeofday(&tvNow, NULL);
+        lElapsedMs = (tvNow.tv_sec - tvStart.tv_sec) * 1000 + (tvNow.tv_usec - tvStart.tv_usec) / 1000;
+        if (lElapsedMs >= nTimeout)
+        {
+            ERR("%s: '%s' is busy (locked by other process over %d ms)!", __func__, m_szHidrawDevPath, nTimeout);
+            nRet = ERR_DEVICE_BUSY;
+            goto LOCK_DEVICE_EXIT_1;
+        }
+        if (bWaiting == false)
+        {
+            DBG("%s: '%s' is locked by other process, wait...", __func__, m_szHidrawDevPath);
+            bWaiting = true;
+        }
+        usleep(HID_DEVICE_LOCK_POLL_MSEC * 1000);
+    }
+
+    m_nLockFd = nLockFd;
+    m_nLockMode = nLockMode;
+    strcpy(m_szLockPath, szLockPath);
+    DBG("%s: Lock '%s' (%s).", __func__, m_szLockPath, (nLockMode == HID_DEVICE_LOCK_SHARED) ? "shared" : "exclusive");
+    goto LOCK_DEVICE_EXIT;
+
+LOCK_DEVICE_EXIT_1:
+    close(nLockFd);
+
+LOCK_DEVICE_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::UnlockDevice()
+// Release advisory lock of current device (End of Device Session)
+
+void CHIDLinuxGet::UnlockDevice(void)
+{
+    if (m_nLockFd >= 0)
+    {
+        flock(m_nLockFd, LOCK_UN);
+        close(m_nLockFd);
+        DBG("%s: Unlock '%s'.", __func__, m_szLockPath);
+    }
+    m_nLockFd = -1;
+    m_nLockMode = HID_DEVICE_LOCK_NONE;
+    memset(m_szLockPath, 0, sizeof(m_szLockPath));
+
+    return;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // CHIDLinuxGet::IsConnected()
 // Check if device connected
@@ -272,6 +511,18 @@ WRITE_RAW_BYTES_EXIT:
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::GetOutputReportId()
+// Report ID of Bridge Command Output Report (Depends on PID)
+
+unsigned char CHIDLinuxGet::GetOutputReportId(void)
+{
+    if (m_usPID == 0x7)
+        return ELAN_HID_OUTPUT_REPORT_ID_PID_B;
+    else
+        return ELAN_HID_OUTPUT_REPORT_ID;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // CHIDLinuxGet::WriteCommand()
 // Write Command Data to HID device
@@ -287,10 +538,7 @@ int CHIDLinuxGet::WriteCommand(unsigned char* pszCommandBuf, int nCommandLen, in
     memset(m_szOutputBuf, 0, sizeof(m_szOutputBuf));
 
     // Insert 3-Byte Header Before Command
-    if (m_usPID == 0x7)
-        m_szOutputBuf[0] = ELAN_HID_OUTPUT_REPORT_ID_PID_B; // HID Report ID
-    else
-        m_szOutputBuf[0] = ELAN_HID_OUTPUT_REPORT_ID; // HID Report ID
+    m_szOutputBuf[0] = GetOutputReportId(); // HID Report ID
     m_szOutputBuf[1] = 0x0; // Bridge Command
     m_szOutputBuf[2] = nCommandLen; // Command Length
 
@@ -381,6 +629,71 @@ READ_RAW_BYTES_EXIT:
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::ReadReport()
+// Read one input report from HID device straight into caller's buffer (no m_inBuf copy)
+// pszBuf: Buffer to read
+// nBufLen: Buffer length
+// pnReportLen: Length of report read
+// nTimeout: Time to wait for device respond
+
+int CHIDLinuxGet::ReadReport(unsigned char* pszBuf, int nBufLen, int* pnReportLen, int nTimeout)
+{
+    int nRet = ERR_SUCCESS,
+        nError = 0;
+
+    // Make Sure Input Parameters Valid
+    if ((pszBuf == NULL) || (nBufLen <= 0) || (pnReportLen == NULL))
+    {
+        ERR("%s: Input Parameters Invalid! (pszBuf=%p, nBufLen=%d, pnReportLen=%p)", __func__, pszBuf, nBufLen, pnReportLen);
+        nRet = ERR_INVALID_PARAM;
+        goto READ_REPORT_INVALID_PARAM_EXIT;
+    }
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    // Re-initialize file descriptor monitor
+    FD_ZERO(&m_fdsHidraw);
+
+    // Add hidraw device handler to file descriptor monitor
+    FD_SET(m_nHidrawFd, &m_fdsHidraw);
+
+    // Set wait time up to nTimeout millisecond
+    m_tvRead.tv_sec = nTimeout / 1000; // sec
+    m_tvRead.tv_usec = (nTimeout % 1000) * 1000; // usec
+
+    // Add file descriptor & timeout to file descriptor monitor
+    nError = select(m_nHidrawFd + 1, &m_fdsHidraw, NULL, NULL, &m_tvRead);
+    if (nError < 0)
+    {
+        ERR("%s: File descriptor monitor select fail! errno=%d.", __func__, nError);
+        nRet = ERR_IO_ERROR;
+        goto READ_REPORT_EXIT;
+    }
+    else if (nError == 0)
+    {
+        nRet = ERR_IO_TIMEOUT; // Timeout error
+        goto READ_REPORT_EXIT;
+    }
+
+    nError = read(m_nHidrawFd, pszBuf, nBufLen);
+    if (nError < 0)
+    {
+        ERR("%s: Fail to Read Report! errno=%d.", __func__, errno);
+        nRet = ERR_IO_ERROR;
+        goto READ_REPORT_EXIT;
+    }
+    *pnReportLen = nError;
+
+READ_REPORT_EXIT:
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+READ_REPORT_INVALID_PARAM_EXIT:
+    return nRet;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // CHIDLinuxGet::ReadData()
 // Read Data from HID device
@@ -525,6 +838,36 @@ GET_DEV_BUS_TYPE_EXIT:
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CHIDLinuxGet::GetDevicePath()
+// Return Path of Current hidraw Device
+
+int CHIDLinuxGet::GetDevicePath(char *pszDevicePath, size_t nDevicePathBufLen)
+{
+    int nRet = ERR_SUCCESS;
+
+    // Make Sure Input Pointers Valid
+    if ((pszDevicePath == NULL) || (nDevicePathBufLen <= strlen(m_szHidrawDevPath)))
+    {
+        ERR("%s: Input Parameters Invalid! (pszDevicePath=%p, nDevicePathBufLen=%zd)", __func__, pszDevicePath, nDevicePathBufLen);
+        nRet = ERR_INVALID_PARAM;
+        goto GET_DEVICE_PATH_EXIT;
+    }
+
+    // Make Sure Device Opened
+    if (m_nHidrawFd < 0)
+    {
+        ERR("%s: HID Device Not Opened!", __func__);
+        nRet = ERR_DEVICE_NOT_FOUND;
+        goto GET_DEVICE_PATH_EXIT;
+    }
+
+    strcpy(pszDevicePath, m_szHidrawDevPath);
+
+GET_DEVICE_PATH_EXIT:
+    return nRet;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // CHIDLinuxGet::GetInBufferSize()
 // Return Input Buffer Size
@@ -0,0 +1,417 @@
+/** @file
+
+  Implementation of libelants C API for Elan HID (I2C-HID / SPI-HID) Touchscreen.
+
+  Module Name:
+	elants.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+  Copyright (c) 2024 ELAN Microelectronics Corp. All Rights Reserved.
+**/
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/input.h>    // BUS_TYPE
+#include "ErrCode.h"
+#include "HidConfig.h"
+#include "ElanTsDebug.h"
+#include "ElanTsHidIo.h"
+#include "ElanTsHidUtility.h"
+#include "ElanTsFuncApi.h"
+#include "ElanTsFwFileIoUtility.h"
+#include "ElanTsFwBundle.h"
+#include "ElanTsGenTraits.h"
+#include "ElanTsFwUpdateFlow.h"
+#include "ElanGen8TsFuncApi.h"
+#include "ElanGen8TsFwUpdateFlow.h"
+#include "elants.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Poll Interval of Reconnect (Device Re-enumerating after Mode Switch)
+#ifndef ELANTS_RECONNECT_POLL_INTERVAL_MSEC
+#define ELANTS_RECONNECT_POLL_INTERVAL_MSEC     100
+#endif //ELANTS_RECONNECT_POLL_INTERVAL_MSEC
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Device Handle
+struct elants_device
+{
+    unsigned short pid;
+    int lock_wait_ms;
+    struct touch_session session;
+};
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+// Protocol Layers Work on One Device (g_pIntfGet), so One Handle per Process
+static struct elants_device g_elants_device;
+static bool g_elants_device_open = false;
+
+/***************************************************
+ * Local Functions
+ ***************************************************/
+
+static int validate_device(elants_device_t *p_device)
+{
+    if((p_device == NULL) || (p_device != &g_elants_device) || (g_elants_device_open == false) || (g_pIntfGet == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Device Handle! (p_device=0x%p)\r\n", __func__, p_device);
+        return ERR_INVALID_PARAM;
+    }
+    return ERR_SUCCESS;
+}
+
+// Information Page Caches & Pipelining State are Process-wide, Drop Them at Every Device Session Boundary
+static void reset_session_state(void)
+{
+    invalidate_info_page_cache();
+    gen8_invalidate_info_page_cache();
+    reset_command_pipeline();
+    return;
+}
+
+static int connect_device(elants_device_t *p_device)
+{
+    int err = ERR_SUCCESS;
+
+    // Release Old Handle (Device Lock is Held for Whole Session)
+    g_pIntfGet->Close();
+    reset_session_state();
+
+    DEBUG_PRINTF("Get HID Device Handle (VID=0x%x, PID=0x%x).\r\n", ELAN_HID_VID, p_device->pid);
+    err = g_pIntfGet->GetDeviceHandle(ELAN_HID_VID, p_device->pid);
+    if(err != ERR_SUCCESS)
+        goto CONNECT_DEVICE_EXIT;
+
+    // Lock Device against Other Processes (e.g. hid_iap / hid_read_fwid), No-op if Already Held
+    err = g_pIntfGet->LockDevice(HID_DEVICE_LOCK_EXCLUSIVE, p_device->lock_wait_ms);
+    if(err != ERR_SUCCESS)
+        g_pIntfGet->Close();
+
+CONNECT_DEVICE_EXIT:
+    return err;
+}
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// Version & Debug
+unsigned int elants_get_api_version(void)
+{
+    return ELANTS_API_VERSION;
+}
+
+void elants_set_debug(int enable)
+{
+    g_debug = (enable != 0);
+}
+
+// Device
+int elants_open(unsigned short pid, int lock_wait_ms, elants_device_t **pp_device)
+{
+    int err = ERR_SUCCESS;
+
+    // Validate Input Parameter
+    if((pp_device == NULL) || (lock_wait_ms < 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (pp_device=0x%p, lock_wait_ms=%d)\r\n", __func__, pp_device, lock_wait_ms);
+        err = ERR_INVALID_PARAM;
+        goto ELANTS_OPEN_EXIT;
+    }
+    if(g_elants_device_open == true)
+    {
+        ERROR_PRINTF("%s: Device Already Opened!\r\n", __func__);
+        err = ERR_DEVICE_BUSY;
+        goto ELANTS_OPEN_EXIT;
+    }
+
+    g_pIntfGet = new CHIDLinuxGet();
+    if(g_pIntfGet == NULL)
+    {
+        err = ERR_NO_INTERFACE_CREATED;
+        goto ELANTS_OPEN_EXIT;
+    }
+
+    memset(&g_elants_device, 0, sizeof(g_elants_device));
+    g_elants_device.pid = pid;
+    g_elants_device.lock_wait_ms = lock_wait_ms;
+    err = connect_device(&g_elants_device);
+    if(err != ERR_SUCCESS)
+        goto ELANTS_OPEN_FREE;
+
+    err = detect_touch_state(&g_elants_device.session);
+    if(err != ERR_SUCCESS)
+    {
+        g_pIntfGet->Close();
+        g_pIntfGet->UnlockDevice();
+        goto ELANTS_OPEN_FREE;
+    }
+
+    g_elants_device_open = true;
+    *pp_device = &g_elants_device;
+    return ERR_SUCCESS;
+
+ELANTS_OPEN_FREE:
+    delete g_pIntfGet;
+    g_pIntfGet = NULL;
+
+ELANTS_OPEN_EXIT:
+    return err;
+}
+
+int elants_close(elants_device_t *p_device)
+{
+    int err = ERR_SUCCESS;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+
+    g_pIntfGet->Close();
+    g_pIntfGet->UnlockDevice();
+    delete g_pIntfGet;
+    g_pIntfGet = NULL;
+    reset_session_state();
+    g_elants_device_open = false;
+
+    return ERR_SUCCESS;
+}
+
+int elants_reconnect(elants_device_t *p_device, int timeout_ms)
+{
+    int err = ERR_SUCCESS;
+    long elapsed_ms = 0;
+    struct timespec start_time,
+                    now_time;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+
+    // Device may Re-enumerate after Mode Switch, so Re-connect before Every Try
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    while(1)
+    {
+        err = connect_device(p_device);
+        if(err == ERR_SUCCESS)
+        {
+            err = detect_touch_state(&p_device->session);
+            if(err == ERR_SUCCESS)
+                break;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &now_time);
+        elapsed_ms = (now_time.tv_sec - start_time.tv_sec) * 1000 + (now_time.tv_nsec - start_time.tv_nsec) / 1000000;
+        if(elapsed_ms >= timeout_ms)
+            break;
+        usleep(ELANTS_RECONNECT_POLL_INTERVAL_MSEC * 1000);
+    }
+
+    return err;
+}
+
+int elants_get_touch_state(elants_device_t *p_device, struct elants_touch_state *p_touch_state)
+{
+    int err = ERR_SUCCESS;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+    if(p_touch_state == NULL)
+        return ERR_INVALID_PARAM;
+
+    p_touch_state->hello_packet = p_device->session.hello_packet;
+    p_touch_state->bc_version = (p_device->session.recovery) ? p_device->session.bc_bc_version : p_device->session.fw_bc_version;
+    p_touch_state->gen8_touch = (p_device->session.gen8_touch) ? 1 : 0;
+    p_touch_state->recovery = (p_device->session.recovery) ? 1 : 0;
+
+    return ERR_SUCCESS;
+}
+
+// Information
+int elants_get_fw_info(elants_device_t *p_device, struct elants_fw_info *p_fw_info)
+{
+    int err = ERR_SUCCESS;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+    if(p_fw_info == NULL)
+        return ERR_INVALID_PARAM;
+
+    // Main Code Command
+    if(p_device->session.recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    memset(p_fw_info, 0, sizeof(struct elants_fw_info));
+    return get_firmware_info(&p_fw_info->fw_id, &p_fw_info->fw_version, &p_fw_info->test_version, &p_fw_info->bc_version, \
+                             p_device->session.gen8_touch);
+}
+
+int elants_read_info_fwid(elants_device_t *p_device, unsigned short *p_info_fwid)
+{
+    int err = ERR_SUCCESS;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+    if(p_info_fwid == NULL)
+        return ERR_INVALID_PARAM;
+
+    if(p_device->session.gen8_touch) // Gen8 Touch
+        return gen8_read_info_fwid(p_info_fwid, p_device->session.recovery);
+    else // Gen5/6/7 Touch
+        return read_info_fwid(p_info_fwid, p_device->session.recovery);
+}
+
+int elants_get_rek_counter(elants_device_t *p_device, unsigned short *p_rek_counter)
+{
+    int err = ERR_SUCCESS;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+    if(p_rek_counter == NULL)
+        return ERR_INVALID_PARAM;
+
+    // Main Code Command
+    if(p_device->session.recovery)
+        return ERR_FUNC_NOT_SUPPORT;
+
+    // Gen8 touch does not support calibration counter, reported as 0 (Same as gen8_get_calibration_counter()).
+    *p_rek_counter = 0;
+    if(p_device->session.gen8_touch)
+        return ERR_SUCCESS;
+
+    return get_rek_counter(p_rek_counter);
+}
+
+// Calibration
+int elants_calibrate(elants_device_t *p_device, struct elants_calibration_result *p_calibration_result)
+{
+    int err = ERR_SUCCESS;
+    struct calibration_result calibration_result;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+    if(p_calibration_result == NULL)
+        return ERR_INVALID_PARAM;
+
+    // Main Code Command, not Supported from Gen8 Touch
+    if((p_device->session.recovery) || (p_device->session.gen8_touch))
+        return ERR_FUNC_NOT_SUPPORT;
+
+    err = calibrate_touch_and_get_counter_with_error_retry(&calibration_result, ERROR_RETRY_COUNT);
+    if(err != ERR_SUCCESS)
+        return err;
+
+    p_calibration_result->duration_ms = calibration_result.duration_ms;
+    p_calibration_result->rek_counter = calibration_result.rek_counter;
+    return ERR_SUCCESS;
+}
+
+// Firmware Update
+int elants_update_firmware(elants_device_t *p_device, const char *p_firmware_path, int skip_action_code, int verify)
+{
+    int err = ERR_SUCCESS,
+        firmware_size = 0;
+    unsigned int bus_type = 0;
+    unsigned short info_fwid = 0;
+    bool gen8_touch = false;
+    struct calibration_result calibration_result;
+
+    err = validate_device(p_device);
+    if(err != ERR_SUCCESS)
+        return err;
+    if((p_firmware_path == NULL) || (strlen(p_firmware_path) == 0) || (skip_action_code < 0))
+        return ERR_INVALID_PARAM;
+    gen8_touch = p_device->session.gen8_touch;
+
+    // Open & Check Firmware File (Image of Bundle Selected by Information FWID)
+    if(is_firmware_bundle(p_firmware_path))
+    {
+        err = elants_read_info_fwid(p_device, &info_fwid);
+        if(err != ERR_SUCCESS)
+            goto ELANTS_UPDATE_FIRMWARE_EXIT;
+        err = open_firmware_bundle_file((char *)p_firmware_path, strlen(p_firmware_path), info_fwid, (gen8_touch) ? ELAN_TS_GEN_8 : ELAN_TS_GEN_5);
+    }
+    else
+        err = open_firmware_file((char *)p_firmware_path, strlen(p_firmware_path));
+    if(err != ERR_SUCCESS)
+        goto ELANTS_UPDATE_FIRMWARE_EXIT;
+    err = get_firmware_size(&firmware_size);
+    if((err == ERR_SUCCESS) && (firmware_size <= 0))
+        err = ERR_FILE_NOT_FOUND;
+    if(err != ERR_SUCCESS)
+        goto ELANTS_UPDATE_FIRMWARE_CLOSE;
+
+    // Refuse Verification before Flash is Touched (e.g. Gen8 Main Code is out of Bulk Read Window)
+    if(verify != 0)
+    {
+        err = (gen8_touch) ? gen8_check_firmware_verifiable() : check_firmware_verifiable();
+        if(err != ERR_SUCCESS)
+            goto ELANTS_UPDATE_FIRMWARE_CLOSE;
+    }
+
+    // Update Firmware
+    if(gen8_touch) // Gen8 Touch
+        err = gen8_update_firmware((char *)p_firmware_path, strlen(p_firmware_path), p_device->session.recovery, skip_action_code);
+    else // Gen5/6/7 Touch
+        err = update_firmware((char *)p_firmware_path, strlen(p_firmware_path), p_device->session.recovery, skip_action_code);
+    if(err != ERR_SUCCESS)
+        goto ELANTS_UPDATE_FIRMWARE_CLOSE;
+
+    // Re-connect Device if SPI
+    if((g_pIntfGet->GetDevBusType(&bus_type) == ERR_SUCCESS) && (bus_type == BUS_SPI))
+    {
+        err = connect_device(p_device);
+        if(err != ERR_SUCCESS)
+            goto ELANTS_UPDATE_FIRMWARE_CLOSE;
+    }
+
+    // Re-calibrate Touch
+    if(gen8_touch)
+    {
+        // Touch Self-calibrates in 100ms after Power-on, 300ms Recommended (Same as hid_iap)
+        usleep(300 * 1000);
+    }
+    else // Gen5/6/7 Touch
+    {
+        err = calibrate_touch_and_get_counter_with_error_retry(&calibration_result, ERROR_RETRY_COUNT);
+        if(err != ERR_SUCCESS)
+            goto ELANTS_UPDATE_FIRMWARE_CLOSE;
+    }
+
+    // Verify Flash with FW File
+    if(verify != 0)
+    {
+        if(gen8_touch) // Gen8 Touch
+            err = gen8_verify_firmware(SILENT_MODE);
+        else // Gen5/6/7 Touch
+            err = verify_firmware(SILENT_MODE);
+        if(err != ERR_SUCCESS)
+            goto ELANTS_UPDATE_FIRMWARE_CLOSE;
+    }
+
+    // Touch Leaves Recovery Mode after Update
+    err = detect_touch_state(&p_device->session);
+
+ELANTS_UPDATE_FIRMWARE_CLOSE:
+    close_firmware_file();
+
+ELANTS_UPDATE_FIRMWARE_EXIT:
+    return err;
+}